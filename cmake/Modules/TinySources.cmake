@@ -70,6 +70,7 @@ function(tinyorm_sources out_headers out_sources)
         ormconcepts.hpp
         ormtypes.hpp
         postgresconnection.hpp
+        query/bindings.hpp
         query/concerns/buildsqueries.hpp
         query/expression.hpp
         query/grammars/grammar.hpp
@@ -100,10 +101,22 @@ function(tinyorm_sources out_headers out_sources)
         schema/schematypes.hpp
         schema/sqliteschemabuilder.hpp
         sqliteconnection.hpp
+        support/asyncqueryworker.hpp
+        support/compiledsqlcache.hpp
+        support/connectionpool.hpp
         support/databaseconfiguration.hpp
         support/databaseconnectionsmap.hpp
+        support/preparedstatementscache.hpp
+        support/querylogsink.hpp
+        types/batchstatement.hpp
+        types/connectionpoolconfig.hpp
+        types/connectionpoolstats.hpp
+        types/cursor.hpp
+        types/latencyhistogram.hpp
         types/log.hpp
+        types/querystatistics.hpp
         types/sqlquery.hpp
+        types/statementscachecounter.hpp
         types/statementscounter.hpp
         utils/configuration.hpp
         utils/container.hpp
@@ -154,7 +167,10 @@ function(tinyorm_sources out_headers out_sources)
             tiny/tinybuilderproxies.hpp
             tiny/tinyconcepts.hpp
             tiny/tinytypes.hpp
+            tiny/types/attributeshash.hpp
             tiny/types/connectionoverride.hpp
+            tiny/types/hydratedcasts.hpp
+            tiny/types/modelcasts.hpp
             tiny/types/syncchanges.hpp
             tiny/utils/attribute.hpp
         )
@@ -223,6 +239,11 @@ function(tinyorm_sources out_headers out_sources)
         schema/schemabuilder.cpp
         schema/sqliteschemabuilder.cpp
         sqliteconnection.cpp
+        support/asyncqueryworker.cpp
+        support/connectionpool.cpp
+        support/querylogsink.cpp
+        types/latencyhistogram.cpp
+        types/querystatistics.cpp
         types/sqlquery.cpp
         utils/configuration.cpp
         utils/fs.cpp
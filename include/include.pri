@@ -62,6 +62,7 @@ headersList += \
     $$PWD/orm/ormconcepts.hpp \
     $$PWD/orm/ormtypes.hpp \
     $$PWD/orm/postgresconnection.hpp \
+    $$PWD/orm/query/bindings.hpp \
     $$PWD/orm/query/concerns/buildsqueries.hpp \
     $$PWD/orm/query/expression.hpp \
     $$PWD/orm/query/grammars/grammar.hpp \
@@ -92,10 +93,22 @@ headersList += \
     $$PWD/orm/schema/schematypes.hpp \
     $$PWD/orm/schema/sqliteschemabuilder.hpp \
     $$PWD/orm/sqliteconnection.hpp \
+    $$PWD/orm/support/asyncqueryworker.hpp \
+    $$PWD/orm/support/compiledsqlcache.hpp \
+    $$PWD/orm/support/connectionpool.hpp \
     $$PWD/orm/support/databaseconfiguration.hpp \
     $$PWD/orm/support/databaseconnectionsmap.hpp \
+    $$PWD/orm/support/preparedstatementscache.hpp \
+    $$PWD/orm/support/querylogsink.hpp \
+    $$PWD/orm/types/batchstatement.hpp \
+    $$PWD/orm/types/connectionpoolconfig.hpp \
+    $$PWD/orm/types/connectionpoolstats.hpp \
+    $$PWD/orm/types/cursor.hpp \
+    $$PWD/orm/types/latencyhistogram.hpp \
     $$PWD/orm/types/log.hpp \
+    $$PWD/orm/types/querystatistics.hpp \
     $$PWD/orm/types/sqlquery.hpp \
+    $$PWD/orm/types/statementscachecounter.hpp \
     $$PWD/orm/types/statementscounter.hpp \
     $$PWD/orm/utils/configuration.hpp \
     $$PWD/orm/utils/container.hpp \
@@ -145,7 +158,10 @@ headersList += \
         $$PWD/orm/tiny/tinybuilderproxies.hpp \
         $$PWD/orm/tiny/tinyconcepts.hpp \
         $$PWD/orm/tiny/tinytypes.hpp \
+        $$PWD/orm/tiny/types/attributeshash.hpp \
         $$PWD/orm/tiny/types/connectionoverride.hpp \
+        $$PWD/orm/tiny/types/hydratedcasts.hpp \
+        $$PWD/orm/tiny/types/modelcasts.hpp \
         $$PWD/orm/tiny/types/syncchanges.hpp \
         $$PWD/orm/tiny/utils/attribute.hpp \
 
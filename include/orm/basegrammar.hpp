@@ -49,11 +49,19 @@ namespace Query
         QString wrap(const QString &value, bool prefixAlias = false) const;
         /*! Wrap a value in keyword identifiers. */
         QString wrap(const Column &value) const;
+        /*! Wrap a value in keyword identifiers and append it to the given SQL. */
+        void wrapTo(QString &sql, const QString &value, bool prefixAlias = false) const;
+        /*! Wrap a value in keyword identifiers and append it to the given SQL. */
+        void wrapTo(QString &sql, const Column &value) const;
 
         /*! Wrap a table in keyword identifiers. */
         QString wrapTable(const QString &table) const;
         /*! Wrap a table in keyword identifiers. */
         QString wrapTable(const FromClause &table) const;
+        /*! Wrap a table in keyword identifiers and append it to the given SQL. */
+        void wrapTableTo(QString &sql, const QString &table) const;
+        /*! Wrap a table in keyword identifiers and append it to the given SQL. */
+        void wrapTableTo(QString &sql, const FromClause &table) const;
 
         /*! Wrap an array of values. */
         template<ColumnContainer T>
@@ -93,20 +101,38 @@ namespace Query
         /*! Convert the vector of column names into a comma delimited string. */
         template<ColumnContainer T>
         QString columnizeWithoutWrap(T &&columns) const;
+        /*! Convert the vector of column names into a wrapped comma delimited string
+            and append it to the given SQL. */
+        template<ColumnContainer T>
+        void columnizeTo(QString &sql, const T &columns) const;
 
         /*! Create query parameter place-holders for the vector. */
         template<Parametrize Container>
         QString parametrize(const Container &values) const;
+        /*! Create query parameter place-holders for the vector and append them
+            to the given SQL. */
+        template<Parametrize Container>
+        void parametrizeTo(QString &sql, const Container &values) const;
         /*! Get the appropriate query parameter place-holder for a value. */
         static QString parameter(const QVariant &value);
+        /*! Append the appropriate query parameter place-holder for a value. */
+        static void parameterTo(QString &sql, const QVariant &value);
 
-        /*! Wrap a value that has an alias. */
-        QString wrapAliasedValue(const QString &value, bool prefixAlias = false) const;
+        /*! Wrap a value that has an alias and append it to the given SQL. */
+        void wrapAliasedValueTo(QString &sql, QStringView value,
+                                bool prefixAlias = false) const;
         /*! Wrap a single string in keyword identifiers. */
-        virtual QString wrapValue(QString value) const;
-
-        /*! Wrap the given value segments. */
-        QString wrapSegments(QStringList segments) const;
+        QString wrapValue(const QString &value) const;
+        /*! Wrap a single string in keyword identifiers and append it to the given
+            SQL. */
+        virtual void wrapValueTo(QString &sql, QStringView value) const;
+        /*! Wrap a single string in the given quote characters (quotes inside are
+            escaped by doubling) and append it to the given SQL. */
+        static void wrapValueWith(QString &sql, QStringView value, QChar quote);
+
+        /*! Wrap the value segments (separated by the dot) and append them to the given
+            SQL. */
+        void wrapSegmentsTo(QString &sql, QStringView value) const;
 
         /*! Get individual segments from the 'from' clause. */
         static QStringList getSegmentsFromFrom(const QString &from);
@@ -125,7 +151,10 @@ namespace Query
     template<ColumnContainer T>
     QString BaseGrammar::columnize(T &&columns) const
     {
-        return columnizeWithoutWrap(wrapArray(std::forward<T>(columns)));
+        QString columnized;
+        columnizeTo(columnized, columns);
+
+        return columnized;
     }
 
     /* I leave this method here because it has meaningful name, not make it inline to avoid
@@ -136,6 +165,21 @@ namespace Query
         return ContainerUtils::join(std::forward<T>(columns));
     }
 
+    template<ColumnContainer T>
+    void BaseGrammar::columnizeTo(QString &sql, const T &columns) const
+    {
+        auto first = true;
+
+        for (const auto &column : columns) {
+            if (first)
+                first = false;
+            else
+                sql += COMMA;
+
+            wrapTo(sql, column);
+        }
+    }
+
     QString BaseGrammar::getTablePrefix() const
     {
         return m_tablePrefix;
@@ -177,14 +221,28 @@ namespace Query
     template<Parametrize Container>
     QString BaseGrammar::parametrize(const Container &values) const
     {
-        QStringList compiledParameters;
-        compiledParameters.reserve(
-                    static_cast<QStringList::size_type>(values.size()));
+        QString parameters;
+        // Mostly the ? placeholders separated by the ", "
+        parameters.reserve(static_cast<QString::size_type>(values.size()) * 3);
 
-        for (const auto &value : values)
-            compiledParameters << parameter(value);
+        parametrizeTo(parameters, values);
+
+        return parameters;
+    }
+
+    template<Parametrize Container>
+    void BaseGrammar::parametrizeTo(QString &sql, const Container &values) const
+    {
+        auto first = true;
+
+        for (const auto &value : values) {
+            if (first)
+                first = false;
+            else
+                sql += COMMA;
 
-        return columnizeWithoutWrap(compiledParameters);
+            parameterTo(sql, value);
+        }
     }
 
 } // namespace Orm
@@ -10,6 +10,8 @@ TINY_SYSTEM_HEADER
 #include <optional>
 
 #include "orm/macros/export.hpp"
+#include "orm/types/latencyhistogram.hpp"
+#include "orm/types/statementscachecounter.hpp"
 #include "orm/types/statementscounter.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
@@ -22,7 +24,8 @@ class DatabaseConnection;
 namespace Concerns
 {
 
-    /*! Counts the number of executed queries and the elapsed time of queries. */
+    /*! Counts the number of executed queries, the elapsed time of queries,
+        and records the queries latency histograms. */
     class SHAREDLIB_EXPORT CountsQueries
     {
         Q_DISABLE_COPY(CountsQueries)
@@ -64,6 +67,28 @@ namespace Concerns
         /*! Reset the number of executed queries. */
         DatabaseConnection &resetStatementsCounter();
 
+        /* Prepared statements cache counter */
+        /*! Obtain the prepared statements cache hits/misses counter. */
+        const StatementsCacheCounter &getStatementsCacheCounter() const;
+        /*! Obtain and reset the prepared statements cache hits/misses counter. */
+        StatementsCacheCounter takeStatementsCacheCounter();
+        /*! Reset the prepared statements cache hits/misses counter. */
+        DatabaseConnection &resetStatementsCacheCounter();
+
+        /* Queries latency histograms */
+        /*! Determine whether we're recording queries latency histograms. */
+        bool countingLatency() const;
+        /*! Enable recording queries latency histograms on the current connection. */
+        DatabaseConnection &enableLatencyHistograms();
+        /*! Disable recording queries latency histograms on the current connection. */
+        DatabaseConnection &disableLatencyHistograms();
+        /*! Obtain queries latency histograms (in nanoseconds), empty when disabled. */
+        const LatencyHistograms &getLatencyHistograms() const;
+        /*! Obtain and reset queries latency histograms. */
+        LatencyHistograms takeLatencyHistograms();
+        /*! Reset queries latency histograms. */
+        DatabaseConnection &resetLatencyHistograms();
+
     protected:
         /* Queries execution time counter */
         /*! Indicates whether queries elapsed time are being counted. */
@@ -77,6 +102,20 @@ namespace Concerns
         /*! Counts executed statements on current connection. */
         StatementsCounter m_statementsCounter {};
 
+        /* Prepared statements cache counter */
+        /*! Counts prepared statements cache hits/misses on current connection. */
+        StatementsCacheCounter m_statementsCacheCounter {};
+
+        /* Queries latency histograms */
+        /*! Indicates whether queries latency histograms are being recorded. */
+        bool m_countingLatency = false;
+        /*! Queries latency histograms on current connection. */
+        LatencyHistograms m_latencyHistograms {};
+
+        /*! Count queries execution time and record the latency into the given
+            histogram (elapsed time in nanoseconds), returns milliseconds. */
+        qint64 hitElapsedCounters(qint64 elapsedNs, LatencyHistogram &latencyHistogram);
+
     private:
         /*! Count transactional queries execution time and statements counter. */
         std::optional<qint64>
@@ -14,6 +14,7 @@ TINY_SYSTEM_HEADER
 
 #include "orm/macros/export.hpp"
 #include "orm/types/log.hpp"
+#include "orm/types/querystatistics.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
@@ -22,6 +23,11 @@ namespace Orm
 
 class DatabaseConnection;
 
+namespace Support
+{
+    class QueryLogSink;
+}
+
 namespace Concerns
 {
 
@@ -53,8 +59,8 @@ namespace Concerns
             in the pretending mode. */
         void logTransactionQueryForPretend(const QString &query) const;
 
-        /*! Get the connection query log. */
-        inline std::shared_ptr<QVector<Log>> getQueryLog() const noexcept;
+        /*! Get the connection query log (ordered from the oldest record). */
+        std::shared_ptr<QVector<Log>> getQueryLog() const;
         /*! Clear the query log. */
         void flushQueryLog();
         /*! Enable the query log on the connection. */
@@ -66,6 +72,19 @@ namespace Concerns
         /*! The current order value for a query log record. */
         inline static std::size_t getQueryLogOrder() noexcept;
 
+        /*! Get the maximum number of records in the query log (0 for unbounded). */
+        inline std::size_t getQueryLogCapacity() const noexcept;
+        /*! Set the maximum number of records in the query log, the query log
+            becomes a ring buffer that overwrites the oldest records (0 for unbounded). */
+        void setQueryLogCapacity(std::size_t capacity);
+
+        /*! Get the query log sink. */
+        inline const std::shared_ptr<Support::QueryLogSink> &
+        getQueryLogSink() const noexcept;
+        /*! Set the query log sink, logged records are also drained to this sink
+            in the background thread (nullptr to unset). */
+        void setQueryLogSink(std::shared_ptr<Support::QueryLogSink> sink) noexcept;
+
         /*! Determine whether debugging SQL queries is enabled/disabled (logging
             to the console using qDebug()). */
         inline bool debugSql() const noexcept;
@@ -74,6 +93,33 @@ namespace Concerns
         /*! Enable debugging SQL queries (logging to the console using qDebug()). */
         inline void enableDebugSql() noexcept;
 
+        /* Normalized queries statistics */
+        /*! Record a query into the connection's queries statistics. */
+        inline void logQueryStatistics(const QString &query, qint64 elapsed,
+                                       const QSqlQuery &queryResult) const;
+        /*! Record a query into the connection's queries statistics. */
+        inline void logQueryStatistics(const QString &query, qint64 elapsed,
+                                       const std::tuple<int, QSqlQuery> &queryResult)
+        const;
+
+        /*! Get the connection normalized queries statistics. */
+        inline std::shared_ptr<QueryStatistics> getQueryStatistics() const noexcept;
+        /*! Get the top N normalized queries statistics. */
+        QVector<QueryStatistic>
+        topQueryStatistics(std::size_t count,
+                           QueryStatisticsSort sortBy = QueryStatisticsSort::TotalTime)
+        const;
+        /*! Clear the queries statistics. */
+        void flushQueryStatistics();
+        /*! Enable collecting normalized queries statistics on the connection,
+            the maxSize defines the maximum number of tracked fingerprints. */
+        void enableQueryStatistics(
+                std::size_t maxSize = QueryStatistics::DefaultMaxSize);
+        /*! Disable collecting normalized queries statistics on the connection. */
+        inline void disableQueryStatistics() noexcept;
+        /*! Determine whether we're collecting normalized queries statistics. */
+        inline bool collectingQueryStatistics() const noexcept;
+
     protected:
         /*! Execute the given callback in "dry run" mode. */
         QVector<Log>
@@ -98,6 +144,8 @@ namespace Concerns
         /*! Log a query into the connection's query log. */
         void logQueryInternal(const QSqlQuery &query, std::optional<qint64> elapsed,
                               const QString &type) const;
+        /*! Append the record to the query log and the query log sink. */
+        void appendQueryLog(Log &&log) const;
 
         /*! Convert a named bindings map to the positional bindings vector. */
         static QVector<QVariant>
@@ -108,8 +156,18 @@ namespace Concerns
 
         /*! Indicates whether queries are being logged (private intentionally). */
         bool m_loggingQueries = false;
+        /*! Indicates whether queries statistics are being collected. */
+        bool m_collectingStatistics = false;
+        /*! Normalized statistics of the queries run against the connection. */
+        std::shared_ptr<QueryStatistics> m_queryStatistics = nullptr;
         /*! All of the queries run against the connection. */
         std::shared_ptr<QVector<Log>> m_queryLogForPretend = nullptr;
+        /*! Maximum number of records in the query log (0 for unbounded). */
+        std::size_t m_queryLogCapacity = 0;
+        /*! Index of the oldest record in the full query log (ring buffer). */
+        mutable QVector<Log>::size_type m_queryLogHead = 0;
+        /*! Query log sink. */
+        std::shared_ptr<Support::QueryLogSink> m_queryLogSink = nullptr;
     };
 
     /* public */
@@ -130,11 +188,6 @@ namespace Concerns
         logQueryInternal(std::get<1>(queryResult), elapsed, type);
     }
 
-    std::shared_ptr<QVector<Log>> LogsQueries::getQueryLog() const noexcept
-    {
-        return m_queryLog;
-    }
-
     void LogsQueries::disableQueryLog() noexcept
     {
         m_loggingQueries = false;
@@ -150,6 +203,17 @@ namespace Concerns
         return m_queryLogId;
     }
 
+    std::size_t LogsQueries::getQueryLogCapacity() const noexcept
+    {
+        return m_queryLogCapacity;
+    }
+
+    const std::shared_ptr<Support::QueryLogSink> &
+    LogsQueries::getQueryLogSink() const noexcept
+    {
+        return m_queryLogSink;
+    }
+
     bool LogsQueries::debugSql() const noexcept
     {
         return m_debugSql;
@@ -165,6 +229,37 @@ namespace Concerns
         m_debugSql = true;
     }
 
+    void LogsQueries::logQueryStatistics(
+            const QString &query, const qint64 elapsed,
+            const QSqlQuery &queryResult) const
+    {
+        // Rows returned, the size is -1 if the driver doesn't support the QuerySize
+        m_queryStatistics->record(query, elapsed, queryResult.size());
+    }
+
+    void LogsQueries::logQueryStatistics(
+            const QString &query, const qint64 elapsed,
+            const std::tuple<int, QSqlQuery> &queryResult) const
+    {
+        // Rows affected
+        m_queryStatistics->record(query, elapsed, std::get<0>(queryResult));
+    }
+
+    std::shared_ptr<QueryStatistics> LogsQueries::getQueryStatistics() const noexcept
+    {
+        return m_queryStatistics;
+    }
+
+    void LogsQueries::disableQueryStatistics() noexcept
+    {
+        m_collectingStatistics = false;
+    }
+
+    bool LogsQueries::collectingQueryStatistics() const noexcept
+    {
+        return m_collectingStatistics && m_queryStatistics;
+    }
+
 } // namespace Concerns
 } // namespace Orm
 
@@ -7,6 +7,7 @@ TINY_SYSTEM_HEADER
 
 #include <memory>
 #include <optional>
+#include <vector>
 
 #include "orm/connectors/connectorinterface.hpp"
 #include "orm/ormtypes.hpp"
@@ -31,9 +32,11 @@ namespace Connectors
         /*! Deleted destructor. */
         ~ConnectionFactory() = delete;
 
-        /*! Establish a QSqlDatabase connection based on the configuration. */
+        /*! Establish a QSqlDatabase connection based on the configuration, the Qt
+            connection name can be overridden (used by the connection pool). */
         static std::unique_ptr<DatabaseConnection>
-        make(QVariantHash &config, const ConnectionName &connection);
+        make(QVariantHash &config, const ConnectionName &connection,
+             const ConnectionName &qtConnection = "");
 
         /*! Create a connector instance based on the configuration. */
         static std::unique_ptr<ConnectorInterface>
@@ -46,7 +49,27 @@ namespace Connectors
 
         /*! Create a single database connection  instance. */
         static std::unique_ptr<DatabaseConnection>
-        createSingleConnection(QVariantHash &&config);
+        createSingleConnection(QVariantHash &&config,
+                               const ConnectionName &qtConnection = "");
+        /*! Create a read/write database connection instance. */
+        static std::unique_ptr<DatabaseConnection>
+        createReadWriteConnection(const QVariantHash &config,
+                                  const ConnectionName &connection,
+                                  const ConnectionName &qtConnection = "");
+        /*! Create the QSqlDatabase connection resolvers for the read connections,
+            every read host has its own QSqlDatabase connection. */
+        static std::vector<std::function<ConnectionName()>>
+        createReadQSqlDatabaseResolvers(const QVariantHash &config,
+                                        const ConnectionName &qtConnection = "");
+
+        /*! Get the read configuration for a read/write connection. */
+        static QVariantHash getReadConfig(const QVariantHash &config);
+        /*! Get the write configuration for a read/write connection. */
+        static QVariantHash getWriteConfig(const QVariantHash &config);
+        /*! Merge a configuration for a read/write connection. */
+        static QVariantHash
+        mergeReadWriteConfig(const QVariantHash &config, const QVariantHash &merge);
+
         /*! Create a new Closure that resolves to a QSqlDatabase instance
             ( only a connection name returned ). */
         static std::function<ConnectionName()>
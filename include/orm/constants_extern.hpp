@@ -116,6 +116,20 @@ namespace Orm::Constants
     SHAREDLIB_EXPORT extern const QString application_name;
     SHAREDLIB_EXPORT extern const QString synchronous_commit;
     SHAREDLIB_EXPORT extern const QString spatial_ref_sys;
+    SHAREDLIB_EXPORT extern const QString statements_cache_size;
+    SHAREDLIB_EXPORT extern const QString compiled_sql_cache_size;
+    SHAREDLIB_EXPORT extern const QString eager_load_any_array;
+    SHAREDLIB_EXPORT extern const QString pool_min_size;
+    SHAREDLIB_EXPORT extern const QString pool_max_size;
+    SHAREDLIB_EXPORT extern const QString pool_idle_timeout;
+    SHAREDLIB_EXPORT extern const QString pool_wait_timeout;
+    SHAREDLIB_EXPORT extern const QString pool_validate;
+    SHAREDLIB_EXPORT extern const QString read_;
+    SHAREDLIB_EXPORT extern const QString write_;
+    SHAREDLIB_EXPORT extern const QString sticky_;
+    SHAREDLIB_EXPORT extern const QString read_strategy;
+    SHAREDLIB_EXPORT extern const QString random_;
+    SHAREDLIB_EXPORT extern const QString round_robin;
 
     SHAREDLIB_EXPORT extern const QString H127001;
     SHAREDLIB_EXPORT extern const QString LOCALHOST;
@@ -123,6 +123,34 @@ namespace Orm::Constants
     synchronous_commit      = QStringLiteral("synchronous_commit");
     inline const QString
     spatial_ref_sys         = QStringLiteral("spatial_ref_sys");
+    inline const QString
+    statements_cache_size   = QStringLiteral("statements_cache_size");
+    inline const QString
+    compiled_sql_cache_size = QStringLiteral("compiled_sql_cache_size");
+    inline const QString
+    eager_load_any_array    = QStringLiteral("eager_load_any_array");
+    inline const QString
+    pool_min_size           = QStringLiteral("pool_min_size");
+    inline const QString
+    pool_max_size           = QStringLiteral("pool_max_size");
+    inline const QString
+    pool_idle_timeout       = QStringLiteral("pool_idle_timeout");
+    inline const QString
+    pool_wait_timeout       = QStringLiteral("pool_wait_timeout");
+    inline const QString
+    pool_validate           = QStringLiteral("pool_validate");
+    inline const QString
+    read_                   = QStringLiteral("read");
+    inline const QString
+    write_                  = QStringLiteral("write");
+    inline const QString
+    sticky_                 = QStringLiteral("sticky");
+    inline const QString
+    read_strategy           = QStringLiteral("read_strategy");
+    inline const QString
+    random_                 = QStringLiteral("random");
+    inline const QString
+    round_robin             = QStringLiteral("round_robin");
 
     inline const QString H127001   = QStringLiteral("127.0.0.1");
     inline const QString LOCALHOST = QStringLiteral("localhost");
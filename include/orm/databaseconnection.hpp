@@ -5,6 +5,12 @@
 #include "orm/macros/systemheader.hpp"
 TINY_SYSTEM_HEADER
 
+#include <QFuture>
+#include <QtSql/QSqlRecord>
+
+#include <deque>
+#include <numeric>
+
 #include "orm/concerns/countsqueries.hpp"
 #include "orm/concerns/detectslostconnections.hpp"
 #include "orm/concerns/logsqueries.hpp"
@@ -15,7 +21,10 @@ TINY_SYSTEM_HEADER
 #include "orm/query/processors/processor.hpp"
 #include "orm/schema/grammars/schemagrammar.hpp"
 #include "orm/schema/schemabuilder.hpp"
-#include "orm/types/sqlquery.hpp"
+#include "orm/support/asyncqueryworker.hpp"
+#include "orm/support/preparedstatementscache.hpp"
+#include "orm/types/batchstatement.hpp"
+#include "orm/types/cursor.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
@@ -93,18 +102,26 @@ namespace Orm
         /*! Run a select statement against the database. */
         SqlQuery
         select(const QString &queryString,
-               const QVector<QVariant> &bindings = {});
-        /*! Run a select statement against the database. */
+               const QVector<QVariant> &bindings = {}, bool useReadConnection = true);
+        /*! Run a select statement against the database (on the write connection). */
         inline SqlQuery
         selectFromWriteConnection(const QString &queryString,
                                   const QVector<QVariant> &bindings = {});
 
+        /*! Run a select statement and return the forward-only cursor (rows are
+            fetched lazily one by one). */
+        Cursor<>
+        cursor(const QString &queryString, const QVector<QVariant> &bindings = {},
+               bool useReadConnection = true);
+
         /*! Run a select statement and return a single result. */
         SqlQuery
-        selectOne(const QString &queryString, const QVector<QVariant> &bindings = {});
+        selectOne(const QString &queryString, const QVector<QVariant> &bindings = {},
+                  bool useReadConnection = true);
         /*! Run a select statement and return the first column of the first row. */
         QVariant
-        scalar(const QString &queryString, const QVector<QVariant> &bindings = {});
+        scalar(const QString &queryString, const QVector<QVariant> &bindings = {},
+               bool useReadConnection = true);
 
         /*! Run an insert statement against the database. */
         inline SqlQuery
@@ -123,7 +140,9 @@ namespace Orm
             calls DatabaseConnection::recordsHaveBeenModified(). */
         SqlQuery statement(const QString &queryString,
                            const QVector<QVariant> &bindings = {});
-        /*! Run an SQL statement and get the number of rows affected (for DML queries). */
+        /*! Run an SQL statement and get the number of rows affected (for DML queries),
+            the query is empty if the statements cache is enabled (it was checked
+            in right away). */
         std::tuple<int, QSqlQuery>
         affectingStatement(const QString &queryString,
                            const QVector<QVariant> &bindings = {});
@@ -131,6 +150,61 @@ namespace Orm
         /*! Run a raw, unprepared query against the database (good for DDL queries). */
         SqlQuery unprepared(const QString &queryString);
 
+        /* Batched statements */
+        /*! Execute the given statements together in a single transaction, returns
+            the number of affected rows and the last inserted ID for every statement. */
+        QVector<BatchResult> batch(const QVector<BatchStatement> &statements);
+        /*! Execute the prepared statement for every row of the column-wise values
+            (one list for every placeholder, a list with one value is bound to every
+            row) in chunks of the given size, returns the number of executed rows. */
+        quint64 execBatch(const QString &queryString,
+                          const QVector<QVariantList> &values,
+                          std::size_t batchSize = 1000);
+
+        /* Bulk load */
+        /*! Stream rows from the row source into the given table using the fastest
+            path for the driver in a single transaction, returns the number of loaded
+            rows. */
+        quint64 bulkLoad(const QString &table, const QVector<QString> &columns,
+                         const BulkLoadRowSource &rowSource);
+
+        /* Asynchronous queries */
+        /*! Callback type used to process the result in the worker thread. */
+        template<typename Result>
+        using SelectAsyncCallback = std::function<Result(SqlQuery &)>;
+
+        /*! Run a select statement in the worker thread, the result is materialized
+            to the vector of records (throws if this connection is in the
+            transaction). */
+        QFuture<QVector<QSqlRecord>>
+        selectAsync(const QString &queryString, const QVector<QVariant> &bindings = {},
+                    bool useReadConnection = true);
+        /*! Run a select statement in the worker thread, the result is processed by
+            the given callback in the worker thread. */
+        template<typename Result>
+        QFuture<Result>
+        selectAsync(const QString &queryString, const QVector<QVariant> &bindings,
+                    bool useReadConnection, SelectAsyncCallback<Result> &&callback);
+        /*! Execute an SQL statement in the worker thread, the result is the number of
+            affected rows (-1 if it can't be determined). The worker thread uses its
+            own connection, so it throws if this connection is in the transaction. */
+        QFuture<int>
+        statementAsync(const QString &queryString,
+                       const QVector<QVariant> &bindings = {});
+        /*! Invoke the given callback with the worker's connection in the worker
+            thread (throws if this connection is in the transaction). */
+        template<typename Result>
+        QFuture<Result>
+        runAsync(std::function<Result(DatabaseConnection &)> &&callback);
+
+        /*! Get the number of queued asynchronous queries. */
+        std::size_t pendingAsyncQueries() const;
+        /*! Wait until all queued asynchronous queries are finished. */
+        void waitForAsyncQueries();
+        /*! Set the factory used to create the worker's connection. */
+        DatabaseConnection &
+        setAsyncConnectionFactory(Support::AsyncQueryWorker::FactoryType &&factory);
+
         /* Obtain connection instance */
         /*! Get underlying database connection (QSqlDatabase). */
         QSqlDatabase getQtConnection();
@@ -146,11 +220,53 @@ namespace Orm
         /*! Get a new QSqlQuery instance for the current connection. */
         QSqlQuery getQtQuery();
 
+        /* Prepared statements cache */
+        /*! Get the maximum number of cached prepared statements (0 if disabled). */
+        inline std::size_t getStatementsCacheSize() const noexcept;
+        /*! Set the maximum number of cached prepared statements (0 to disable). */
+        DatabaseConnection &setStatementsCacheSize(std::size_t size);
+        /*! Get the number of currently cached prepared statements (without checked
+            out statements). */
+        inline std::size_t statementsCacheCount() const noexcept;
+        /*! Remove all cached prepared statements. */
+        DatabaseConnection &flushStatementsCache();
+
+        /* Read/write connections */
+        /*! Set the connection resolvers for the read connections (replicas). */
+        DatabaseConnection &setReadQtConnectionResolvers(
+                std::vector<std::function<Connectors::ConnectionName()>> &&resolvers);
+        /*! Determine whether the connection has any read connections. */
+        inline bool hasReadConnections() const noexcept;
+        /*! Get the number of read connections. */
+        inline std::size_t readConnectionsCount() const noexcept;
+        /*! Get the QSqlDatabase connection names of the resolved read connections. */
+        QStringList getReadQtConnectionNames() const;
+
+        /*! Get the strategy used to select a read connection. */
+        inline ReadStrategy getReadStrategy() const noexcept;
+        /*! Set the strategy used to select a read connection. */
+        inline DatabaseConnection &setReadStrategy(ReadStrategy strategy) noexcept;
+        /*! Determine whether the selects are sent to the write connection after
+            any records have been modified. */
+        inline bool isSticky() const noexcept;
+        /*! Set whether the selects are sent to the write connection after any records
+            have been modified. */
+        inline DatabaseConnection &setSticky(bool sticky) noexcept;
+
+        /*! Determine whether the select queries should be sent to a read connection. */
+        bool shouldUseReadConnection() const;
+
         /*! Prepare the query bindings for execution. */
         QVector<QVariant> prepareBindings(QVector<QVariant> bindings) const;
         /*! Bind values to their parameters in the given statement. */
         static void bindValues(QSqlQuery &query, const QVector<QVariant> &bindings);
 
+        /*! Get the maximum number of bindings allowed in a single statement. */
+        inline virtual std::size_t getMaxBindingsCount() const noexcept;
+        /*! Determine whether the eager loading binds all the keys as a single array
+            instead of splitting them into chunks. */
+        inline virtual bool usesEagerArrayBinding() const;
+
         /*! Determine whether the database connection is currently open. */
         inline bool isOpen();
         /*! Check database connection and show warnings when the state changed. */
@@ -264,6 +380,32 @@ namespace Orm
             a physical connection, only refreshs connection resolver). */
         void reconnectIfMissingConnection() const;
 
+        /*! Run an SQL statement and get the number of rows affected and the executed
+            query (it's never checked in to the statements cache). */
+        std::tuple<int, QSqlQuery>
+        runAffectingStatement(const QString &queryString,
+                              const QVector<QVariant> &bindings);
+
+        /*! Execute the batched statements one by one (wrapped in the transaction by
+            the batch() method), drivers can send them together. */
+        virtual QVector<BatchResult>
+        runBatch(const QVector<BatchStatement> &statements);
+
+        /*! Load rows one by one using a single prepared insert statement (wrapped
+            in the transaction by the bulkLoad() method), drivers can use a faster
+            path. */
+        virtual quint64
+        runBulkLoad(const QString &table, const QVector<QString> &columns,
+                    const BulkLoadRowSource &rowSource);
+        /*! Load rows using the prepared multi-row insert statement, the same statement
+            is re-used for every chunk of rows. */
+        quint64
+        runBulkInsert(const QString &table, const QVector<QString> &columns,
+                      const BulkLoadRowSource &rowSource, std::size_t chunkSize);
+        /*! Get the number of rows in the multi-row insert statement for the given
+            number of columns (respects the 65535 bind parameters limit). */
+        static std::size_t bulkInsertChunkSize(std::size_t columnsCount);
+
         /*! The active QSqlDatabase connection name. */
         std::optional<Connectors::ConnectionName> m_qtConnection = std::nullopt;
         /*! The QSqlDatabase connection resolver. */
@@ -295,14 +437,73 @@ namespace Orm
         bool m_pretending = false;
 
     private:
-        /*! Prepare an SQL statement and return the query object. */
-        QSqlQuery prepareQuery(const QString &queryString);
+        /*! Read connection (replica), the select queries are balanced between them. */
+        struct ReadConnection
+        {
+            /*! Constructor. */
+            inline ReadConnection(
+                    std::function<Connectors::ConnectionName()> &&resolver,
+                    std::size_t statementsCacheSize);
+
+            /*! The QSqlDatabase connection resolver. */
+            std::function<Connectors::ConnectionName()> resolver;
+            /*! The active QSqlDatabase connection name. */
+            std::optional<Connectors::ConnectionName> qtConnection = std::nullopt;
+            /*! Prepared statements cache, every connection has its own statements. */
+            std::shared_ptr<Support::PreparedStatementsCache> statementsCache;
+        };
+
+        /*! Select a read connection for the select query (nullptr if the query should
+            be sent to the write connection). */
+        ReadConnection *selectReadConnection(bool useReadConnection);
+        /*! Get underlying database connection (QSqlDatabase) for the read connection. */
+        static QSqlDatabase getReadQtConnection(ReadConnection &readConnection);
+        /*! Reset the read connections, they will be resolved again lazily. */
+        void resetReadConnections();
+
+        /*! Get the prepared statements cache for the given read connection (the write
+            connection's cache if nullptr). */
+        inline std::shared_ptr<Support::PreparedStatementsCache> &
+        statementsCache(ReadConnection *readConnection) noexcept;
+        /*! Replace the given prepared statements cache by a new empty cache, checked out
+            queries are never checked in to the new cache. */
+        static void resetStatementsCache(
+                std::shared_ptr<Support::PreparedStatementsCache> &statementsCache_);
+
+        /*! Prepare an SQL statement and return the query object (check it out from
+            the prepared statements cache if enabled and not forward-only). */
+        QSqlQuery prepareQuery(const QString &queryString, bool forwardOnly = false,
+                               ReadConnection *readConnection = nullptr);
+        /*! Check in the prepared query after its result set was consumed. */
+        void checkInQuery(QSqlQuery &&query, const QString &queryString,
+                          ReadConnection *readConnection = nullptr);
+        /*! Check in the prepared query when the given query is released by
+            the SqlQuery::releaseStatement() (its result set is consumed by
+            the caller). */
+        void checkInQueryOnRelease(SqlQuery &query, const QString &queryString,
+                                   ReadConnection *readConnection = nullptr);
+        /*! Flush the prepared statements cache if the given query is a DDL query. */
+        void flushStatementsCacheIfDdl(const QString &queryString);
+        /*! Determine whether the given query is a DDL query (CREATE, ALTER, ...). */
+        static bool isDdlQuery(const QString &queryString);
         /*! Get a new invalid QSqlQuery instance for the pretend. */
         inline static QSqlQuery getQtQueryForPretend();
 
         /*! Prepare the QDateTime query binding for execution. */
         QDateTime prepareBinding(const QDateTime &binding) const;
 
+        /*! Execute the prepared statement for the chunk of rows of the column-wise
+            values using the QSqlQuery::execBatch(). */
+        void runExecBatch(const QString &queryString,
+                          const QVector<QVariantList> &values, std::size_t offset,
+                          std::size_t size);
+        /*! Get the chunk of the column-wise values prepared for execution. */
+        QVariantList prepareBatchColumn(const QVariantList &column, std::size_t offset,
+                                        std::size_t size) const;
+        /*! Get the number of rows of the column-wise values (throws if lists have
+            a different number of values). */
+        static std::size_t batchRowsCount(const QVector<QVariantList> &values);
+
         /*! Handle a query exception. */
         template<typename Return>
         Return handleQueryException(
@@ -319,6 +520,10 @@ namespace Orm
         /*! Determine if the elapsed time for queries should be counted. */
         inline bool shouldCountElapsed() const;
 
+        /*! Get the asynchronous query worker, creates it if needed (throws in
+            the pretend mode or in the transaction). */
+        Support::AsyncQueryWorker &asyncWorker();
+
         /*! Log database connected, invoked during MySQL ping. */
         void logConnected();
         /*! Log database disconnected, invoked during MySQL ping. */
@@ -337,6 +542,28 @@ namespace Orm
         /*! Connection's driver name in printable format eg. QMYSQL -> MySQL. */
         std::optional<std::reference_wrapper<
                 const QString>> m_driverNamePrintable = std::nullopt;
+
+        /*! Prepared statements cache, obtained from the connection configuration
+            (shared with the checked out queries, they check in to it). */
+        std::shared_ptr<Support::PreparedStatementsCache> m_statementsCache;
+
+        /*! Read connections (replicas), the std::deque because the ReadConnection
+            isn't movable. */
+        std::deque<ReadConnection> m_readConnections {};
+        /*! Strategy used to select a read connection, obtained from the connection
+            configuration. */
+        ReadStrategy m_readStrategy;
+        /*! Determine whether the selects are sent to the write connection after
+            any records have been modified, obtained from the connection configuration. */
+        bool m_sticky;
+        /*! Index of the next read connection for the round-robin strategy. */
+        std::size_t m_nextReadConnection = 0;
+
+        /*! Factory used to create the worker's connection. */
+        Support::AsyncQueryWorker::FactoryType m_asyncConnectionFactory = nullptr;
+        /*! Asynchronous query worker, created lazily during the first asynchronous
+            query (must be destroyed first, finishes all queued queries). */
+        std::unique_ptr<Support::AsyncQueryWorker> m_asyncWorker = nullptr;
     };
 
     /* public */
@@ -367,8 +594,7 @@ namespace Orm
                                                   const QVector<QVariant> &bindings)
     {
         // This member function is used from the schema builders/post-processors only
-        // FEATURE read/write connection silverqx
-        return select(queryString, bindings/*, false*/);
+        return select(queryString, bindings, false);
     }
 
     SqlQuery
@@ -392,6 +618,58 @@ namespace Orm
         return affectingStatement(queryString, bindings);
     }
 
+    /* Asynchronous queries */
+
+    template<typename Result>
+    QFuture<Result>
+    DatabaseConnection::selectAsync(
+            const QString &queryString, const QVector<QVariant> &bindings,
+            const bool useReadConnection, SelectAsyncCallback<Result> &&callback)
+    {
+        return runAsync<Result>([queryString, bindings, useReadConnection,
+                                 callback = std::move(callback)]
+                                (DatabaseConnection &connection)
+        {
+            auto result = connection.select(queryString, bindings, useReadConnection);
+
+            auto value = std::invoke(callback, result);
+
+            // The result set is consumed, re-use the prepared query by the next query
+            result.releaseStatement();
+
+            return value;
+        });
+    }
+
+    template<typename Result>
+    QFuture<Result>
+    DatabaseConnection::runAsync(std::function<Result(DatabaseConnection &)> &&callback)
+    {
+        auto &worker = asyncWorker();
+
+        auto promise = std::make_shared<QFutureInterface<Result>>();
+        promise->reportStarted();
+
+        auto future = promise->future();
+
+        /* The QSqlDatabase is thread-affine, so the callback is invoked with
+           the worker's connection, the QSqlQuery must never leave the worker thread. */
+        worker.enqueue([promise = std::move(promise), callback = std::move(callback)]
+                       (Support::AsyncQueryWorker &worker_)
+        {
+            try {
+                promise->reportResult(std::invoke(callback, worker_.connection()));
+
+            } catch (...) {
+                Support::AsyncQueryWorker::reportException(*promise);
+            }
+
+            promise->reportFinished();
+        });
+
+        return future;
+    }
+
     /* Obtain connection instance */
 
     const std::function<Connectors::ConnectionName()> &
@@ -400,6 +678,71 @@ namespace Orm
         return m_qtConnectionResolver;
     }
 
+    /* Prepared statements cache */
+
+    std::size_t DatabaseConnection::getStatementsCacheSize() const noexcept
+    {
+        return m_statementsCache->capacity();
+    }
+
+    std::size_t DatabaseConnection::statementsCacheCount() const noexcept
+    {
+        return std::accumulate(m_readConnections.cbegin(), m_readConnections.cend(),
+                               m_statementsCache->size(),
+                               [](const std::size_t size, const auto &readConnection)
+        {
+            return size + readConnection.statementsCache->size();
+        });
+    }
+
+    /* Read/write connections */
+
+    bool DatabaseConnection::hasReadConnections() const noexcept
+    {
+        return !m_readConnections.empty();
+    }
+
+    std::size_t DatabaseConnection::readConnectionsCount() const noexcept
+    {
+        return m_readConnections.size();
+    }
+
+    ReadStrategy DatabaseConnection::getReadStrategy() const noexcept
+    {
+        return m_readStrategy;
+    }
+
+    DatabaseConnection &
+    DatabaseConnection::setReadStrategy(const ReadStrategy strategy) noexcept
+    {
+        m_readStrategy = strategy;
+
+        return *this;
+    }
+
+    bool DatabaseConnection::isSticky() const noexcept
+    {
+        return m_sticky;
+    }
+
+    DatabaseConnection &DatabaseConnection::setSticky(const bool sticky) noexcept
+    {
+        m_sticky = sticky;
+
+        return *this;
+    }
+
+    std::size_t DatabaseConnection::getMaxBindingsCount() const noexcept
+    {
+        // The MySQL and PostgreSQL protocol limit
+        return 65535;
+    }
+
+    bool DatabaseConnection::usesEagerArrayBinding() const
+    {
+        return false;
+    }
+
     bool DatabaseConnection::isOpen()
     {
         return m_qtConnection && getQtConnection().isOpen();
@@ -473,7 +816,10 @@ namespace Orm
 
     void DatabaseConnection::recordsHaveBeenModified(const bool value)
     {
-        m_recordsModified = value;
+        /* Don't reset the state by a query that didn't modify any records, it would
+           move the selects back to the read connection (sticky). */
+        if (!m_recordsModified)
+            m_recordsModified = value;
     }
 
     void DatabaseConnection::forgetRecordModificationState()
@@ -517,11 +863,20 @@ namespace Orm
 
         std::optional<qint64> elapsed;
         if (countElapsed) {
-            // Hit elapsed timer
-            elapsed = timer.elapsed();
+            // Hit elapsed timer, nanoseconds are needed by histograms and statistics
+            const auto elapsedNs = timer.nsecsElapsed();
+
+            // Affecting statements return the number of affected rows
+            auto &latencyHistogram = std::is_same_v<Return, std::tuple<int, QSqlQuery>>
+                                     ? m_latencyHistograms.affecting
+                                     : m_latencyHistograms.normal;
 
-            // Queries execution time counter
-            m_elapsedCounter += *elapsed;
+            // Queries execution time counter / Queries latency histogram
+            elapsed = hitElapsedCounters(elapsedNs, latencyHistogram);
+
+            // Normalized queries statistics
+            if (collectingQueryStatistics())
+                logQueryStatistics(queryString, elapsedNs, result);
         }
 
         /* Once we have run the query we will calculate the time that it took
@@ -549,6 +904,22 @@ namespace Orm
 
     /* private */
 
+    DatabaseConnection::ReadConnection::ReadConnection(
+            std::function<Connectors::ConnectionName()> &&resolver,
+            const std::size_t statementsCacheSize
+    )
+        : resolver(std::move(resolver))
+        , statementsCache(std::make_shared<Support::PreparedStatementsCache>(
+                              statementsCacheSize))
+    {}
+
+    std::shared_ptr<Support::PreparedStatementsCache> &
+    DatabaseConnection::statementsCache(ReadConnection *const readConnection) noexcept
+    {
+        return readConnection == nullptr ? m_statementsCache
+                                         : readConnection->statementsCache;
+    }
+
     QSqlQuery DatabaseConnection::getQtQueryForPretend()
     {
         return QSqlQuery(QSqlDatabase());
@@ -591,7 +962,8 @@ namespace Orm
 
     bool DatabaseConnection::shouldCountElapsed() const
     {
-        return !m_pretending && (m_debugSql || m_countingElapsed);
+        return !m_pretending && (m_debugSql || m_countingElapsed || m_countingLatency ||
+                                 collectingQueryStatistics());
     }
 
 } // namespace Orm
@@ -5,7 +5,12 @@
 #include "orm/macros/systemheader.hpp"
 TINY_SYSTEM_HEADER
 
+#include <QReadWriteLock>
+
+#include <atomic>
+
 #include "orm/connectionresolverinterface.hpp"
+#include "orm/support/connectionpool.hpp"
 #include "orm/support/databaseconfiguration.hpp"
 #include "orm/support/databaseconnectionsmap.hpp"
 
@@ -80,6 +85,11 @@ namespace Query
                 const QString &query, const QVector<QVariant> &bindings = {},
                 const QString &connection = "");
 
+        /*! Run a select statement and return the forward-only cursor. */
+        Cursor<>
+        cursor(const QString &query, const QVector<QVariant> &bindings = {},
+               const QString &connection = "");
+
         /*! Run a select statement and return a single result. */
         SqlQuery
         selectOne(const QString &query, const QVector<QVariant> &bindings = {},
@@ -114,6 +124,20 @@ namespace Query
         /*! Run a raw, unprepared query against the database. */
         SqlQuery unprepared(const QString &query, const QString &connection = "");
 
+        /*! Execute the given statements together in a single transaction. */
+        QVector<BatchResult>
+        batch(const QVector<BatchStatement> &statements,
+              const QString &connection = "");
+
+        /*! Run a select statement in the connection's worker thread. */
+        QFuture<QVector<QSqlRecord>>
+        selectAsync(const QString &query, const QVector<QVariant> &bindings = {},
+                    const QString &connection = "");
+        /*! Execute an SQL statement in the connection's worker thread. */
+        QFuture<int>
+        statementAsync(const QString &query, const QVector<QVariant> &bindings = {},
+                       const QString &connection = "");
+
         /*! Start a new database transaction. */
         bool beginTransaction(const QString &connection = "");
         /*! Commit the active database transaction. */
@@ -145,7 +169,8 @@ namespace Query
         /*! Obtain a reference to the DatabaseManager. */
         static DatabaseManager &reference();
 
-        /*! Get a database connection instance. */
+        /*! Get a database connection instance (the pooled connection must be
+            borrowed for the current task using the checkout() first). */
         DatabaseConnection &connection(const QString &name = "") final;
         /*! Begin a fluent query against the database on a given connection (alias for
             the connection() method). */
@@ -200,6 +225,20 @@ namespace Query
         /*! Set the database reconnector callback. */
         DatabaseManager &setReconnector(const ReconnectorType &reconnector);
 
+        /* Connection pool */
+        /*! Borrow a connection from the connection pool for the current task,
+            the connection() returns this connection in the current thread until
+            the returned PooledConnection is destroyed. */
+        PooledConnection checkout(const QString &connection = "");
+        /*! Determine whether the given connection uses the connection pool. */
+        bool isPooled(const QString &connection = "") const;
+        /*! Get the connection pool metrics. */
+        ConnectionPoolStats poolStats(const QString &connection = "") const;
+        /*! Reset the connection pool metrics. */
+        void resetPoolStats(const QString &connection = "");
+        /*! Close expired idle connections in all connection pools. */
+        std::size_t removeExpiredPooledConnections();
+
         /* Getters / Setters */
         /*! Return the connection's driver name. */
         QString driverName(const QString &connection = "");
@@ -274,6 +313,32 @@ namespace Query
         bool logging(const QString &connection = "");
         /*! The current order value for a query log record. */
         std::size_t getQueryLogOrder() const noexcept;
+        /*! Get the maximum number of records in the query log (0 for unbounded). */
+        std::size_t getQueryLogCapacity(const QString &connection = "");
+        /*! Set the maximum number of records in the query log (0 for unbounded). */
+        void setQueryLogCapacity(std::size_t capacity,
+                                 const QString &connection = "");
+        /*! Set the query log sink (nullptr to unset). */
+        void setQueryLogSink(std::shared_ptr<Support::QueryLogSink> sink,
+                             const QString &connection = "");
+
+        /* Normalized queries statistics */
+        /*! Get the connection normalized queries statistics. */
+        std::shared_ptr<QueryStatistics>
+        getQueryStatistics(const QString &connection = "");
+        /*! Get the top N normalized queries statistics. */
+        QVector<QueryStatistic>
+        topQueryStatistics(std::size_t count,
+                           QueryStatisticsSort sortBy = QueryStatisticsSort::TotalTime,
+                           const QString &connection = "");
+        /*! Clear the queries statistics. */
+        void flushQueryStatistics(const QString &connection = "");
+        /*! Enable collecting normalized queries statistics on the connection. */
+        void enableQueryStatistics(const QString &connection = "");
+        /*! Disable collecting normalized queries statistics on the connection. */
+        void disableQueryStatistics(const QString &connection = "");
+        /*! Determine whether we're collecting normalized queries statistics. */
+        bool collectingQueryStatistics(const QString &connection = "");
 
         /* Queries execution time counter */
         /*! Determine whether we're counting queries execution time. */
@@ -357,6 +422,61 @@ namespace Query
         /*! Reset the number of executed queries on given connections. */
         void resetStatementCounters(const QStringList &connections);
 
+        /* Prepared statements cache counter */
+        /*! Obtain the prepared statements cache hits/misses counter. */
+        const StatementsCacheCounter &
+        getStatementsCacheCounter(const QString &connection = "");
+        /*! Obtain and reset the prepared statements cache hits/misses counter. */
+        StatementsCacheCounter
+        takeStatementsCacheCounter(const QString &connection = "");
+        /*! Reset the prepared statements cache hits/misses counter. */
+        DatabaseConnection &
+        resetStatementsCacheCounter(const QString &connection = "");
+
+        /* Queries latency histograms */
+        /*! Determine whether we're recording queries latency histograms. */
+        bool countingLatency(const QString &connection = "");
+        /*! Enable recording queries latency histograms on the current connection. */
+        DatabaseConnection &
+        enableLatencyHistograms(const QString &connection = "");
+        /*! Disable recording queries latency histograms on the current connection. */
+        DatabaseConnection &
+        disableLatencyHistograms(const QString &connection = "");
+        /*! Obtain queries latency histograms. */
+        const LatencyHistograms &
+        getLatencyHistograms(const QString &connection = "");
+        /*! Obtain and reset queries latency histograms. */
+        LatencyHistograms
+        takeLatencyHistograms(const QString &connection = "");
+        /*! Reset queries latency histograms. */
+        DatabaseConnection &
+        resetLatencyHistograms(const QString &connection = "");
+
+        /*! Determine whether any connection is recording queries latency
+            histograms. */
+        bool anyCountingLatency();
+        /*! Enable recording queries latency histograms on all connections. */
+        void enableAllLatencyHistograms();
+        /*! Disable recording queries latency histograms on all connections. */
+        void disableAllLatencyHistograms();
+        /*! Obtain merged queries latency histograms of all active connections. */
+        LatencyHistograms getAllLatencyHistograms();
+        /*! Obtain and reset queries latency histograms of all active connections. */
+        LatencyHistograms takeAllLatencyHistograms();
+        /*! Reset queries latency histograms on all active connections. */
+        void resetAllLatencyHistograms();
+
+        /*! Enable recording queries latency histograms on given connections. */
+        void enableLatencyHistograms(const QStringList &connections);
+        /*! Disable recording queries latency histograms on given connections. */
+        void disableLatencyHistograms(const QStringList &connections);
+        /*! Obtain merged queries latency histograms of given connections. */
+        LatencyHistograms getLatencyHistograms(const QStringList &connections);
+        /*! Obtain and reset queries latency histograms of given connections. */
+        LatencyHistograms takeLatencyHistograms(const QStringList &connections);
+        /*! Reset queries latency histograms on given connections. */
+        void resetLatencyHistograms(const QStringList &connections);
+
     private:
         /*! Private constructor to create DatabaseManager instance and set a default
             connection at once. */
@@ -397,6 +517,14 @@ namespace Query
             TinyORM connection. */
         DatabaseConnection &refreshQtConnection(const QString &connection);
 
+        /*! Create the connection pool if the pool_max_size config. option is set. */
+        void createPool(const QVariantHash &config, const QString &connection);
+        /*! Get the connection pool for the given connection (nullptr if not pooled). */
+        std::shared_ptr<Support::ConnectionPool> pool(const QString &connection) const;
+        /*! Get the connection pool for the given connection, throws if not pooled. */
+        std::shared_ptr<Support::ConnectionPool>
+        poolOrFail(const QString &connection) const;
+
         /*! Throw exception if DatabaseManager instance already exists. */
         static void checkInstance();
 
@@ -407,6 +535,14 @@ namespace Query
         /*! The callback to be executed to reconnect to a database. */
         ReconnectorType m_reconnector = nullptr;
 
+        /*! Connection pools shared by all threads (for pooled connections). */
+        std::unordered_map<QString,
+                           std::shared_ptr<Support::ConnectionPool>> m_pools {};
+        /*! Protects the connection pools map. */
+        mutable QReadWriteLock m_poolsLock {};
+        /*! Determine whether any connection pool exists (fast path). */
+        std::atomic_bool m_hasPools = false;
+
         /*! Shared pointer to the DatabaseManager instance. */
         static std::shared_ptr<DatabaseManager> m_instance;
     };
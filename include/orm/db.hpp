@@ -75,6 +75,11 @@ namespace Orm
                 const QString &query, const QVector<QVariant> &bindings = {},
                 const QString &connection = "");
 
+        /*! Run a select statement and return the forward-only cursor. */
+        static Cursor<>
+        cursor(const QString &query, const QVector<QVariant> &bindings = {},
+               const QString &connection = "");
+
         /*! Run a select statement and return a single result. */
         static SqlQuery
         selectOne(const QString &query, const QVector<QVariant> &bindings = {},
@@ -110,6 +115,20 @@ namespace Orm
         static SqlQuery
         unprepared(const QString &query, const QString &connection = "");
 
+        /*! Execute the given statements together in a single transaction. */
+        static QVector<BatchResult>
+        batch(const QVector<BatchStatement> &statements,
+              const QString &connection = "");
+
+        /*! Run a select statement in the connection's worker thread. */
+        static QFuture<QVector<QSqlRecord>>
+        selectAsync(const QString &query, const QVector<QVariant> &bindings = {},
+                    const QString &connection = "");
+        /*! Execute an SQL statement in the connection's worker thread. */
+        static QFuture<int>
+        statementAsync(const QString &query, const QVector<QVariant> &bindings = {},
+                       const QString &connection = "");
+
         /*! Start a new database transaction. */
         static bool beginTransaction(const QString &connection = "");
         /*! Commit the active database transaction. */
@@ -193,6 +212,18 @@ namespace Orm
         /*! Set the database reconnector callback. */
         static DatabaseManager &setReconnector(const ReconnectorType &reconnector);
 
+        /* Connection pool */
+        /*! Borrow a connection from the connection pool for the current task. */
+        static PooledConnection checkout(const QString &connection = "");
+        /*! Determine whether the given connection uses the connection pool. */
+        static bool isPooled(const QString &connection = "");
+        /*! Get the connection pool metrics. */
+        static ConnectionPoolStats poolStats(const QString &connection = "");
+        /*! Reset the connection pool metrics. */
+        static void resetPoolStats(const QString &connection = "");
+        /*! Close expired idle connections in all connection pools. */
+        static std::size_t removeExpiredPooledConnections();
+
         /* Getters / Setters */
         /*! Return the connection's driver name. */
         static QString driverName(const QString &connection = "");
@@ -266,6 +297,32 @@ namespace Orm
         static bool logging(const QString &connection = "");
         /*! The current order value for a query log record. */
         static std::size_t getQueryLogOrder() noexcept;
+        /*! Get the maximum number of records in the query log (0 for unbounded). */
+        static std::size_t getQueryLogCapacity(const QString &connection = "");
+        /*! Set the maximum number of records in the query log (0 for unbounded). */
+        static void setQueryLogCapacity(std::size_t capacity,
+                                        const QString &connection = "");
+        /*! Set the query log sink (nullptr to unset). */
+        static void setQueryLogSink(std::shared_ptr<Support::QueryLogSink> sink,
+                                    const QString &connection = "");
+
+        /* Normalized queries statistics */
+        /*! Get the connection normalized queries statistics. */
+        static std::shared_ptr<QueryStatistics>
+        getQueryStatistics(const QString &connection = "");
+        /*! Get the top N normalized queries statistics. */
+        static QVector<QueryStatistic>
+        topQueryStatistics(std::size_t count,
+                           QueryStatisticsSort sortBy = QueryStatisticsSort::TotalTime,
+                           const QString &connection = "");
+        /*! Clear the queries statistics. */
+        static void flushQueryStatistics(const QString &connection = "");
+        /*! Enable collecting normalized queries statistics on the connection. */
+        static void enableQueryStatistics(const QString &connection = "");
+        /*! Disable collecting normalized queries statistics on the connection. */
+        static void disableQueryStatistics(const QString &connection = "");
+        /*! Determine whether we're collecting normalized queries statistics. */
+        static bool collectingQueryStatistics(const QString &connection = "");
 
         /* Queries execution time counter */
         /*! Determine whether we're counting queries execution time. */
@@ -356,6 +413,62 @@ namespace Orm
         /*! Reset the number of executed queries on given connections. */
         static void resetStatementCounters(const QStringList &connections);
 
+        /* Prepared statements cache counter */
+        /*! Obtain the prepared statements cache hits/misses counter. */
+        static const StatementsCacheCounter &
+        getStatementsCacheCounter(const QString &connection = "");
+        /*! Obtain and reset the prepared statements cache hits/misses counter. */
+        static StatementsCacheCounter
+        takeStatementsCacheCounter(const QString &connection = "");
+        /*! Reset the prepared statements cache hits/misses counter. */
+        static DatabaseConnection &
+        resetStatementsCacheCounter(const QString &connection = "");
+
+        /* Queries latency histograms */
+        /*! Determine whether we're recording queries latency histograms. */
+        static bool
+        countingLatency(const QString &connection = "");
+        /*! Enable recording queries latency histograms on the current connection. */
+        static DatabaseConnection &
+        enableLatencyHistograms(const QString &connection = "");
+        /*! Disable recording queries latency histograms on the current connection. */
+        static DatabaseConnection &
+        disableLatencyHistograms(const QString &connection = "");
+        /*! Obtain queries latency histograms. */
+        static const LatencyHistograms &
+        getLatencyHistograms(const QString &connection = "");
+        /*! Obtain and reset queries latency histograms. */
+        static LatencyHistograms
+        takeLatencyHistograms(const QString &connection = "");
+        /*! Reset queries latency histograms. */
+        static DatabaseConnection &
+        resetLatencyHistograms(const QString &connection = "");
+
+        /*! Determine whether any connection is recording queries latency
+            histograms. */
+        static bool anyCountingLatency();
+        /*! Enable recording queries latency histograms on all connections. */
+        static void enableAllLatencyHistograms();
+        /*! Disable recording queries latency histograms on all connections. */
+        static void disableAllLatencyHistograms();
+        /*! Obtain merged queries latency histograms of all active connections. */
+        static LatencyHistograms getAllLatencyHistograms();
+        /*! Obtain and reset queries latency histograms of all active connections. */
+        static LatencyHistograms takeAllLatencyHistograms();
+        /*! Reset queries latency histograms on all active connections. */
+        static void resetAllLatencyHistograms();
+
+        /*! Enable recording queries latency histograms on given connections. */
+        static void enableLatencyHistograms(const QStringList &connections);
+        /*! Disable recording queries latency histograms on given connections. */
+        static void disableLatencyHistograms(const QStringList &connections);
+        /*! Obtain merged queries latency histograms of given connections. */
+        static LatencyHistograms getLatencyHistograms(const QStringList &connections);
+        /*! Obtain and reset queries latency histograms of given connections. */
+        static LatencyHistograms takeLatencyHistograms(const QStringList &connections);
+        /*! Reset queries latency histograms on given connections. */
+        static void resetLatencyHistograms(const QStringList &connections);
+
     private:
         /*! Get a reference to the DatabaseManager. */
         static DatabaseManager &manager();
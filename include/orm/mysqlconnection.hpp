@@ -56,12 +56,49 @@ namespace Orm
         /*! Get the default post processor instance. */
         std::unique_ptr<QueryProcessor> getDefaultPostProcessor() const final;
 
+        /*! Execute the batched statements, they are sent together as a single
+            multi-statement query if the CLIENT_MULTI_STATEMENTS option is enabled. */
+        QVector<BatchResult>
+        runBatch(const QVector<BatchStatement> &statements) final;
+        /*! Load rows using the load data local infile statement through the temporary
+            file if the MYSQL_OPT_LOCAL_INFILE option is enabled, otherwise using
+            the multi-row insert statements. */
+        quint64 runBulkLoad(const QString &table, const QVector<QString> &columns,
+                            const BulkLoadRowSource &rowSource) final;
+
         /*! MySQL server version. */
         std::optional<QString> m_version = std::nullopt;
         /*! Is currently connected the MariaDB database server? */
         std::optional<bool> m_isMaria = std::nullopt;
         /*! Determine whether to use the upsert alias (by MySQL version >=8.0.19). */
         std::optional<bool> m_useUpsertAlias = std::nullopt;
+        /*! Determine whether the multi-statement queries are enabled. */
+        std::optional<bool> m_multiStatements = std::nullopt;
+        /*! Determine whether the load data local infile is enabled. */
+        std::optional<bool> m_localInfile = std::nullopt;
+
+    private:
+        /*! Determine whether the multi-statement queries are enabled (using
+            the CLIENT_MULTI_STATEMENTS connection option). */
+        bool multiStatementsEnabled();
+        /*! Determine whether the load data local infile is enabled (using
+            the MYSQL_OPT_LOCAL_INFILE connection option). */
+        bool localInfileEnabled();
+        /*! Determine whether the given connection option is enabled (passed without
+            the value or with the 1/TRUE value). */
+        bool hasConnectOption(QLatin1String name);
+
+        /*! Replace the ? placeholders with the formatted and escaped bindings. */
+        QString inlineBindings(const QString &queryString,
+                               const QVector<QVariant> &bindings);
+
+        /*! Write rows from the row source to the file in the tab-separated format,
+            returns the number of written rows. */
+        quint64 writeBulkLoadFile(QIODevice &file,
+                                  QVector<QString>::size_type columnsCount,
+                                  const BulkLoadRowSource &rowSource);
+        /*! Append the escaped value to the load data file buffer. */
+        static void appendBulkLoadValue(QByteArray &buffer, const QVariant &value);
     };
 
 } // namespace Orm
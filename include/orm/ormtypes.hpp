@@ -7,6 +7,7 @@ TINY_SYSTEM_HEADER
 
 #include <QTimeZone>
 #include <memory>
+#include <optional>
 
 #include "orm/constants.hpp"
 #include "orm/query/expression.hpp"
@@ -31,6 +32,9 @@ namespace Query
     /*! Type for the DatabaseConnection Reconnector (lambda). */
     using ReconnectorType = std::function<void(const DatabaseConnection &)>;
 
+    /*! Type for the bulk load row source, returns std::nullopt after the last row. */
+    using BulkLoadRowSource = std::function<std::optional<QVector<QVariant>>()>;
+
     /*! Type for the database column. */
     using Column = std::variant<QString, Query::Expression>;
 
@@ -51,9 +55,6 @@ namespace Query
         UNIONORDER,
     };
 
-    /*! Type for the query value bindings. */
-    using BindingsMap = QMap<BindingType, QVector<QVariant>>;
-
     /*! Aggregate item. */
     struct AggregateItem
     {
@@ -151,22 +152,47 @@ namespace Query
         Column max {};
     };
 
+    /*! Where item that stores the second column for the where column clause. */
+    struct WhereColumnTwoItem
+    {
+        Column column {};
+    };
+
+    /*! Where item that stores columns and values for the where row values clause. */
+    struct WhereRowValuesItem
+    {
+        QVector<Column>   columns {};
+        QVector<QVariant> values  {};
+    };
+
+    /*! Where item that stores the sql for the where raw clause. */
+    struct WhereRawItem
+    {
+        QString sql {};
+    };
+
+    /*! Data of the where clause that depend on the where type, only the data needed
+        by the given where type are stored. */
+    using WhereConditionData = std::variant<
+        std::monostate,                // NULL_, NOT_NULL
+        QVariant,                      // BASIC, DATE, TIME, DAY, MONTH, YEAR
+        std::shared_ptr<QueryBuilder>, // NESTED, EXISTS, NOT_EXISTS
+        QVector<QVariant>,             // IN_, NOT_IN
+        WhereColumnTwoItem,            // COLUMN
+        WhereRowValuesItem,            // ROW_VALUES
+        WhereRawItem,                  // RAW
+        WhereBetweenItem,              // BETWEEN
+        WhereBetweenColumnsItem>;      // BETWEEN_COLUMNS
+
     /*! Where clause item, primarily used in grammars to build sql query. */
     struct WhereConditionItem
     {
-        Column                        column         {};
-        QVariant                      value          {};
-        QString                       comparison     {Orm::Constants::EQ};
-        QString                       condition      {Orm::Constants::AND};
-        WhereType                     type           {WhereType::UNDEFINED};
-        std::shared_ptr<QueryBuilder> nestedQuery    {nullptr};
-        QVector<Column>               columns        {};
-        QVector<QVariant>             values         {};
-        Column                        columnTwo      {};
-        QString                       sql            {}; // for the raw version
-        bool                          nope           {false};
-        WhereBetweenItem              between        {};
-        WhereBetweenColumnsItem       betweenColumns {};
+        Column             column     {};
+        QString            comparison {Orm::Constants::EQ};
+        QString            condition  {Orm::Constants::AND};
+        WhereType          type       {WhereType::UNDEFINED};
+        bool               nope       {false};
+        WhereConditionData data       {};
     };
 
     /*! Time zone type for the QtTimeZoneConfig connection configuration option. */
@@ -195,6 +221,16 @@ namespace Query
         inline bool operator==(const QtTimeZoneConfig &) const = default;
     };
 
+    /*! Strategy used to select a read connection, it's saved in the read_strategy
+        database connection configuration option. */
+    enum struct ReadStrategy
+    {
+        /*! Select a random read connection for every select query. */
+        Random,
+        /*! Select read connections one by one in the configured order. */
+        RoundRobin,
+    };
+
 } // namespace Orm
 
 TINYORM_END_COMMON_NAMESPACE
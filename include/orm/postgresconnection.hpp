@@ -30,6 +30,10 @@ namespace Orm
         /*! Get a schema builder instance for the connection. */
         std::unique_ptr<SchemaBuilder> getSchemaBuilder() final;
 
+        /*! Determine whether the eager loading binds all the keys as a single array
+            (controlled by the eager_load_any_array config. option). */
+        bool usesEagerArrayBinding() const final;
+
     protected:
         /*! Get the default query grammar instance. */
         std::unique_ptr<QueryGrammar> getDefaultQueryGrammar() const final;
@@ -37,6 +41,11 @@ namespace Orm
         std::unique_ptr<SchemaGrammar> getDefaultSchemaGrammar() const final;
         /*! Get the default post processor instance. */
         std::unique_ptr<QueryProcessor> getDefaultPostProcessor() const final;
+
+        /*! Load rows using the multi-row insert statements, the COPY FROM STDIN
+            protocol isn't exposed by the QPSQL driver. */
+        quint64 runBulkLoad(const QString &table, const QVector<QString> &columns,
+                            const BulkLoadRowSource &rowSource) final;
     };
 
 } // namespace Orm
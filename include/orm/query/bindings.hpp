@@ -0,0 +1,209 @@
+#pragma once
+#ifndef ORM_QUERY_BINDINGS_HPP
+#define ORM_QUERY_BINDINGS_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QVariant>
+#include <QVector>
+
+#include <algorithm>
+#include <array>
+
+#include "orm/ormtypes.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Query
+{
+
+    /*! The query value bindings stored in one contiguous buffer, bindings of every
+        binding type are stored in their own segment and segments are ordered by
+        the BindingType, so the whole buffer can be bound without flattening. */
+    class Bindings
+    {
+    public:
+        /*! Size type used by the bindings buffer. */
+        using size_type = QVector<QVariant>::size_type;
+
+        /*! Number of the binding types. */
+        constexpr static std::size_t TypesCount =
+                static_cast<std::size_t>(BindingType::UNIONORDER) + 1;
+
+        /*! Default constructor. */
+        inline Bindings() = default;
+
+        /*! Equality comparison operator for the Bindings. */
+        inline bool operator==(const Bindings &) const = default;
+
+        /*! Get all the bindings ordered by the binding type. */
+        inline const QVector<QVariant> &all() const noexcept;
+        /*! Get the bindings of the given type (copy). */
+        inline QVector<QVariant> value(BindingType type) const;
+        /*! Get all the bindings starting from the given binding type (copy). */
+        inline QVector<QVariant> valuesFrom(BindingType type) const;
+
+        /*! Get the offset of the given binding type segment in the buffer. */
+        inline size_type offset(BindingType type) const noexcept;
+        /*! Get the number of bindings of the given type. */
+        inline size_type size(BindingType type) const noexcept;
+        /*! Get the number of all the bindings. */
+        inline size_type size() const noexcept;
+        /*! Determine whether there are no bindings. */
+        inline bool isEmpty() const noexcept;
+
+        /*! Append the binding to the given binding type segment. */
+        inline void append(BindingType type, const QVariant &binding);
+        /*! Append the binding to the given binding type segment. */
+        inline void append(BindingType type, QVariant &&binding);
+        /*! Append the bindings to the given binding type segment. */
+        inline void append(BindingType type, const QVector<QVariant> &bindings);
+        /*! Append the bindings to the given binding type segment. */
+        inline void append(BindingType type, QVector<QVariant> &&bindings);
+
+        /*! Replace the bindings of the given binding type. */
+        inline void replace(BindingType type, QVector<QVariant> &&bindings);
+        /*! Remove all the bindings of the given binding type. */
+        inline void clear(BindingType type);
+
+        /*! Determine whether the given binding type is valid. */
+        inline static bool isValidType(BindingType type) noexcept;
+
+    private:
+        /*! Get the index of the given binding type. */
+        inline static std::size_t index(BindingType type) noexcept;
+        /*! Make a room for the given number of bindings at the end of the given
+            binding type segment, returns the position of the first new binding. */
+        inline size_type grow(BindingType type, size_type count);
+
+        /*! All the bindings ordered by the binding type. */
+        QVector<QVariant> m_bindings {};
+        /*! End offsets of the binding type segments. */
+        std::array<size_type, TypesCount> m_ends {};
+    };
+
+    /* public */
+
+    const QVector<QVariant> &Bindings::all() const noexcept
+    {
+        return m_bindings;
+    }
+
+    QVector<QVariant> Bindings::value(const BindingType type) const
+    {
+        return m_bindings.mid(offset(type), size(type));
+    }
+
+    QVector<QVariant> Bindings::valuesFrom(const BindingType type) const
+    {
+        return m_bindings.mid(offset(type));
+    }
+
+    Bindings::size_type Bindings::offset(const BindingType type) const noexcept
+    {
+        const auto typeIndex = index(type);
+
+        return typeIndex == 0 ? 0 : m_ends.at(typeIndex - 1);
+    }
+
+    Bindings::size_type Bindings::size(const BindingType type) const noexcept
+    {
+        return m_ends.at(index(type)) - offset(type);
+    }
+
+    Bindings::size_type Bindings::size() const noexcept
+    {
+        return m_bindings.size();
+    }
+
+    bool Bindings::isEmpty() const noexcept
+    {
+        return m_bindings.isEmpty();
+    }
+
+    void Bindings::append(const BindingType type, const QVariant &binding)
+    {
+        m_bindings[grow(type, 1)] = binding;
+    }
+
+    void Bindings::append(const BindingType type, QVariant &&binding)
+    {
+        m_bindings[grow(type, 1)] = std::move(binding);
+    }
+
+    void Bindings::append(const BindingType type, const QVector<QVariant> &bindings)
+    {
+        if (bindings.isEmpty())
+            return;
+
+        const auto position = grow(type, bindings.size());
+
+        std::copy(bindings.cbegin(), bindings.cend(), m_bindings.begin() + position);
+    }
+
+    void Bindings::append(const BindingType type, QVector<QVariant> &&bindings)
+    {
+        if (bindings.isEmpty())
+            return;
+
+        const auto position = grow(type, bindings.size());
+
+        std::move(bindings.begin(), bindings.end(), m_bindings.begin() + position);
+    }
+
+    void Bindings::replace(const BindingType type, QVector<QVariant> &&bindings)
+    {
+        clear(type);
+        append(type, std::move(bindings));
+    }
+
+    void Bindings::clear(const BindingType type)
+    {
+        const auto count = size(type);
+
+        // Nothing to do
+        if (count == 0)
+            return;
+
+        m_bindings.remove(offset(type), count);
+
+        for (auto segmentIndex = index(type); segmentIndex < TypesCount; ++segmentIndex)
+            m_ends.at(segmentIndex) -= count;
+    }
+
+    bool Bindings::isValidType(const BindingType type) noexcept
+    {
+        return static_cast<int>(type) >= 0 &&
+               static_cast<std::size_t>(type) < TypesCount;
+    }
+
+    /* private */
+
+    std::size_t Bindings::index(const BindingType type) noexcept
+    {
+        Q_ASSERT(isValidType(type));
+
+        return static_cast<std::size_t>(type);
+    }
+
+    Bindings::size_type Bindings::grow(const BindingType type, const size_type count)
+    {
+        const auto typeIndex = index(type);
+        const auto position = m_ends.at(typeIndex);
+
+        /* Bindings are mostly added in the binding type order, so it appends at
+           the end most of the time, otherwise the following segments are shifted. */
+        m_bindings.insert(position, count, QVariant());
+
+        for (auto segmentIndex = typeIndex; segmentIndex < TypesCount; ++segmentIndex)
+            m_ends.at(segmentIndex) += count;
+
+        return position;
+    }
+
+} // namespace Orm::Query
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_QUERY_BINDINGS_HPP
@@ -8,6 +8,8 @@ TINY_SYSTEM_HEADER
 #include <optional>
 
 #include "orm/basegrammar.hpp"
+#include "orm/query/bindings.hpp"
+#include "orm/support/compiledsqlcache.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
@@ -46,12 +48,22 @@ namespace Orm::Query::Grammars
                            const QVector<QVariantMap> &values,
                            const QString &sequence) const;
 
+        /*! Compile a multi-row insert statement with placeholders for the given
+            number of rows into SQL (used by the bulk load). */
+        QString compileBulkInsert(const QString &table, const QVector<QString> &columns,
+                                  std::size_t rows) const;
+        /*! Compile a statement that loads the data file on the client side into
+            the table into SQL (used by the bulk load). */
+        virtual QString
+        compileLoadDataFile(const QString &table, const QVector<QString> &columns,
+                            const QString &filepath) const;
+
         /*! Compile an update statement into SQL. */
         virtual QString
         compileUpdate(QueryBuilder &query, const QVector<UpdateItem> &values) const;
         /*! Prepare the bindings for an update statement. */
         QVector<QVariant>
-        prepareBindingsForUpdate(const BindingsMap &bindings,
+        prepareBindingsForUpdate(const Bindings &bindings,
                                  const QVector<UpdateItem> &values) const;
 
         /*! Compile an "upsert" statement into SQL. */
@@ -63,7 +75,7 @@ namespace Orm::Query::Grammars
         virtual QString compileDelete(QueryBuilder &query) const;
         /*! Prepare the bindings for a delete statement. */
         QVector<QVariant>
-        prepareBindingsForDelete(const BindingsMap &bindings) const;
+        prepareBindingsForDelete(const Bindings &bindings) const;
 
         /*! Compile a truncate table statement into SQL. Returns a map of
             the query string and bindings. */
@@ -76,6 +88,13 @@ namespace Orm::Query::Grammars
         /*! Get the grammar specific operators. */
         virtual const QVector<QString> &getOperators() const;
 
+        /*! Get the compiled SQL cache of select queries. */
+        inline const Support::CompiledSqlCache &getCompiledSqlCache() const noexcept;
+        /*! Set the maximum number of cached compiled select queries (0 to disable). */
+        Grammar &setCompiledSqlCacheSize(std::size_t size);
+        /*! Flush the compiled SQL cache of select queries. */
+        Grammar &flushCompiledSqlCache();
+
     protected:
         /*! Select component types. */
         enum struct SelectComponentType
@@ -95,18 +114,19 @@ namespace Orm::Query::Grammars
         /*! The select component compile method and whether the component was set. */
         struct SelectComponentValue
         {
-            /*! The component's compile method. */
-            std::function<QString(const QueryBuilder &)> compileMethod;
+            /*! The component's compile method (appends to the given SQL). */
+            std::function<void(QString &, const QueryBuilder &)> compileMethod;
             /*! Determine whether the component is set and is not empty. */
             std::function<bool(const QueryBuilder &)> isset;
         };
+        /*! The where clause compile method (appends to the given SQL). */
+        using WhereMethod = std::function<void(QString &, const WhereConditionItem &)>;
 
         /*! Map the ComponentType to a Grammar::compileXx() methods. */
         virtual const QMap<SelectComponentType, SelectComponentValue> &
         getCompileMap() const = 0;
         /*! Map the WhereType to a Grammar::whereXx() methods. */
-        virtual const std::function<QString(const WhereConditionItem &)> &
-        getWhereMethod(WhereType whereType) const = 0;
+        virtual const WhereMethod &getWhereMethod(WhereType whereType) const = 0;
 
         /*! Determine whether the 'aggregate' component should be compiled. */
         static bool shouldCompileAggregate(const std::optional<AggregateItem> &aggregate);
@@ -116,90 +136,94 @@ namespace Orm::Query::Grammars
         static bool shouldCompileFrom(const std::variant<std::monostate, QString,
                                       Query::Expression> &from);
 
+        /*! Compile a select query into SQL, bypasses the compiled SQL cache. */
+        QString compileSelectInternal(QueryBuilder &query) const;
+        /*! Get the structural key of the query (the query shape), queries with
+            the same shape are compiled into the same SQL. */
+        QString getQueryShape(const QueryBuilder &query) const;
+
+        /* All the following compileXx() and whereXx() methods append the compiled
+           SQL to the given SQL buffer, so the whole query is compiled in one pass. */
+
         /*! Compile the components necessary for a select clause. */
-        QStringList compileComponents(const QueryBuilder &query) const;
+        void compileComponents(QString &sql, const QueryBuilder &query) const;
 
         /*! Compile an aggregated select clause. */
-        QString compileAggregate(const QueryBuilder &query) const;
+        void compileAggregate(QString &sql, const QueryBuilder &query) const;
         /*! Compile the "select *" portion of the query. */
-        virtual QString compileColumns(const QueryBuilder &query) const;
+        virtual void compileColumns(QString &sql, const QueryBuilder &query) const;
 
         /*! Compile the "from" portion of the query. */
-        QString compileFrom(const QueryBuilder &query) const;
+        void compileFrom(QString &sql, const QueryBuilder &query) const;
 
         /*! Compile the "where" portions of the query. */
-        QString compileWheres(const QueryBuilder &query) const;
-        /*! Get the vector of all the where clauses for the query. */
-        QStringList compileWheresToVector(const QueryBuilder &query) const;
-        /*! Format the where clause statements into one string. */
-        static QString concatenateWhereClauses(const QueryBuilder &query,
-                                               const QStringList &sql);
+        void compileWheres(QString &sql, const QueryBuilder &query) const;
+        /*! Compile the where clauses without the leading "where" (or "on"). */
+        void compileWhereClauses(QString &sql, const QueryBuilder &query) const;
 
         /*! Compile the "join" portions of the query. */
-        QString compileJoins(const QueryBuilder &query) const;
+        void compileJoins(QString &sql, const QueryBuilder &query) const;
 
         /*! Compile the "group by" portions of the query. */
-        QString compileGroups(const QueryBuilder &query) const;
+        void compileGroups(QString &sql, const QueryBuilder &query) const;
 
         /*! Compile the "having" portions of the query. */
-        QString compileHavings(const QueryBuilder &query) const;
-        /*! Compile a single having clause. */
-        QString compileHaving(const HavingConditionItem &having) const;
-        /*! Compile a basic having clause. */
-        QString compileBasicHaving(const HavingConditionItem &having) const;
+        void compileHavings(QString &sql, const QueryBuilder &query) const;
+        /*! Compile a single having clause (without the boolean). */
+        void compileHaving(QString &sql, const HavingConditionItem &having) const;
+        /*! Compile a basic having clause (without the boolean). */
+        void compileBasicHaving(QString &sql, const HavingConditionItem &having) const;
 
         /*! Compile the "order by" portions of the query. */
-        QString compileOrders(const QueryBuilder &query) const;
-        /*! Compile the query orders to the vector. */
-        QStringList compileOrdersToVector(const QueryBuilder &query) const;
+        void compileOrders(QString &sql, const QueryBuilder &query) const;
         /*! Compile the "limit" portions of the query. */
-        QString compileLimit(const QueryBuilder &query) const;
+        void compileLimit(QString &sql, const QueryBuilder &query) const;
         /*! Compile the "offset" portions of the query. */
-        QString compileOffset(const QueryBuilder &query) const;
+        void compileOffset(QString &sql, const QueryBuilder &query) const;
 
         /*! Compile the lock into SQL. */
-        virtual QString compileLock(const QueryBuilder &query) const;
+        virtual void compileLock(QString &sql, const QueryBuilder &query) const;
 
         /*! Compile a basic where clause. */
-        QString whereBasic(const WhereConditionItem &where) const;
+        void whereBasic(QString &sql, const WhereConditionItem &where) const;
         /*! Compile a nested where clause. */
-        QString whereNested(const WhereConditionItem &where) const;
+        void whereNested(QString &sql, const WhereConditionItem &where) const;
         /*! Compile a where clause comparing two columns. */
-        QString whereColumn(const WhereConditionItem &where) const;
+        void whereColumn(QString &sql, const WhereConditionItem &where) const;
         /*! Compile a "where in" clause. */
-        QString whereIn(const WhereConditionItem &where) const;
+        void whereIn(QString &sql, const WhereConditionItem &where) const;
         /*! Compile a "where not in" clause. */
-        QString whereNotIn(const WhereConditionItem &where) const;
+        void whereNotIn(QString &sql, const WhereConditionItem &where) const;
         /*! Compile a "where null" clause. */
-        QString whereNull(const WhereConditionItem &where) const;
+        void whereNull(QString &sql, const WhereConditionItem &where) const;
         /*! Compile a "where not null" clause. */
-        QString whereNotNull(const WhereConditionItem &where) const;
+        void whereNotNull(QString &sql, const WhereConditionItem &where) const;
         /*! Compile a raw where clause. */
-        QString whereRaw(const WhereConditionItem &where) const;
+        void whereRaw(QString &sql, const WhereConditionItem &where) const;
         /*! Compile a "where exists" clause. */
-        QString whereExists(const WhereConditionItem &where) const;
+        void whereExists(QString &sql, const WhereConditionItem &where) const;
         /*! Compile a "where not exists" clause. */
-        QString whereNotExists(const WhereConditionItem &where) const;
+        void whereNotExists(QString &sql, const WhereConditionItem &where) const;
         /*! Compile a where row values condition. */
-        QString whereRowValues(const WhereConditionItem &where) const;
+        void whereRowValues(QString &sql, const WhereConditionItem &where) const;
         /*! Compile a "between" where clause. */
-        QString whereBetween(const WhereConditionItem &where) const;
+        void whereBetween(QString &sql, const WhereConditionItem &where) const;
         /*! Compile a "between" where clause using columns. */
-        QString whereBetweenColumns(const WhereConditionItem &where) const;
+        void whereBetweenColumns(QString &sql, const WhereConditionItem &where) const;
 
         /*! Compile a "where date" clause. */
-        QString whereDate(const WhereConditionItem &where) const;
+        void whereDate(QString &sql, const WhereConditionItem &where) const;
         /*! Compile a "where time" clause. */
-        QString whereTime(const WhereConditionItem &where) const;
+        void whereTime(QString &sql, const WhereConditionItem &where) const;
         /*! Compile a "where day" clause. */
-        QString whereDay(const WhereConditionItem &where) const;
+        void whereDay(QString &sql, const WhereConditionItem &where) const;
         /*! Compile a "where month" clause. */
-        QString whereMonth(const WhereConditionItem &where) const;
+        void whereMonth(QString &sql, const WhereConditionItem &where) const;
         /*! Compile a "where year" clause. */
-        QString whereYear(const WhereConditionItem &where) const;
+        void whereYear(QString &sql, const WhereConditionItem &where) const;
         /*! Compile a date based where clause. */
-        virtual QString
-        dateBasedWhere(const QString &type, const WhereConditionItem &where) const;
+        virtual void dateBasedWhere(QString &sql, const QString &type,
+                                    const WhereConditionItem &where) const;
 
         /*! Compile a insert values lists. */
         QStringList compileInsertToVector(const QVector<QVariantMap> &values) const;
@@ -225,20 +249,14 @@ namespace Orm::Query::Grammars
         compileDeleteWithJoins(const QueryBuilder &query, const QString &table,
                                const QString &wheres) const;
 
-        /*! Concatenate an array of segments, removing empties. */
-        static QString concatenate(QStringList &&segments);
-        /*! Remove the leading boolean from a statement. */
-        static QString removeLeadingBoolean(QString &&statement);
-
-        /*! Flat bindings map and exclude given binding types. */
-        static QVector<std::reference_wrapper<const QVariant>>
-        flatBindingsForUpdateDelete(const BindingsMap &bindings,
-                                    const QVector<BindingType> &exclude);
-
-        /*! Compute the reserve size for the BindingsMap. */
-        static QVector<QVariant>::size_type
-        computeReserveForBindingsMap(const BindingsMap &bindings,
-                                     const QVector<BindingType> &exclude = {});
+    private:
+        /*! Compiled select queries keyed by the query shape. */
+        mutable Support::CompiledSqlCache m_compiledSqlCache {};
+        /*! Running estimate of the compiled select query size, used to reserve
+            the SQL buffer. */
+        mutable QString::size_type m_sqlSizeEstimate = 0;
+        /*! Nesting depth of the select queries being compiled (0 if none). */
+        mutable int m_compileSelectDepth = 0;
     };
 
     /* public */
@@ -252,6 +270,11 @@ namespace Orm::Query::Grammars
         return compileInsert(query, values);
     }
 
+    const Support::CompiledSqlCache &Grammar::getCompiledSqlCache() const noexcept
+    {
+        return m_compiledSqlCache;
+    }
+
 } // namespace Orm::Query::Grammars
 
 TINYORM_END_COMMON_NAMESPACE
@@ -30,6 +30,12 @@ namespace Orm::Query::Grammars
         QString compileInsertOrIgnore(const QueryBuilder &query,
                                       const QVector<QVariantMap> &values) const override;
 
+        /*! Compile a load data local infile statement into SQL, the file has to be
+            in the tab-separated format with \N for NULL values. */
+        QString compileLoadDataFile(const QString &table,
+                                    const QVector<QString> &columns,
+                                    const QString &filepath) const override;
+
         /*! Compile an "upsert" statement into SQL. */
         QString compileUpsert(
                     QueryBuilder &query, const QVector<QVariantMap> &values,
@@ -37,7 +43,7 @@ namespace Orm::Query::Grammars
                     const QStringList &update) const override;
 
         /*! Compile the lock into SQL. */
-        QString compileLock(const QueryBuilder &query) const override;
+        void compileLock(QString &sql, const QueryBuilder &query) const override;
 
         /*! Compile the random statement into SQL. */
         QString compileRandom(const QString &seed) const override;
@@ -46,15 +52,15 @@ namespace Orm::Query::Grammars
         const QVector<QString> &getOperators() const override;
 
     protected:
-        /*! Wrap a single string in keyword identifiers. */
-        QString wrapValue(QString value) const override;
+        /*! Wrap a single string in keyword identifiers and append it to the given
+            SQL. */
+        void wrapValueTo(QString &sql, QStringView value) const override;
 
         /*! Map the ComponentType to a Grammar::compileXx() methods. */
         const QMap<SelectComponentType, SelectComponentValue> &
         getCompileMap() const override;
         /*! Map the WhereType to a Grammar::whereXx() methods. */
-        const std::function<QString(const WhereConditionItem &)> &
-        getWhereMethod(WhereType whereType) const override;
+        const WhereMethod &getWhereMethod(WhereType whereType) const override;
 
         /*! Compile an update statement without joins into SQL. */
         QString
@@ -49,32 +49,31 @@ namespace Orm::Query::Grammars
         compileTruncate(const QueryBuilder &query) const override;
 
         /*! Compile the lock into SQL. */
-        QString compileLock(const QueryBuilder &query) const override;
+        void compileLock(QString &sql, const QueryBuilder &query) const override;
 
         /*! Get the grammar specific operators. */
         const QVector<QString> &getOperators() const override;
 
         /*! Compile a basic where clause. */
-        QString whereBasic(const WhereConditionItem &where) const;
+        void whereBasic(QString &sql, const WhereConditionItem &where) const;
 
     protected:
         /*! Map the ComponentType to a Grammar::compileXx() methods. */
         const QMap<SelectComponentType, SelectComponentValue> &
         getCompileMap() const override;
         /*! Map the WhereType to a Grammar::whereXx() methods. */
-        const std::function<QString(const WhereConditionItem &)> &
-        getWhereMethod(WhereType whereType) const override;
+        const WhereMethod &getWhereMethod(WhereType whereType) const override;
 
         /*! Compile the "select *" portion of the query. */
-        QString compileColumns(const QueryBuilder &query) const override;
+        void compileColumns(QString &sql, const QueryBuilder &query) const override;
 
         /*! Compile a "where date" clause. */
-        QString whereDate(const WhereConditionItem &where) const;
+        void whereDate(QString &sql, const WhereConditionItem &where) const;
         /*! Compile a "where time" clause. */
-        QString whereTime(const WhereConditionItem &where) const;
+        void whereTime(QString &sql, const WhereConditionItem &where) const;
         /*! Compile a date based where clause. */
-        QString dateBasedWhere(const QString &type, const
-                               WhereConditionItem &where) const override;
+        void dateBasedWhere(QString &sql, const QString &type,
+                            const WhereConditionItem &where) const override;
 
         /*! Compile the columns for an update statement. */
         QString compileUpdateColumns(const QVector<UpdateItem> &values) const override;
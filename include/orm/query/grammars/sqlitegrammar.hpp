@@ -45,7 +45,7 @@ namespace Orm::Query::Grammars
         compileTruncate(const QueryBuilder &query) const override;
 
         /*! Compile the lock into SQL. */
-        QString compileLock(const QueryBuilder &query) const override;
+        void compileLock(QString &sql, const QueryBuilder &query) const override;
 
         /*! Get the grammar specific operators. */
         const QVector<QString> &getOperators() const override;
@@ -55,25 +55,24 @@ namespace Orm::Query::Grammars
         const QMap<SelectComponentType, SelectComponentValue> &
         getCompileMap() const override;
         /*! Map the WhereType to a Grammar::whereXx() methods. */
-        const std::function<QString(const WhereConditionItem &)> &
-        getWhereMethod(WhereType whereType) const override;
+        const WhereMethod &getWhereMethod(WhereType whereType) const override;
 
         /*! Compile a "where date" clause. */
-        QString whereDate(const WhereConditionItem &where) const;
+        void whereDate(QString &sql, const WhereConditionItem &where) const;
         /*! Compile a "where time" clause. */
-        QString whereTime(const WhereConditionItem &where) const;
+        void whereTime(QString &sql, const WhereConditionItem &where) const;
         /*! Compile a "where day" clause. */
-        QString whereDay(const WhereConditionItem &where) const;
+        void whereDay(QString &sql, const WhereConditionItem &where) const;
         /*! Compile a "where month" clause. */
-        QString whereMonth(const WhereConditionItem &where) const;
+        void whereMonth(QString &sql, const WhereConditionItem &where) const;
         /*! Compile a "where year" clause. */
-        QString whereYear(const WhereConditionItem &where) const;
+        void whereYear(QString &sql, const WhereConditionItem &where) const;
         /*! Compile a date based where clause. */
-        QString dateBasedWhere(const QString &type,
-                               const WhereConditionItem &where) const override;
+        void dateBasedWhere(QString &sql, const QString &type,
+                            const WhereConditionItem &where) const override;
         /*! Column for a date based where clause based on the type (uses strftime()). */
-        QString dateBasedWhereColumn(const QString &type,
-                                     const WhereConditionItem &where) const;
+        void dateBasedWhereColumn(QString &sql, const QString &type,
+                                  const WhereConditionItem &where) const;
 
         /*! Compile the columns for an update statement. */
         QString compileUpdateColumns(const QVector<UpdateItem> &values) const override;
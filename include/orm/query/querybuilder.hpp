@@ -5,11 +5,17 @@
 #include "orm/macros/systemheader.hpp"
 TINY_SYSTEM_HEADER
 
+#include <QFuture>
+#include <QtSql/QSqlRecord>
+
 #include <memory>
+#include <ranges>
 #include <unordered_set>
 
+#include "orm/query/bindings.hpp"
 #include "orm/query/concerns/buildsqueries.hpp"
 #include "orm/query/grammars/grammar.hpp"
+#include "orm/types/cursor.hpp"
 #include "orm/utils/query.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
@@ -39,7 +45,7 @@ namespace Orm::Query
         // To access enforceOrderBy()
         friend Concerns::BuildsQueries;
 #ifndef TINYORM_DISABLE_ORM
-        // To access stripTableForPluck()
+        // To access stripTableForPluck() and toSqlWithColumns()
         template<typename Model>
         friend class Tiny::Builder;
 #endif
@@ -53,7 +59,7 @@ namespace Orm::Query
         /*! Constructor. */
         Builder(DatabaseConnection &connection, const QueryGrammar &grammar);
         /* Need to be the polymorphic type because of dynamic_cast<>
-           in the Grammar::concatenateWhereClauses(). */
+           in the Grammar::compileWheres(). */
         /*! Virtual destructor. */
         inline ~Builder() override = default;
 
@@ -70,6 +76,13 @@ namespace Orm::Query
         /* Retrieving results */
         /*! Execute the query as a "select" statement. */
         SqlQuery get(const QVector<Column> &columns = {ASTERISK});
+        /*! Execute the query as a "select" statement and return the forward-only
+            cursor, rows are fetched lazily one by one. */
+        Cursor<> cursor(const QVector<Column> &columns = {ASTERISK});
+        /*! Execute the query as a "select" statement in the connection's worker
+            thread (throws if the connection is in the transaction). */
+        QFuture<QVector<QSqlRecord>>
+        getAsync(const QVector<Column> &columns = {ASTERISK});
         /*! Execute a query for a single record by ID. */
         SqlQuery find(const QVariant &id, const QVector<Column> &columns = {ASTERISK});
 
@@ -135,9 +148,32 @@ namespace Orm::Query
         insertOrIgnore(const QVector<QString> &columns,
                        const QVector<QVector<QVariant>> &values);
 
+        /*! Stream rows from the row source into the table using the fastest path
+            for the driver, returns the number of loaded rows. */
+        quint64 bulkLoad(const QVector<QString> &columns,
+                         const BulkLoadRowSource &rowSource);
+        /*! Stream rows from the given range into the table using the fastest path
+            for the driver, returns the number of loaded rows. */
+        template<std::ranges::input_range R>
+        requires std::constructible_from<QVector<QVariant>,
+                                         std::ranges::range_reference_t<R>>
+        quint64 bulkLoad(const QVector<QString> &columns, R &&rows);
+
+        /*! Insert new records using the statement prepared only once and executed
+            in batches, values are column-wise (one list of values for every column). */
+        quint64 insertBatch(const QVector<QString> &columns,
+                            const QVector<QVariantList> &values,
+                            std::size_t batchSize = 1000);
+
         /*! Update records in the database. */
         std::tuple<int, QSqlQuery>
         update(const QVector<UpdateItem> &values);
+        /*! Update records matched by the unique column using the statement prepared
+            only once and executed in batches, values are column-wise (one list
+            of values for every column including the unique column). */
+        quint64 updateBatch(const QVector<QString> &columns,
+                            const QVector<QVariantList> &values,
+                            const QString &uniqueBy, std::size_t batchSize = 1000);
         /*! Insert or update a record matching the attributes, and fill it with values. */
         std::tuple<int, std::optional<QSqlQuery>>
         updateOrInsert(const QVector<WhereItem> &attributes,
@@ -442,6 +478,17 @@ namespace Orm::Query
         /*! Add an "or where not in" clause to the query. */
         Builder &orWhereNotIn(const Column &column, const QVector<QVariant> &values);
 
+        /*! Add a "where in" clause to the query that binds all the values as a single
+            array, the query string is the same for any number of values
+            (PostgreSQL only). */
+        Builder &whereInArray(const Column &column, const QVector<QVariant> &values,
+                              const QString &condition = AND);
+        /*! Replace the values of the "where in" clause at the given index, its
+            bindings start at the given offset of the where bindings. */
+        Builder &replaceWhereInValues(QVector<QVariant>::size_type whereIndex,
+                                      QVector<QVariant>::size_type bindingsOffset,
+                                      QVector<QVariant> &&values);
+
         /* where null */
         /*! Add a "where null" clause to the query. */
         Builder &whereNull(const QVector<Column> &columns = {ASTERISK},
@@ -713,6 +760,12 @@ namespace Orm::Query
         /*! Lock the selected rows in the table. */
         Builder &lock(QString &&value);
 
+        /* Read/write connections */
+        /*! Send the select queries to the write connection. */
+        inline Builder &useWriteConnection(bool value = true) noexcept;
+        /*! Determine whether the select queries are sent to the write connection. */
+        inline bool usesWriteConnection() const noexcept;
+
         /* Debugging */
         /*! Dump the current SQL and bindings. */
         void dump(bool replaceBindings = true, bool simpleBindings = false);
@@ -727,10 +780,10 @@ namespace Orm::Query
         /*! Get the query grammar instance. */
         inline const QueryGrammar &getGrammar() const noexcept;
 
-        /*! Get the current query value bindings as flattened QVector. */
+        /*! Get the current query value bindings ordered by the binding type. */
         QVector<QVariant> getBindings() const;
-        /*! Get the raw map of bindings. */
-        inline const BindingsMap &getRawBindings() const noexcept;
+        /*! Get the raw bindings (segmented by the binding type). */
+        inline const Bindings &getRawBindings() const noexcept;
         /*! Add a binding to the query. */
         Builder &addBinding(const QVariant &binding,
                             BindingType type = BindingType::WHERE);
@@ -815,7 +868,8 @@ namespace Orm::Query
             COLUMNS,
         };
 
-        /*! Clone the query. */
+        /*! Clone the query, cheap as the query state is implicitly shared (copied
+            on the first modification of the clone). */
         inline Builder clone() const;
         /*! Clone the query without the given properties. */
         Builder cloneWithout(const std::unordered_set<PropertyType> &properties) const;
@@ -826,6 +880,10 @@ namespace Orm::Query
     protected:
         /*! Throw if the given operator is not valid for the current DB connection. */
         void throwIfInvalidOperator(const QString &comparison) const;
+        /*! Throw if the number of columns and lists of values for the batch
+            execution differ. */
+        static void throwIfBatchColumnsMismatch(const QVector<QString> &columns,
+                                                const QVector<QVariantList> &values);
 
         /*! Remove all of the expressions from a list of bindings. */
         static QVector<QVariant> cleanBindings(const QVector<QVariant> &bindings);
@@ -857,6 +915,9 @@ namespace Orm::Query
         SqlQuery
         onceWithColumns(const QVector<Column> &columns,
                         const std::function<SqlQuery()> &callback);
+        /*! Get the SQL representation of the query while selecting the given
+            columns. */
+        QString toSqlWithColumns(const QVector<Column> &columns);
 
         /*! Creates a subquery and parse it. */
         std::pair<QString, QVector<QVariant>>
@@ -941,19 +1002,8 @@ namespace Orm::Query
         /*! The database query grammar instance. */
         const QueryGrammar &m_grammar;
 
-        /*! The current query value bindings.
-            Order is crucial here because of that QMap with an enum struct is used. */
-        BindingsMap m_bindings {
-            {BindingType::SELECT,     {}},
-            {BindingType::FROM,       {}},
-            {BindingType::JOIN,       {}},
-            {BindingType::WHERE,      {}},
-            {BindingType::GROUPBY,    {}},
-            {BindingType::HAVING,     {}},
-            {BindingType::ORDER,      {}},
-            {BindingType::UNION,      {}},
-            {BindingType::UNIONORDER, {}},
-        };
+        /*! The current query value bindings, ordered by the binding type. */
+        Bindings m_bindings {};
 
         /*! An aggregate function and column to be run. */
         std::optional<AggregateItem> m_aggregate = std::nullopt;
@@ -979,6 +1029,8 @@ namespace Orm::Query
         int m_offset = -1;
         /*! Indicates whether row locking is being used. */
         std::variant<std::monostate, bool, QString> m_lock {};
+        /*! Indicates whether the select queries are sent to the write connection. */
+        bool m_useWriteConnection = false;
     };
 
     /* public */
@@ -1028,10 +1080,8 @@ namespace Orm::Query
            the results and get the exact data that was requested for the query. */
         auto query = get({column, key});
 
-        const auto size = QueryUtils::queryResultSize(query);
-
         // Empty result
-        if (size == 0)
+        if (QueryUtils::queryResultSizeHint(query) == 0)
             return {};
 
         /* If the column is qualified with a table or have an alias, we cannot use
@@ -1047,11 +1097,34 @@ namespace Orm::Query
             result.try_emplace(query.value(unqualifiedKey).value<T>(),
                                query.value(unqualifiedColumn));
 
+        // The result set is consumed, re-use the prepared query by the next query
+        query.releaseStatement();
+
         return result;
     }
 
     /* Insert, Update, Delete */
 
+    template<std::ranges::input_range R>
+    requires std::constructible_from<QVector<QVariant>,
+                                     std::ranges::range_reference_t<R>>
+    quint64 Builder::bulkLoad(const QVector<QString> &columns, R &&rows)
+    {
+        auto itRow = std::ranges::begin(rows);
+        const auto itEnd = std::ranges::end(rows);
+
+        return bulkLoad(columns, [&itRow, &itEnd]() -> std::optional<QVector<QVariant>>
+        {
+            if (itRow == itEnd)
+                return std::nullopt;
+
+            QVector<QVariant> row(*itRow);
+            ++itRow;
+
+            return row;
+        });
+    }
+
     template<Remove T>
     std::tuple<int, QSqlQuery> Builder::deleteRow(T &&id)
     {
@@ -1597,6 +1670,20 @@ namespace Orm::Query
         return update(columns);
     }
 
+    /* Read/write connections */
+
+    Builder &Builder::useWriteConnection(const bool value) noexcept
+    {
+        m_useWriteConnection = value;
+
+        return *this;
+    }
+
+    bool Builder::usesWriteConnection() const noexcept
+    {
+        return m_useWriteConnection;
+    }
+
     /* Getters / Setters */
 
     DatabaseConnection &Builder::getConnection() const noexcept
@@ -1609,7 +1696,7 @@ namespace Orm::Query
         return m_grammar;
     }
 
-    const BindingsMap &Builder::getRawBindings() const noexcept
+    const Bindings &Builder::getRawBindings() const noexcept
     {
         return m_bindings;
     }
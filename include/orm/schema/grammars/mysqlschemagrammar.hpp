@@ -161,8 +161,9 @@ namespace Grammars
         QString compileKey(const Blueprint &blueprint, const IndexCommand &command,
                            const QString &type) const;
 
-        /*! Wrap a single string in keyword identifiers. */
-        QString wrapValue(QString value) const override;
+        /*! Wrap a single string in keyword identifiers and append it to the given
+            SQL. */
+        void wrapValueTo(QString &sql, QStringView value) const override;
 
         /*! Escape special characters (used by the defaultValue and comment). */
         QString escapeString(QString value) const override;
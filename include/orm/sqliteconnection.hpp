@@ -36,6 +36,9 @@ namespace Orm
         /*! Set return the QDateTime or QString (override the return_qdatetime). */
         SQLiteConnection &setReturnQDateTime(bool value);
 
+        /*! Get the maximum number of bindings allowed in a single statement. */
+        inline std::size_t getMaxBindingsCount() const noexcept final;
+
     protected:
         /*! Get the default query grammar instance. */
         std::unique_ptr<QueryGrammar> getDefaultQueryGrammar() const final;
@@ -54,6 +57,13 @@ namespace Orm
         return m_returnQDateTime.value_or(true);
     }
 
+    std::size_t SQLiteConnection::getMaxBindingsCount() const noexcept
+    {
+        /* The SQLITE_MAX_VARIABLE_NUMBER default value for the SQLite < 3.32.0,
+           the SQLite library can be older than the one bundled with Qt. */
+        return 999;
+    }
+
 } // namespace Orm
 
 TINYORM_END_COMMON_NAMESPACE
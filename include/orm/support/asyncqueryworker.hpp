@@ -0,0 +1,109 @@
+#pragma once
+#ifndef ORM_SUPPORT_ASYNCQUERYWORKER_HPP
+#define ORM_SUPPORT_ASYNCQUERYWORKER_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QFutureInterface>
+#include <QMutex>
+#include <QWaitCondition>
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <thread>
+
+#include "orm/macros/commonnamespace.hpp"
+#include "orm/macros/export.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+    class DatabaseConnection;
+
+namespace Support
+{
+
+    /*! Asynchronous query worker, executes queued tasks one by one in the dedicated
+        worker thread. The QSqlDatabase is thread-affine so the worker thread owns its
+        own connection that is created lazily during the first task. */
+    class SHAREDLIB_EXPORT AsyncQueryWorker final
+    {
+        Q_DISABLE_COPY(AsyncQueryWorker)
+
+    public:
+        /*! Factory type, creates a new connection with the given QSqlDatabase
+            connection name. */
+        using FactoryType = std::function<
+                std::unique_ptr<DatabaseConnection>(const QString &qtConnectionName)>;
+        /*! Task type, invoked in the worker thread. */
+        using TaskType = std::function<void(AsyncQueryWorker &worker)>;
+
+        /*! Constructor. */
+        AsyncQueryWorker(QString qtConnectionName, FactoryType factory);
+        /*! Destructor, finishes all queued tasks and stops the worker thread. */
+        ~AsyncQueryWorker();
+
+        /*! Queue the task, tasks are executed in the FIFO order. */
+        void enqueue(TaskType &&task);
+        /*! Get the number of queued tasks (including the currently executed task). */
+        std::size_t pending() const;
+        /*! Wait until all queued tasks are finished. */
+        void waitForDone();
+
+        /*! Get the worker's connection, creates it if needed (worker thread only). */
+        DatabaseConnection &connection();
+        /*! Get the QSqlDatabase connection name of the worker's connection. */
+        inline const QString &getQtConnectionName() const noexcept;
+
+        /*! Report the currently handled exception to the given future (must be called
+            from the catch block). */
+        static void reportException(QFutureInterfaceBase &future);
+
+    private:
+        /*! Execute queued tasks (the worker thread). */
+        void run();
+        /*! Reconnect the worker's connection. */
+        void reconnect();
+        /*! Close and remove the worker's connection (the worker thread). */
+        void destroyConnection();
+
+        /*! QSqlDatabase connection name of the worker's connection. */
+        QString m_qtConnectionName;
+        /*! Factory that creates the worker's connection. */
+        FactoryType m_factory;
+        /*! Worker's connection, used by the worker thread only. */
+        std::unique_ptr<DatabaseConnection> m_connection = nullptr;
+
+        /*! Queued tasks. */
+        std::deque<TaskType> m_queue {};
+        /*! Determine whether the worker thread is executing a task. */
+        bool m_running = false;
+        /*! Determine whether the worker thread should stop. */
+        bool m_stop = false;
+
+        /*! Protects the queue. */
+        mutable QMutex m_mutex {};
+        /*! Signaled when a task was queued or the worker should stop. */
+        QWaitCondition m_ready {};
+        /*! Signaled when all queued tasks were finished. */
+        QWaitCondition m_drained {};
+        /*! The worker thread (must be the last data member). */
+        std::thread m_thread;
+    };
+
+    /* public */
+
+    const QString &AsyncQueryWorker::getQtConnectionName() const noexcept
+    {
+        return m_qtConnectionName;
+    }
+
+} // namespace Support
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_SUPPORT_ASYNCQUERYWORKER_HPP
@@ -0,0 +1,179 @@
+#pragma once
+#ifndef ORM_SUPPORT_COMPILEDSQLCACHE_HPP
+#define ORM_SUPPORT_COMPILEDSQLCACHE_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QString>
+
+#include <list>
+#include <unordered_map>
+
+#include "orm/macros/commonnamespace.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Support
+{
+
+    /*! LRU cache of compiled SQL queries keyed by the structural key of the query
+        builder (the query shape), used by the query grammar to avoid re-compiling
+        queries that differ only in binding values. */
+    class CompiledSqlCache
+    {
+        Q_DISABLE_COPY(CompiledSqlCache)
+
+    public:
+        /*! Cache hits and misses counter. */
+        struct Counter
+        {
+            /*! Number of queries obtained from the cache. */
+            qint64 hits = 0;
+            /*! Number of queries that had to be compiled. */
+            qint64 misses = 0;
+        };
+
+        /*! Constructor, the capacity 0 disables the cache. */
+        inline explicit CompiledSqlCache(std::size_t capacity = 0);
+        /*! Default destructor. */
+        inline ~CompiledSqlCache() = default;
+
+        /*! Find a compiled query for the given query shape, marks it as the most
+            recently used, returns nullptr if not cached. */
+        inline const QString *find(const QString &shape);
+        /*! Insert a compiled query into the cache, evicts the least recently used
+            query if the cache is full. */
+        inline void insert(const QString &shape, const QString &queryString);
+        /*! Remove all compiled queries (invalidate the cache). */
+        inline void clear();
+
+        /*! Get the maximum number of cached compiled queries. */
+        inline std::size_t capacity() const noexcept;
+        /*! Set the maximum number of cached compiled queries (shrinks the cache). */
+        inline void setCapacity(std::size_t capacity);
+        /*! Get the number of currently cached compiled queries. */
+        inline std::size_t size() const noexcept;
+        /*! Determine whether the cache is enabled (capacity > 0). */
+        inline bool isEnabled() const noexcept;
+
+        /*! Get the cache hits and misses counter. */
+        inline const Counter &counter() const noexcept;
+        /*! Reset the cache hits and misses counter. */
+        inline void resetCounter() noexcept;
+
+    private:
+        /*! Evict least recently used queries until the cache fits the given size. */
+        inline void evict(std::size_t size);
+
+        /*! Type used for the LRU list, the front is the most recently used query. */
+        using ItemsType = std::list<std::pair<QString, QString>>;
+
+        /*! Compiled queries in the LRU order. */
+        ItemsType m_items {};
+        /*! Map a query shape to the position in the LRU list. */
+        std::unordered_map<QString, ItemsType::iterator> m_index {};
+        /*! Maximum number of cached compiled queries. */
+        std::size_t m_capacity;
+        /*! Cache hits and misses counter. */
+        Counter m_counter {};
+    };
+
+    /* public */
+
+    CompiledSqlCache::CompiledSqlCache(const std::size_t capacity)
+        : m_capacity(capacity)
+    {
+        m_index.reserve(capacity);
+    }
+
+    const QString *CompiledSqlCache::find(const QString &shape)
+    {
+        const auto itIndex = m_index.find(shape);
+
+        if (itIndex == m_index.end()) {
+            ++m_counter.misses;
+
+            return nullptr;
+        }
+
+        ++m_counter.hits;
+
+        // Move to the front, the iterator stays valid
+        m_items.splice(m_items.begin(), m_items, itIndex->second);
+
+        return std::addressof(itIndex->second->second);
+    }
+
+    void CompiledSqlCache::insert(const QString &shape, const QString &queryString)
+    {
+        // Nothing to do, cache is disabled
+        if (m_capacity == 0)
+            return;
+
+        // Replace the already cached query (it should never happen)
+        if (const auto itIndex = m_index.find(shape); itIndex != m_index.end()) {
+            m_items.erase(itIndex->second);
+            m_index.erase(itIndex);
+        }
+
+        // Make room for a new query
+        evict(m_capacity - 1);
+
+        m_items.emplace_front(shape, queryString);
+        m_index.emplace(shape, m_items.begin());
+    }
+
+    void CompiledSqlCache::clear()
+    {
+        m_index.clear();
+        m_items.clear();
+    }
+
+    std::size_t CompiledSqlCache::capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+    void CompiledSqlCache::setCapacity(const std::size_t capacity)
+    {
+        m_capacity = capacity;
+
+        evict(m_capacity);
+    }
+
+    std::size_t CompiledSqlCache::size() const noexcept
+    {
+        return m_items.size();
+    }
+
+    bool CompiledSqlCache::isEnabled() const noexcept
+    {
+        return m_capacity > 0;
+    }
+
+    const CompiledSqlCache::Counter &CompiledSqlCache::counter() const noexcept
+    {
+        return m_counter;
+    }
+
+    void CompiledSqlCache::resetCounter() noexcept
+    {
+        m_counter = {};
+    }
+
+    /* private */
+
+    void CompiledSqlCache::evict(const std::size_t size)
+    {
+        while (m_items.size() > size) {
+            m_index.erase(m_items.back().first);
+            m_items.pop_back();
+        }
+    }
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_SUPPORT_COMPILEDSQLCACHE_HPP
@@ -0,0 +1,266 @@
+#pragma once
+#ifndef ORM_SUPPORT_CONNECTIONPOOL_HPP
+#define ORM_SUPPORT_CONNECTIONPOOL_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QWaitCondition>
+
+#include <functional>
+#include <memory>
+
+#include "orm/macros/commonnamespace.hpp"
+#include "orm/macros/export.hpp"
+#include "orm/types/connectionpoolconfig.hpp"
+#include "orm/types/connectionpoolstats.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+    class DatabaseConnection;
+
+namespace Support
+{
+
+    /*! Bounded pool of database connections shared by all threads, used instead of
+        the thread-local connections if the pool_max_size configuration option is
+        defined.
+        A QSqlDatabase can only be used from the thread that created it, so an idle
+        connection is preferably reused by the same thread and an idle connection
+        that was opened in another thread is retired and replaced by a new connection
+        in the borrowing thread after the thread that opened it closes it (at its next
+        checkout/checkin or when it finishes), retired connections count against
+        the pool_max_size.
+        Every checked out connection keeps the pool alive, so the pool removed from
+        the DatabaseManager is destroyed after all its connections are returned. */
+    class SHAREDLIB_EXPORT ConnectionPool final :
+            public std::enable_shared_from_this<ConnectionPool>
+    {
+        Q_DISABLE_COPY(ConnectionPool)
+
+    public:
+        /*! Connection factory type, creates a new connection instance that uses
+            the given Qt connection name. */
+        using FactoryType = std::function<
+                std::unique_ptr<DatabaseConnection>(const QString &qtConnectionName)>;
+
+        /*! Constructor. */
+        ConnectionPool(QString name, const ConnectionPoolConfig &config,
+                       FactoryType &&factory);
+        /*! Destructor, closes all connections in the threads that opened them. */
+        ~ConnectionPool();
+
+        /*! Open the pool_min_size connections in the current thread. */
+        void openMinConnections();
+
+        /*! Borrow a connection from the pool, waits if the pool is saturated and
+            throws if no connection is returned in the pool_wait_timeout. */
+        DatabaseConnection &checkout();
+        /*! Return the borrowed connection to the pool, an active transaction is
+            rolled back. */
+        void checkin(DatabaseConnection &connection);
+
+        /*! Get the last connection checked out by the current thread (nullptr if
+            the current thread doesn't hold any connection). */
+        DatabaseConnection *current() const;
+        /*! Get the last connection checked out by the current thread, throws if
+            the current thread doesn't hold any connection. */
+        DatabaseConnection &currentOrFail() const;
+
+        /*! Close idle connections above the pool_min_size that exceeded
+            the pool_idle_timeout, returns the number of closed connections. */
+        std::size_t removeExpiredConnections();
+
+        /*! Get the pool metrics. */
+        ConnectionPoolStats stats() const;
+        /*! Reset the pool metrics (counters and wait times). */
+        void resetStats();
+
+        /*! Get the connection name. */
+        inline const QString &name() const noexcept;
+        /*! Get the pool configuration. */
+        inline const ConnectionPoolConfig &config() const noexcept;
+
+    private:
+        /*! Connection managed by the pool. */
+        struct PoolItem
+        {
+            /*! The connection instance. */
+            std::unique_ptr<DatabaseConnection> connection;
+            /*! Unique Qt connection name used by the QSqlDatabase. */
+            QString qtConnectionName;
+            /*! ID of the thread in which the connection was opened (the last
+                borrowing thread). */
+            quint64 threadId = 0;
+            /*! Time since the connection was returned to the pool. */
+            QElapsedTimer idleTimer {};
+            /*! Determine whether the connection is checked out. */
+            bool inUse = false;
+        };
+
+        /*! Type used to store the pool items. */
+        using PoolItemsType = std::vector<std::unique_ptr<PoolItem>>;
+
+        /*! Obtain an idle or new pool item for the given thread (nullptr if the pool
+            is saturated), expects the locked mutex. */
+        PoolItem *acquireItem(quint64 threadId);
+        /*! Create a new pool item, expects the locked mutex. */
+        PoolItem &createItem();
+        /*! Create a new connection for the given pool item, expects the locked
+            mutex. */
+        void makeConnection(PoolItem &item);
+        /*! Close the given pool item (in the thread that opened it) and remove it
+            from the pool, expects the locked mutex. */
+        void destroyItem(PoolItemsType::const_iterator itItem);
+        /*! Called when the retired connection was closed by the thread that opened
+            it, a waiting thread can create a new connection. */
+        void retiredConnectionClosed();
+        /*! Find the pool item for the given connection, expects the locked mutex. */
+        PoolItemsType::iterator findItem(const DatabaseConnection &connection);
+
+        /*! Close expired idle connections, expects the locked mutex. */
+        std::size_t removeExpiredItems();
+        /*! Validate the borrowed connection using the pingDatabase(). */
+        bool validateConnection(DatabaseConnection &connection) const;
+
+        /*! Reconnect the given pooled connection (used as the reconnector). */
+        void reconnect(const DatabaseConnection &connection);
+        /*! Set a fresh QSqlDatabase resolver on the given connection. */
+        void refreshQtConnection(DatabaseConnection &connection,
+                                 const QString &qtConnectionName) const;
+
+        /*! Throw if waiting for a connection timed out. */
+        [[noreturn]] void throwWaitTimeout() const;
+
+        /*! The connection name. */
+        QString m_name;
+        /*! The pool configuration. */
+        ConnectionPoolConfig m_config;
+        /*! The connection factory. */
+        FactoryType m_factory;
+
+        /*! Connections managed by the pool. */
+        PoolItemsType m_items {};
+        /*! Number of checked out connections. */
+        std::size_t m_inUse = 0;
+        /*! Number of retired connections that weren't closed yet by the threads
+            that opened them. */
+        std::size_t m_retired = 0;
+        /*! Last used Qt connection name suffix. */
+        quint64 m_lastId = 0;
+        /*! The pool metrics. */
+        ConnectionPoolStats m_stats {};
+
+        /*! Protects the pool items and metrics. */
+        mutable QMutex m_mutex {};
+        /*! Signaled when a connection is returned to the pool or a retired
+            connection is closed. */
+        QWaitCondition m_available {};
+    };
+
+    /*! Connection borrowed from the connection pool, returns the connection to
+        the pool when destroyed. */
+    class PooledConnection
+    {
+        Q_DISABLE_COPY(PooledConnection)
+
+    public:
+        /*! Constructor. */
+        inline PooledConnection(std::shared_ptr<ConnectionPool> pool,
+                                DatabaseConnection &connection) noexcept;
+        /*! Destructor, returns the connection to the pool. */
+        inline ~PooledConnection();
+
+        /*! Move constructor. */
+        inline PooledConnection(PooledConnection &&other) noexcept;
+        /*! Deleted move assignment operator. */
+        PooledConnection &operator=(PooledConnection &&) = delete;
+
+        /*! Get the borrowed connection. */
+        inline DatabaseConnection &operator*() const noexcept;
+        /*! Get the borrowed connection. */
+        inline DatabaseConnection *operator->() const noexcept;
+        /*! Get the borrowed connection. */
+        inline DatabaseConnection &get() const noexcept;
+
+        /*! Return the connection to the pool before the destruction. */
+        inline void release();
+
+    private:
+        /*! The connection pool. */
+        std::shared_ptr<ConnectionPool> m_pool;
+        /*! The borrowed connection (nullptr if already returned). */
+        DatabaseConnection *m_connection;
+    };
+
+    /* ConnectionPool */
+
+    /* public */
+
+    const QString &ConnectionPool::name() const noexcept
+    {
+        return m_name;
+    }
+
+    const ConnectionPoolConfig &ConnectionPool::config() const noexcept
+    {
+        return m_config;
+    }
+
+    /* PooledConnection */
+
+    /* public */
+
+    PooledConnection::PooledConnection(std::shared_ptr<ConnectionPool> pool,
+                                       DatabaseConnection &connection) noexcept
+        : m_pool(std::move(pool))
+        , m_connection(std::addressof(connection))
+    {}
+
+    PooledConnection::~PooledConnection()
+    {
+        release();
+    }
+
+    PooledConnection::PooledConnection(PooledConnection &&other) noexcept
+        : m_pool(std::move(other.m_pool))
+        , m_connection(std::exchange(other.m_connection, nullptr))
+    {}
+
+    DatabaseConnection &PooledConnection::operator*() const noexcept
+    {
+        return *m_connection;
+    }
+
+    DatabaseConnection *PooledConnection::operator->() const noexcept
+    {
+        return m_connection;
+    }
+
+    DatabaseConnection &PooledConnection::get() const noexcept
+    {
+        return *m_connection;
+    }
+
+    void PooledConnection::release()
+    {
+        if (m_connection == nullptr)
+            return;
+
+        m_pool->checkin(*std::exchange(m_connection, nullptr));
+    }
+
+} // namespace Support
+
+    /*! Alias for the Support::PooledConnection. */
+    using PooledConnection = Support::PooledConnection;
+
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_SUPPORT_CONNECTIONPOOL_HPP
@@ -0,0 +1,170 @@
+#pragma once
+#ifndef ORM_SUPPORT_PREPAREDSTATEMENTSCACHE_HPP
+#define ORM_SUPPORT_PREPAREDSTATEMENTSCACHE_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QtSql/QSqlQuery>
+
+#include <list>
+#include <optional>
+#include <unordered_map>
+
+#include "orm/macros/commonnamespace.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Support
+{
+
+    /*! LRU cache of prepared QSqlQuery-s keyed by the SQL query string, used by
+        the DatabaseConnection to avoid re-preparing the same queries.
+        Cached queries are never shared, the query is checked out (moved out of
+        the cache) while its result set is alive and it's checked in again after
+        the result set is consumed. The cache isn't thread-safe, it must be used
+        from the thread of its database connection only (as the QSqlQuery). */
+    class PreparedStatementsCache
+    {
+        Q_DISABLE_COPY(PreparedStatementsCache)
+
+    public:
+        /*! Constructor, the capacity 0 disables the cache. */
+        inline explicit PreparedStatementsCache(std::size_t capacity = 0);
+        /*! Default destructor. */
+        inline ~PreparedStatementsCache() = default;
+
+        /*! Check out the prepared query for the given query string (it's removed
+            from the cache), returns std::nullopt if not cached. */
+        inline std::optional<QSqlQuery> take(const QString &queryString);
+        /*! Check in the prepared query (its result set is released), evicts the least
+            recently used query if the cache is full. */
+        inline void insert(const QString &queryString, QSqlQuery &&query);
+        /*! Remove the prepared query for the given query string. */
+        inline void remove(const QString &queryString);
+        /*! Remove all prepared queries (invalidate the cache). */
+        inline void clear();
+
+        /*! Get the maximum number of cached prepared queries. */
+        inline std::size_t capacity() const noexcept;
+        /*! Set the maximum number of cached prepared queries (shrinks the cache). */
+        inline void setCapacity(std::size_t capacity);
+        /*! Get the number of currently cached prepared queries. */
+        inline std::size_t size() const noexcept;
+        /*! Determine whether the cache is enabled (capacity > 0). */
+        inline bool isEnabled() const noexcept;
+
+    private:
+        /*! Evict least recently used queries until the cache fits the given size. */
+        inline void evict(std::size_t size);
+
+        /*! Type used for the LRU list, the front is the most recently used query. */
+        using ItemsType = std::list<std::pair<QString, QSqlQuery>>;
+
+        /*! Cached prepared queries in the LRU order. */
+        ItemsType m_items {};
+        /*! Map a query string to the position in the LRU list. */
+        std::unordered_map<QString, ItemsType::iterator> m_index {};
+        /*! Maximum number of cached prepared queries. */
+        std::size_t m_capacity;
+    };
+
+    /* public */
+
+    PreparedStatementsCache::PreparedStatementsCache(const std::size_t capacity)
+        : m_capacity(capacity)
+    {
+        m_index.reserve(capacity);
+    }
+
+    std::optional<QSqlQuery> PreparedStatementsCache::take(const QString &queryString)
+    {
+        const auto itIndex = m_index.find(queryString);
+
+        if (itIndex == m_index.end())
+            return std::nullopt;
+
+        // The cache doesn't hold any reference to the checked out query
+        std::optional<QSqlQuery> query(std::move(itIndex->second->second));
+
+        m_items.erase(itIndex->second);
+        m_index.erase(itIndex);
+
+        return query;
+    }
+
+    void PreparedStatementsCache::insert(const QString &queryString,
+                                         QSqlQuery &&query)
+    {
+        // Nothing to do, cache is disabled
+        if (m_capacity == 0)
+            return;
+
+        // Release the result set, the next exec() re-uses the prepared statement only
+        query.finish();
+
+        /* Replace the already cached query, the same query can be checked out twice
+           (the second one was prepared again). */
+        remove(queryString);
+
+        // Make room for a new query
+        evict(m_capacity - 1);
+
+        m_items.emplace_front(queryString, std::move(query));
+        m_index.emplace(queryString, m_items.begin());
+    }
+
+    void PreparedStatementsCache::remove(const QString &queryString)
+    {
+        const auto itIndex = m_index.find(queryString);
+
+        if (itIndex == m_index.end())
+            return;
+
+        m_items.erase(itIndex->second);
+        m_index.erase(itIndex);
+    }
+
+    void PreparedStatementsCache::clear()
+    {
+        m_index.clear();
+        m_items.clear();
+    }
+
+    std::size_t PreparedStatementsCache::capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+    void PreparedStatementsCache::setCapacity(const std::size_t capacity)
+    {
+        m_capacity = capacity;
+
+        evict(m_capacity);
+    }
+
+    std::size_t PreparedStatementsCache::size() const noexcept
+    {
+        return m_items.size();
+    }
+
+    bool PreparedStatementsCache::isEnabled() const noexcept
+    {
+        return m_capacity > 0;
+    }
+
+    /* private */
+
+    void PreparedStatementsCache::evict(const std::size_t size)
+    {
+        while (m_items.size() > size) {
+            m_index.erase(m_items.back().first);
+            m_items.pop_back();
+        }
+    }
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_SUPPORT_PREPAREDSTATEMENTSCACHE_HPP
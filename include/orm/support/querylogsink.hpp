@@ -0,0 +1,123 @@
+#pragma once
+#ifndef ORM_SUPPORT_QUERYLOGSINK_HPP
+#define ORM_SUPPORT_QUERYLOGSINK_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QMutex>
+#include <QWaitCondition>
+
+#include <chrono>
+#include <functional>
+#include <thread>
+
+#include "orm/macros/commonnamespace.hpp"
+#include "orm/macros/export.hpp"
+#include "orm/types/log.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Support
+{
+
+    /*! Query log sink, drains query log records in batches to a file or callback
+        in the background thread, so the query thread never waits for the I/O
+        and the records are formatted lazily in the background thread.
+        The sink can be shared by more connections (also from different threads). */
+    class SHAREDLIB_EXPORT QueryLogSink final
+    {
+        Q_DISABLE_COPY(QueryLogSink)
+
+    public:
+        /*! Query log record pushed to the sink. */
+        struct Record
+        {
+            /*! Connection name. */
+            QString connection;
+            /*! Query log record. */
+            Log log;
+        };
+
+        /*! Callback type, invoked from the sink thread with a batch of records. */
+        using CallbackType = std::function<void(const QVector<Record> &records)>;
+
+        /*! Default number of records in a batch. */
+        constexpr static std::size_t DefaultBatchSize = 64;
+        /*! Default maximum number of queued records, new records are dropped when
+            the queue is full. */
+        constexpr static std::size_t DefaultMaxQueueSize = 10000;
+        /*! Default interval after which a partial batch is drained. */
+        constexpr static std::chrono::milliseconds DefaultFlushInterval {1000};
+
+        /*! Constructor, appends formatted records to the given file. */
+        explicit QueryLogSink(const QString &filepath,
+                              std::size_t batchSize = DefaultBatchSize,
+                              std::size_t maxQueueSize = DefaultMaxQueueSize,
+                              std::chrono::milliseconds flushInterval =
+                                      DefaultFlushInterval);
+        /*! Constructor, passes batches of records to the given callback. */
+        explicit QueryLogSink(CallbackType &&callback,
+                              std::size_t batchSize = DefaultBatchSize,
+                              std::size_t maxQueueSize = DefaultMaxQueueSize,
+                              std::chrono::milliseconds flushInterval =
+                                      DefaultFlushInterval);
+        /*! Destructor, drains all queued records and stops the sink thread. */
+        ~QueryLogSink();
+
+        /*! Push the query log record to the sink, never blocks on the I/O, the record
+            is dropped if the queue is full. */
+        void push(const QString &connection, const Log &log);
+        /*! Wait until all queued records are drained. */
+        void flush();
+
+        /*! Get the number of drained records. */
+        qint64 written() const;
+        /*! Get the number of dropped records (the queue was full or the callback
+            has thrown). */
+        qint64 dropped() const;
+
+        /*! Format the given record (replaces bindings in the SQL query). */
+        static QString format(const Record &record);
+
+    private:
+        /*! Drain queued records in batches (the sink thread). */
+        void run();
+
+        /*! Callback invoked for every batch of records. */
+        CallbackType m_callback;
+        /*! Number of records in a batch. */
+        std::size_t m_batchSize;
+        /*! Maximum number of queued records. */
+        std::size_t m_maxQueueSize;
+        /*! Interval after which a partial batch is drained. */
+        std::chrono::milliseconds m_flushInterval;
+
+        /*! Queued records. */
+        QVector<Record> m_queue {};
+        /*! Determine whether the sink thread is writing a batch. */
+        bool m_writing = false;
+        /*! Determine whether the queue has to be drained right away. */
+        bool m_flushRequested = false;
+        /*! Determine whether the sink thread should stop. */
+        bool m_stop = false;
+        /*! Number of drained records. */
+        qint64 m_written = 0;
+        /*! Number of dropped records. */
+        qint64 m_dropped = 0;
+
+        /*! Protects the queue and counters. */
+        mutable QMutex m_mutex {};
+        /*! Signaled when a batch is ready or the sink should stop. */
+        QWaitCondition m_ready {};
+        /*! Signaled when the queue was drained. */
+        QWaitCondition m_drained {};
+        /*! The sink thread (must be the last data member). */
+        std::thread m_thread;
+    };
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_SUPPORT_QUERYLOGSINK_HPP
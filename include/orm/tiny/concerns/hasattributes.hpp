@@ -12,6 +12,7 @@ TINY_SYSTEM_HEADER
 #endif
 
 #include <cmath>
+#include <vector>
 
 #include "orm/exceptions/invalidargumenterror.hpp"
 #include "orm/exceptions/invalidformaterror.hpp"
@@ -19,6 +20,9 @@ TINY_SYSTEM_HEADER
 #include "orm/macros/threadlocal.hpp"
 #include "orm/ormtypes.hpp"
 #include "orm/tiny/macros/crtpmodelwithbase.hpp"
+#include "orm/tiny/types/attributeshash.hpp"
+#include "orm/tiny/types/hydratedcasts.hpp"
+#include "orm/tiny/types/modelcasts.hpp"
 #include "orm/tiny/utils/attribute.hpp"
 #include "orm/utils/configuration.hpp"
 #include "orm/utils/helpers.hpp"
@@ -37,6 +41,12 @@ namespace Orm::Tiny::Concerns
     {
         /*! Alias for the attribute utils. */
         using AttributeUtils = Orm::Tiny::Utils::Attribute;
+        /*! Alias for the attributes hash. */
+        using AttributesHash = Orm::Tiny::Types::AttributesHash;
+        /*! Alias for the model instance casts. */
+        using ModelCasts = Orm::Tiny::Types::ModelCasts;
+        /*! Alias for the casts resolved to attribute positions. */
+        using HydratedCasts = Orm::Tiny::Types::HydratedCasts;
         /*! Alias for the configuration utils. */
         using ConfigUtils = Orm::Utils::Configuration;
         /*! Alias for the helper utils. */
@@ -50,7 +60,7 @@ namespace Orm::Tiny::Concerns
 
     public:
         /*! Equality comparison operator for the HasAttributes concern. */
-        inline bool operator==(const HasAttributes &) const = default;
+        bool operator==(const HasAttributes &right) const;
 
         /*! Set a given attribute on the model. */
         Derived &setAttribute(const QString &key, QVariant value);
@@ -60,6 +70,17 @@ namespace Orm::Tiny::Concerns
         /*! Set a vector of model attributes. No checking is done. */
         Derived &setRawAttributes(QVector<AttributeItem> &&attributes,
                                   bool sync = false);
+        /*! Set a vector of model attributes with the prebuilt attributes hash, keys
+            must be unique and match the hash, the hash is shared (no copy is made),
+            the casts resolved by the resolveHydratedCasts() are shared too. */
+        Derived &setRawAttributes(
+                QVector<AttributeItem> &&attributes, const AttributesHash &attributesHash,
+                bool sync = false,
+                std::shared_ptr<const HydratedCasts> hydratedCasts = nullptr);
+        /*! Resolve the casts of the given attributes to their positions (once for
+            the whole hydrated result set). */
+        std::shared_ptr<const HydratedCasts>
+        resolveHydratedCasts(const AttributesHash &attributesHash) const;
         /*! Sync the original attributes with the current. */
         Derived &syncOriginal();
 
@@ -226,6 +247,10 @@ namespace Orm::Tiny::Concerns
     protected:
         /*! Transform a raw model value using mutators, casts, etc. */
         QVariant transformModelValue(const QString &key, const QVariant &value) const;
+        /*! Transform a raw model value using mutators, casts, etc. (the cast is
+            already known, nullptr if the attribute has no cast). */
+        QVariant transformModelValue(const QString &key, const QVariant &value,
+                                     const CastItem *castItem) const;
         /*! Get the model's original attribute values. */
         QVariant getOriginalWithoutRewindingModel(
                 const QString &key, const QVariant &defaultValue = {}) const;
@@ -276,16 +301,26 @@ namespace Orm::Tiny::Concerns
         /*! Rehash attribute positions from the given index. */
         void rehashAttributePositions(
                 const QVector<AttributeItem> &attributes,
-                std::unordered_map<QString, int> &attributesHash,
-                int from = 0);
+                AttributesHash &attributesHash, int from = 0);
 
         /* Casting Attributes */
         /*! Cast an attribute, convert a QVariant value. */
         QVariant castAttribute(const QString &key, const QVariant &value) const;
+        /*! Cast an attribute using the given cast, convert a QVariant value. */
+        QVariant castAttribute(const QString &key, const QVariant &value,
+                               const CastItem &castItem) const;
         /*! Get the type of cast for a model attribute. */
         inline CastItem getCastItem(const QString &key) const;
         /*! Get the type of cast for a model attribute. */
         inline CastType getCastType(const QString &key) const;
+        /*! Find the cast for a model attribute (without copying the casts hash),
+            returns nullptr if the attribute has no cast. */
+        inline const CastItem *findCast(const QString &key) const;
+        /*! Find the cast for a model attribute at the given position, uses the casts
+            resolved during the hydration if the model wasn't modified. */
+        inline const CastItem *findCast(const QString &key, int position) const;
+        /*! Get the casts of this model instance (without the primary key cast). */
+        inline const std::unordered_map<QString, CastItem> &getInstanceCasts() const;
 
         /*! Determine whether a value is Date / DateTime castable. */
         inline bool isDateCastable(const QString &key) const;
@@ -312,11 +347,11 @@ namespace Orm::Tiny::Concerns
         /* Don't want to use std::reference_wrapper to attributes, because if a copy
            of the model is made, all references would be invalidated. */
         /*! The model's attributes hash (for fast lookup). */
-        std::unordered_map<QString, int> m_attributesHash;
+        AttributesHash m_attributesHash;
         /*! The model attribute's original state (for fast lookup). */
-        std::unordered_map<QString, int> m_originalHash;
+        AttributesHash m_originalHash;
         /*! The changed model attributes (for fast lookup). */
-        std::unordered_map<QString, int> m_changesHash;
+        AttributesHash m_changesHash;
 
         /*! The storage format of the model's date columns. */
         T_THREAD_LOCAL
@@ -326,15 +361,35 @@ namespace Orm::Tiny::Concerns
         inline static QStringList u_dates;
 
         /* Casting Attributes */
-        /*! The attributes that should be cast. */
-        std::unordered_map<QString, CastItem> u_casts;
+        /*! The attributes that should be cast (static, shared by all instances). */
+        inline static const std::unordered_map<QString, CastItem> u_casts {};
+        /*! The casts merged on this model instance (the u_casts is used if null). */
+        ModelCasts m_casts;
+        /*! Casts resolved to attribute positions during the hydration (shared by all
+            models hydrated from the same result set). */
+        std::shared_ptr<const HydratedCasts> m_hydratedCasts = nullptr;
 
         /*! Determine how the QDateTime time zone will be converted. */
         mutable std::optional<QtTimeZoneConfig> m_qtTimeZone = std::nullopt;
         /*! Determine whether the QDateTime time zone should be converted. */
         mutable std::optional<bool> m_isConvertingTimeZone = std::nullopt;
 
+        /*! Positions of attributes set after the last syncOriginal() (they can be
+            dirty), the getDirty() compares only these attributes with the original
+            state, empty if nothing was set (no allocation for hydrated models). */
+        std::vector<bool> m_dirtyPositions;
+
     private:
+        /* Dirty tracking */
+        /*! Mark the attribute at the given position as possibly dirty. */
+        inline void markDirtyPosition(int position);
+        /*! Mark all attributes as possibly dirty. */
+        inline void markAllDirtyPositions();
+        /*! Remove the given position from the dirty positions (unset attribute). */
+        inline void unmarkDirtyPosition(int position);
+        /*! Get the number of attributes that can be dirty (from the first position). */
+        inline int dirtyPositionsSize() const noexcept;
+
         /*! Throw if the m_attributesHash doesn't contain a given attribute. */
         static void throwIfNoAttributeInHash(
                     const std::unordered_map<QString, int> &attributesHash,
@@ -374,6 +429,23 @@ namespace Orm::Tiny::Concerns
 
     /* public */
 
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    bool HasAttributes<Derived, AllRelations...>::operator==(
+            const HasAttributes &right) const
+    {
+        /* The m_dirtyPositions isn't compared, it only narrows the attributes that
+           the getDirty() has to compare with the original state. */
+        return m_attributes           == right.m_attributes           &&
+               m_original             == right.m_original             &&
+               m_changes              == right.m_changes              &&
+               m_attributesHash       == right.m_attributesHash       &&
+               m_originalHash         == right.m_originalHash         &&
+               m_changesHash          == right.m_changesHash          &&
+               m_casts                == right.m_casts                &&
+               m_qtTimeZone           == right.m_qtTimeZone           &&
+               m_isConvertingTimeZone == right.m_isConvertingTimeZone;
+    }
+
     template<typename Derived, AllRelationsConcept ...AllRelations>
     Derived &
     HasAttributes<Derived, AllRelations...>::setAttribute(
@@ -392,15 +464,19 @@ namespace Orm::Tiny::Concerns
         // Found
         if (const auto attribute = m_attributesHash.find(key);
             attribute != m_attributesHash.end()
-        )
+        ) {
             m_attributes[attribute->second].value.swap(value);
 
+            markDirtyPosition(attribute->second);
+        }
         // Not Found
         else {
             auto position = m_attributes.size();
 
             m_attributes.append({key, value});
             m_attributesHash.emplace(key, position);
+
+            markDirtyPosition(static_cast<int>(position));
         }
 
         return model();
@@ -416,12 +492,16 @@ namespace Orm::Tiny::Concerns
 
         // Build attributes hash
         m_attributesHash.clear();
-        m_attributesHash.reserve(static_cast<std::size_t>(m_attributes.size()));
+        m_attributesHash.detach().reserve(static_cast<std::size_t>(m_attributes.size()));
 
         rehashAttributePositions(m_attributes, m_attributesHash);
+        // Release the casts resolved for the previous attributes
+        m_hydratedCasts.reset();
 
         if (sync)
             syncOriginal();
+        else
+            markAllDirtyPositions();
 
         return model();
     }
@@ -437,22 +517,66 @@ namespace Orm::Tiny::Concerns
 
         // Build attributes hash
         m_attributesHash.clear();
-        m_attributesHash.reserve(static_cast<std::size_t>(m_attributes.size()));
+        m_attributesHash.detach().reserve(static_cast<std::size_t>(m_attributes.size()));
 
         rehashAttributePositions(m_attributes, m_attributesHash);
+        // Release the casts resolved for the previous attributes
+        m_hydratedCasts.reset();
+
+        if (sync)
+            syncOriginal();
+        else
+            markAllDirtyPositions();
+
+        return model();
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    Derived &
+    HasAttributes<Derived, AllRelations...>::setRawAttributes(
+            QVector<AttributeItem> &&attributes, const AttributesHash &attributesHash,
+            const bool sync, std::shared_ptr<const HydratedCasts> hydratedCasts)
+    {
+        Q_ASSERT(static_cast<std::size_t>(attributes.size()) == attributesHash.size());
+
+        m_attributes = std::move(attributes);
+        m_attributesHash = attributesHash;
+        m_hydratedCasts = std::move(hydratedCasts);
 
         if (sync)
             syncOriginal();
+        else
+            markAllDirtyPositions();
 
         return model();
     }
 
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    std::shared_ptr<const Types::HydratedCasts>
+    HasAttributes<Derived, AllRelations...>::resolveHydratedCasts(
+            const AttributesHash &attributesHash) const
+    {
+        QVector<const CastItem *> castItems(
+                    static_cast<QVector<const CastItem *>::size_type>(
+                        attributesHash.size()),
+                    nullptr);
+
+        for (const auto &[key, position] : attributesHash.hash())
+            castItems[position] = findCast(key);
+
+        return std::make_shared<const HydratedCasts>(attributesHash, m_casts,
+                                                     std::move(castItems));
+    }
+
     template<typename Derived, AllRelationsConcept ...AllRelations>
     Derived &HasAttributes<Derived, AllRelations...>::syncOriginal()
     {
+        // Shared until the first write (implicitly shared QVector)
         m_original = getAttributes();
-
-        rehashAttributePositions(m_original, m_originalHash);
+        // Positions are the same, share the hash instead of rehashing
+        m_originalHash = m_attributesHash;
+        // Nothing is dirty, releases the memory
+        m_dirtyPositions = {};
 
         return model();
     }
@@ -475,7 +599,7 @@ namespace Orm::Tiny::Concerns
         // FEATURE castable silverqx
 //        mergeAttributesFromClassCasts();
 
-        return m_attributesHash;
+        return m_attributesHash.hash();
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -487,7 +611,19 @@ namespace Orm::Tiny::Concerns
 
         /* If the attribute exists in the attribute hash or has a cast we will
            get the attribute's value. Otherwise, we will return invalid QVariant. */
-        if (m_attributesHash.contains(key) || model().getUserCasts().contains(key))
+        if (const auto attribute = m_attributesHash.find(key);
+            attribute != m_attributesHash.end()
+        ) {
+            const auto &value = m_attributes.at(attribute->second).value;
+
+            // Nothing to transform, don't look up the cast
+            if (!value.isValid())
+                return value;
+
+            return transformModelValue(key, value, findCast(key, attribute->second));
+        }
+
+        if (getInstanceCasts().contains(key))
             return getAttributeValue(key);
 
         // FUTURE add getRelationValue() overload without Related template argument, after that I will be able to use it here, Related template parameter will be obtained by the visitor, I think this task is impossible to do silverqx
@@ -546,7 +682,7 @@ namespace Orm::Tiny::Concerns
     const std::unordered_map<QString, int> &
     HasAttributes<Derived, AllRelations...>::getOriginalsHash() const
     {
-        return m_originalHash;
+        return m_originalHash.hash();
     }
 
     // NOTE api different silverqx
@@ -585,6 +721,7 @@ namespace Orm::Tiny::Concerns
         // FUTURE all the operations on this containers should be synchronized, later, I think that this is not true because connection or model can be used only from a thread where it was created silverqx
         m_attributes.removeAt(position);
         m_attributesHash.erase(key);
+        unmarkDirtyPosition(position);
 
         // Rehash attributes, but only attributes which were shifted
         rehashAttributePositions(m_attributes, m_attributesHash, position);
@@ -604,6 +741,7 @@ namespace Orm::Tiny::Concerns
 
         m_attributes.removeAt(position);
         m_attributesHash.erase(key);
+        unmarkDirtyPosition(position);
 
         // Rehash attributes, but only attributes which were shifted
         rehashAttributePositions(m_attributes, m_attributesHash, position);
@@ -644,15 +782,18 @@ namespace Orm::Tiny::Concerns
     HasAttributes<Derived, AllRelations...>::getDirty() const
     {
         const auto &attributes = getAttributes();
+        const auto size = dirtyPositionsSize();
 
         QVector<AttributeItem> dirty;
-        dirty.reserve(attributes.size());
+        dirty.reserve(size);
 
-        for (const auto &attribute : attributes)
-            if (const auto &key = attribute.key;
-                !originalIsEquivalent(key)
+        // Only attributes that were set after the last sync can be dirty
+        for (int i = 0; i < size; ++i)
+            if (const auto &attribute = attributes.at(i);
+                m_dirtyPositions[static_cast<std::size_t>(i)] &&
+                !originalIsEquivalent(attribute.key)
             )
-                dirty.append({key, attribute.value});
+                dirty.append({attribute.key, attribute.value});
 
         return dirty;
     }
@@ -661,11 +802,13 @@ namespace Orm::Tiny::Concerns
     std::unordered_map<QString, int>
     HasAttributes<Derived, AllRelations...>::getDirtyHash() const
     {
-        const auto size = m_attributes.size();
+        const auto size = dirtyPositionsSize();
         std::unordered_map<QString, int> dirtyHash(static_cast<std::size_t>(size));
 
+        // Only attributes that were set after the last sync can be dirty
         for (auto i = 0; i < size; ++i)
             if (const auto &key = m_attributes.at(i).key;
+                m_dirtyPositions[static_cast<std::size_t>(i)] &&
                 !originalIsEquivalent(key)
             )
                 dirtyHash.try_emplace(m_attributes.at(i).key, i);
@@ -684,7 +827,16 @@ namespace Orm::Tiny::Concerns
     bool
     HasAttributes<Derived, AllRelations...>::isDirty(const QString &attribute) const
     {
-        return hasChanges(getDirtyHash(), QStringList {attribute});
+        const auto position = m_attributesHash.find(attribute);
+
+        // Not found
+        if (position == m_attributesHash.end())
+            return false;
+
+        const auto dirtyPosition = static_cast<std::size_t>(position->second);
+
+        return dirtyPosition < m_dirtyPositions.size() &&
+               m_dirtyPositions[dirtyPosition] && !originalIsEquivalent(attribute);
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -712,7 +864,7 @@ namespace Orm::Tiny::Concerns
     const std::unordered_map<QString, int> &
     HasAttributes<Derived, AllRelations...>::getChangesHash() const
     {
-        return m_changesHash;
+        return m_changesHash.hash();
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -950,9 +1102,9 @@ namespace Orm::Tiny::Concerns
         const auto &keyName = model.getKeyName();
 
         /* Needed to make a copy because it can interfere with the check
-           in the getAttribute() method (getUserCasts().contains(key)), so don't modify
-           the user's u_casts and add the 'id' cast on the fly on the casts copy. */
-        auto casts = model.getUserCasts();
+           in the getAttribute() method (getInstanceCasts().contains(key)), so don't
+           modify the model casts and add the 'id' cast on the fly on the casts copy. */
+        auto casts = getInstanceCasts();
 
         // try_emplace implies casts.contains()
         if (model.getIncrementing()/* && !casts.contains(keyName)*/)
@@ -965,7 +1117,7 @@ namespace Orm::Tiny::Concerns
     template<typename Derived, AllRelationsConcept ...AllRelations>
     bool HasAttributes<Derived, AllRelations...>::hasCast(const QString &key) const
     {
-        return getCasts().contains(key);
+        return findCast(key) != nullptr;
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -981,18 +1133,12 @@ namespace Orm::Tiny::Concerns
             const std::unordered_map<QString, CastItem> &casts)
     {
         auto &model = this->model();
-        auto &userCasts = model.getUserCasts();
-
-        std::remove_cvref_t<decltype (casts)> mergedCasts;
-        mergedCasts.reserve(userCasts.size() + casts.size());
+        auto &modelCasts = m_casts.detach(model.getUserCasts());
 
-        mergedCasts = userCasts;
+        modelCasts.reserve(modelCasts.size() + casts.size());
 
         for (const auto &[attribute, castItem] : casts)
-            mergedCasts.insert_or_assign(attribute, castItem);
-
-        // Swap user casts
-        userCasts = std::move(mergedCasts);
+            modelCasts.insert_or_assign(attribute, castItem);
 
         return model;
     }
@@ -1004,7 +1150,7 @@ namespace Orm::Tiny::Concerns
     {
         auto &model = this->model();
 
-        model.getUserCasts().merge(casts);
+        m_casts.detach(model.getUserCasts()).merge(casts);
 
         return model;
     }
@@ -1016,7 +1162,7 @@ namespace Orm::Tiny::Concerns
     {
         auto &model = this->model();
 
-        model.getUserCasts().merge(std::move(casts));
+        m_casts.detach(model.getUserCasts()).merge(std::move(casts));
 
         return model;
     }
@@ -1024,11 +1170,9 @@ namespace Orm::Tiny::Concerns
     template<typename Derived, AllRelationsConcept ...AllRelations>
     Derived &HasAttributes<Derived, AllRelations...>::resetCasts()
     {
-        auto &model = this->model();
+        m_casts.clear();
 
-        model.getUserCasts().clear();
-
-        return model;
+        return model();
     }
 
     /* QDateTime time zone */
@@ -1098,10 +1242,22 @@ namespace Orm::Tiny::Concerns
         if (!value.isValid())
             return value;
 
+        return transformModelValue(key, value, findCast(key));
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    QVariant HasAttributes<Derived, AllRelations...>::transformModelValue(
+            const QString &key, const QVariant &value,
+            const CastItem *const castItem) const
+    {
+        // Nothing to do, no transformation possible (the same as above)
+        if (!value.isValid())
+            return value;
+
         /* If the attribute exists within the u_casts hash, we will convert it to
            an appropriate QVariant type. */
-        if (hasCast(key))
-            return castAttribute(key, value);
+        if (castItem != nullptr)
+            return castAttribute(key, value, *castItem);
 
         /* If the attribute is listed as a date, we will convert it to the QDateTime
            or QDate instance on retrieval, which makes it quite convenient to work with
@@ -1403,16 +1559,17 @@ namespace Orm::Tiny::Concerns
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
     void HasAttributes<Derived, AllRelations...>::rehashAttributePositions(
-            const QVector<AttributeItem> &attributes,
-            std::unordered_map<QString, int> &attributesHash,
+            const QVector<AttributeItem> &attributes, AttributesHash &attributesHash,
             const int from)
     {
+        auto &hash = attributesHash.detach();
+
         /* This member function is universal and can be used for m_attributes,
            m_changes and m_original and it associated unordered_maps m_attributesHash,
            m_changesHash and m_originalHash. */
         for (auto i = from; i < attributes.size(); ++i)
             // 'i' is the position
-            attributesHash[attributes.at(i).key] = i;
+            hash[attributes.at(i).key] = i;
     }
 
     /* Casting Attributes */
@@ -1421,6 +1578,18 @@ namespace Orm::Tiny::Concerns
     QVariant
     HasAttributes<Derived, AllRelations...>::castAttribute(
             const QString &key, const QVariant &value) const
+    {
+        // Don't look up the cast if there is nothing to cast (see the overload below)
+        if (!value.isValid())
+            return value;
+
+        return castAttribute(key, value, getCastItem(key));
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    QVariant
+    HasAttributes<Derived, AllRelations...>::castAttribute(
+            const QString &key, const QVariant &value, const CastItem &castItem) const
     {
         /* Nothing to do, no cast possible, don't check for value.isNull()! (to support
            a null QVariant-s).
@@ -1430,7 +1599,6 @@ namespace Orm::Tiny::Concerns
             return value;
 
         auto value_ = value;
-        const auto &castItem = getCastItem(key);
         const auto castType = castItem.type();
 
         /*! Convert the QVariant value of a attribute. */
@@ -1544,14 +1712,60 @@ namespace Orm::Tiny::Concerns
     CastItem
     HasAttributes<Derived, AllRelations...>::getCastItem(const QString &key) const
     {
-        return getCasts().at(key);
+        if (const auto *const castItem = findCast(key); castItem != nullptr)
+            return *castItem;
+
+        throw Orm::Exceptions::InvalidArgumentError(
+                    QStringLiteral("The '%1' attribute has no cast in %2().")
+                    .arg(key, __tiny_func__));
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
     CastType
     HasAttributes<Derived, AllRelations...>::getCastType(const QString &key) const
     {
-        return getCasts().at(key).type();
+        return getCastItem(key).type();
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    const CastItem *
+    HasAttributes<Derived, AllRelations...>::findCast(const QString &key) const
+    {
+        // Model casts have priority, the same as in the getCasts()
+        const auto &casts = getInstanceCasts();
+
+        if (const auto castItem = casts.find(key); castItem != casts.end())
+            return std::addressof(castItem->second);
+
+        const auto &model = this->model();
+
+        // The primary key cast is added on the fly (see getCasts())
+        if (model.getIncrementing() && key == model.getKeyName()) {
+            static const CastItem KeyCast {CastType::ULongLong};
+
+            return std::addressof(KeyCast);
+        }
+
+        return nullptr;
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    const CastItem *
+    HasAttributes<Derived, AllRelations...>::findCast(const QString &key,
+                                                      const int position) const
+    {
+        // Resolved during the hydration and the model wasn't modified since
+        if (m_hydratedCasts && m_hydratedCasts->isValidFor(m_attributesHash, m_casts))
+            return m_hydratedCasts->at(position);
+
+        return findCast(key);
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    const std::unordered_map<QString, CastItem> &
+    HasAttributes<Derived, AllRelations...>::getInstanceCasts() const
+    {
+        return m_casts.hashOr(model().getUserCasts());
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -1591,6 +1805,45 @@ namespace Orm::Tiny::Concerns
 
     /* private */
 
+    /* Dirty tracking */
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    void HasAttributes<Derived, AllRelations...>::markDirtyPosition(const int position)
+    {
+        Q_ASSERT(position >= 0 && position < m_attributes.size());
+
+        if (const auto size = static_cast<std::size_t>(m_attributes.size());
+            m_dirtyPositions.size() < size
+        )
+            m_dirtyPositions.resize(size, false);
+
+        m_dirtyPositions[static_cast<std::size_t>(position)] = true;
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    void HasAttributes<Derived, AllRelations...>::markAllDirtyPositions()
+    {
+        m_dirtyPositions.assign(static_cast<std::size_t>(m_attributes.size()), true);
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    void HasAttributes<Derived, AllRelations...>::unmarkDirtyPosition(const int position)
+    {
+        // Nothing to do, the position was never marked
+        if (static_cast<std::size_t>(position) >= m_dirtyPositions.size())
+            return;
+
+        m_dirtyPositions.erase(m_dirtyPositions.begin() + position);
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    int HasAttributes<Derived, AllRelations...>::dirtyPositionsSize() const noexcept
+    {
+        // The m_dirtyPositions can be shorter than attributes, never longer
+        return std::min(static_cast<int>(m_dirtyPositions.size()),
+                        static_cast<int>(m_attributes.size()));
+    }
+
     template<typename Derived, AllRelationsConcept ...AllRelations>
     void HasAttributes<Derived, AllRelations...>::throwIfNoAttributeInHash(
             const std::unordered_map<QString, int> &attributesHash,
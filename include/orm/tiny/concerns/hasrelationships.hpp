@@ -240,8 +240,8 @@ namespace Concerns
                     const QHash<QString, RelationVisitor> &right) noexcept;
 
         /* Data members */
-        /*! Map of relation names to methods. */
-        QHash<QString, RelationVisitor> u_relations;
+        /*! Map of relation names to methods (static, shared by all instances). */
+        inline static const QHash<QString, RelationVisitor> u_relations {};
 
         /* The libstdc++ shipped with the GCC <12.1 doesn't allow an incomplete
            mapped_type (value) in the std::unordered_map. */
@@ -98,7 +98,7 @@ namespace Orm::Tiny::Concerns
 
             /*! Called from Model::u_relations to pass reference to the relation
                 method, an enter point of the visitation. */
-            template<RelationshipMethod<Derived> Method>
+            template<typename Method>
             requires std::is_member_function_pointer_v<Method>
             void operator()(Method method);
 
@@ -364,11 +364,17 @@ namespace Orm::Tiny::Concerns
     }
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
-    template<RelationshipMethod<Derived> Method>
+    template<typename Method>
     requires std::is_member_function_pointer_v<Method>
     void HasRelationStore<Derived, AllRelations...>::BaseRelationStore
                                                    ::operator()(const Method method)
     {
+        /* Checked here and not in the template head, the u_relations is a static data
+           member and its initializer is not a complete-class context, so the Derived
+           model is still an incomplete type when the visitor lambda is instantiated. */
+        static_assert(RelationshipMethod<Method, Derived>,
+                      "The u_relations must map to the relationship method.");
+
         const auto storeType = getStoreType();
 
         switch (storeType) {
@@ -238,6 +238,13 @@ namespace Orm::Tiny
         /*! Create a new model instance that is existing. */
         Derived newFromBuilder(QVector<AttributeItem> &&attributes = {},
                                const std::optional<QString> &connection = std::nullopt);
+        /*! Create a new model instance that is existing, attributes must be unique
+            and match the given attributes hash (used by the hydration). */
+        Derived newFromBuilder(
+                QVector<AttributeItem> &&attributes,
+                const Types::AttributesHash &attributesHash,
+                std::shared_ptr<const Types::HydratedCasts> hydratedCasts = nullptr,
+                const std::optional<QString> &connection = std::nullopt);
         /*! Create a new instance of the given model. */
         inline Derived newInstance();
         /*! Create a new instance of the given model. */
@@ -395,8 +402,6 @@ namespace Orm::Tiny
         /*! Get the u_dates attribute from the Derived model. */
         inline static const QStringList &getUserDates();
         /*! Get the casts hash. */
-        inline std::unordered_map<QString, CastItem> &getUserCasts();
-        /*! Get the casts hash. */
         inline const std::unordered_map<QString, CastItem> &getUserCasts() const;
 
         /* GuardsAttributes */
@@ -1168,6 +1173,24 @@ namespace Orm::Tiny
         return model;
     }
 
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    Derived
+    Model<Derived, AllRelations...>::newFromBuilder(
+            QVector<AttributeItem> &&attributes,
+            const Types::AttributesHash &attributesHash,
+            std::shared_ptr<const Types::HydratedCasts> hydratedCasts,
+            const std::optional<QString> &connection)
+    {
+        auto model = newInstance({}, true);
+
+        model.setRawAttributes(std::move(attributes), attributesHash, true,
+                               std::move(hydratedCasts));
+
+        model.setConnection(connection ? *connection : getConnectionName());
+
+        return model;
+    }
+
     template<typename Derived, AllRelationsConcept ...AllRelations>
     Derived
     Model<Derived, AllRelations...>::newInstance()
@@ -1190,7 +1213,8 @@ namespace Orm::Tiny
            the connection have to be set before fill(). */
         model.setConnection(getConnectionName());
 
-        model.mergeCasts(std::as_const(*this).getUserCasts());
+        // Share casts merged on this model (copy-on-write)
+        model.m_casts = this->m_casts;
         model.fill(attributes);
 
         // I want to have these two as the last thing
@@ -1215,7 +1239,8 @@ namespace Orm::Tiny
            the connection have to be set before fill(). */
         model.setConnection(getConnectionName());
 
-        model.mergeCasts(std::as_const(*this).getUserCasts());
+        // Share casts merged on this model (copy-on-write)
+        model.m_casts = this->m_casts;
         model.fill(std::move(attributes));
 
         // I want to have these two as the last thing
@@ -1707,13 +1732,6 @@ namespace Orm::Tiny
         return Derived::u_dates;
     }
 
-    template<typename Derived, AllRelationsConcept ...AllRelations>
-    std::unordered_map<QString, CastItem> &
-    Model<Derived, AllRelations...>::getUserCasts()
-    {
-        return model().u_casts;
-    }
-
     template<typename Derived, AllRelationsConcept ...AllRelations>
     const std::unordered_map<QString, CastItem> &
     Model<Derived, AllRelations...>::getUserCasts() const
@@ -51,6 +51,12 @@ namespace Tiny
         /*! Concatenate values of a given column as a string. */
         static QString implode(const QString &column, const QString &glue = "");
 
+        /*! Get the forward-only cursor of models (without eager loading). */
+        static Cursor<Derived> cursor(const QVector<Column> &columns = {ASTERISK});
+        /*! Get models in the connection's worker thread (without eager loading). */
+        static QFuture<QVector<Derived>>
+        getAsync(const QVector<Column> &columns = {ASTERISK});
+
         /*! Find a model by its primary key. */
         static std::optional<Derived>
         find(const QVariant &id, const QVector<Column> &columns = {ASTERISK});
@@ -1070,6 +1076,20 @@ namespace Tiny
         return query()->implode(column, glue);
     }
 
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    Cursor<Derived>
+    ModelProxies<Derived, AllRelations...>::cursor(const QVector<Column> &columns)
+    {
+        return query()->cursor(columns);
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    QFuture<QVector<Derived>>
+    ModelProxies<Derived, AllRelations...>::getAsync(const QVector<Column> &columns)
+    {
+        return query()->getAsync(columns);
+    }
+
     template<typename Derived, AllRelationsConcept ...AllRelations>
     std::optional<Derived>
     ModelProxies<Derived, AllRelations...>::find(const QVariant &id,
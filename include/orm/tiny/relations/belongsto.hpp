@@ -193,9 +193,8 @@ namespace Orm::Tiny::Relations
         /* We'll grab the primary key name of the related models since it could be set to
            a non-standard name and not "id". We will then construct the constraint for
            our eagerly loading query so it returns the proper models from execution. */
-        this->getBaseQuery().whereIn(
-                    DOT_IN.arg(this->m_related->getTable(), m_ownerKey),
-                    getEagerModelKeys(models));
+        this->whereInEager(DOT_IN.arg(this->m_related->getTable(), m_ownerKey),
+                           getEagerModelKeys(models));
     }
 
     template<class Model, class Related>
@@ -223,14 +222,16 @@ namespace Orm::Tiny::Relations
         /* Once we have the dictionary constructed, we can loop through all the parents
            and match back onto their children using these keys of the dictionary and
            the primary key of the children to map them onto the correct instances. */
+        typename Relation<Model, Related>::MatchingKeyPosition keyPosition;
+
         for (auto &model : models)
-            if (const auto foreign = model.getAttribute(m_foreignKey)
-                .template value<typename Model::KeyType>();
-                dictionary.contains(foreign)
+            if (const auto itRelated = dictionary.find(
+                    this->template getMatchingKey<typename Model::KeyType>(
+                        model, m_foreignKey, keyPosition));
+                itRelated != dictionary.end()
             )
-                model.setRelation(relation,
-                                  std::optional<Related>(
-                                      std::move(dictionary.find(foreign).value())));
+                // Copy, more models can belong to the same related model
+                model.setRelation(relation, std::optional<Related>(itRelated.value()));
     }
 
     template<class Model, class Related>
@@ -238,11 +239,14 @@ namespace Orm::Tiny::Relations
     BelongsTo<Model, Related>::buildDictionary(QVector<Related> &&results) const
     {
         QHash<typename Model::KeyType, Related> dictionary;
+        dictionary.reserve(results.size());
+
+        typename Relation<Model, Related>::MatchingKeyPosition keyPosition;
 
         /*! Build model dictionary keyed by the parent's primary key. */
         for (auto &&result : results)
-            dictionary.insert(result.getAttribute(m_ownerKey)
-                              .template value<typename Model::KeyType>(),
+            dictionary.insert(this->template getMatchingKey<typename Model::KeyType>(
+                                  result, m_ownerKey, keyPosition),
                               std::move(result));
 
         return dictionary;
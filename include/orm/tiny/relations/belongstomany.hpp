@@ -311,7 +311,8 @@ namespace Orm::Tiny::Relations
 
         /*! Build model dictionary keyed by the relation's foreign key. */
         QHash<typename Model::KeyType, QVector<Related>>
-        buildDictionary(QVector<Related> &&results) const;
+        buildDictionary(QVector<Related> &&results,
+                        typename QVector<Model>::size_type parentsSize) const;
 
         /*! Prepare the query builder for query execution. */
         Builder<Related> &prepareQueryBuilder() const;
@@ -423,8 +424,8 @@ namespace Orm::Tiny::Relations
     void BelongsToMany<Model, Related, PivotType>::addEagerConstraints(
             const QVector<Model> &models) const
     {
-        this->m_query->whereIn(getQualifiedForeignPivotKeyName(),
-                               this->getKeys(models, m_parentKey));
+        this->whereInEager(getQualifiedForeignPivotKeyName(),
+                           this->getKeys(models, m_parentKey));
     }
 
     template<class Model, class Related, class PivotType>
@@ -443,38 +444,45 @@ namespace Orm::Tiny::Relations
             QVector<Model> &models, QVector<Related> &&results,
             const QString &relation) const
     {
-        auto dictionary = buildDictionary(std::move(results));
+        auto dictionary = buildDictionary(std::move(results), models.size());
+
+        typename Relation<Model, Related>::MatchingKeyPosition keyPosition;
 
         /* Once we have the dictionary of child objects, we can easily match the
            children back to their parent using the dictionary and the keys on the
            the parent models. Then we will return the hydrated models back out. */
         for (auto &model : models)
-            if (const auto key = model.getAttribute(m_parentKey)
-                .template value<typename Model::KeyType>();
-                dictionary.contains(key)
+            if (const auto itRelated = dictionary.find(
+                    this->template getMatchingKey<typename Model::KeyType>(
+                        model, m_parentKey, keyPosition));
+                itRelated != dictionary.end()
             )
-                model.template setRelation<Related>(
-                            relation,
-                            std::move(dictionary.find(key).value()));
+                model.template setRelation<Related>(relation,
+                                                    std::move(itRelated.value()));
     }
 
     template<class Model, class Related, class PivotType>
     QHash<typename Model::KeyType, QVector<Related>>
     BelongsToMany<Model, Related, PivotType>::buildDictionary(
-            QVector<Related> &&results) const
+            QVector<Related> &&results,
+            const typename QVector<Model>::size_type parentsSize) const
     {
         /* First we will build a dictionary of child models keyed by the foreign key
            of the relation so that we will easily and quickly match them to their
            parents without having a possibly slow inner loops for every models. */
         QHash<typename Model::KeyType, QVector<Related>> dictionary;
+        // Every key matches some parent model
+        dictionary.reserve(std::min(results.size(), parentsSize));
+
+        typename Relation<Model, Related>::MatchingKeyPosition keyPosition;
 
         /*! Build model dictionary keyed by the parent's primary key. */
         for (auto &&result : results) {
 
             const auto foreignPivotKey =
-                    result.template getRelation<PivotType, Orm::One>(m_accessor)
-                    ->getAttribute(m_foreignPivotKey)
-                    .template value<typename Model::KeyType>();
+                    this->template getMatchingKey<typename Model::KeyType>(
+                        *result.template getRelation<PivotType, Orm::One>(m_accessor),
+                        m_foreignPivotKey, keyPosition);
 
             dictionary[foreignPivotKey] << std::move(result);
         }
@@ -823,7 +823,8 @@ namespace Concerns
         auto query = newPivotQuery()->get();
 
         QVector<PivotType> pivots;
-        pivots.reserve(QueryUtils::queryResultSize(query));
+        if (const auto sizeHint = QueryUtils::queryResultSizeHint(query); sizeHint > 0)
+            pivots.reserve(sizeHint);
 
         while (query.next())
             // std::move() is really needed here
@@ -100,7 +100,8 @@ namespace Orm::Tiny::Relations
         /*! Build model dictionary keyed by the relation's foreign key. */
         template<typename RelationType>
         QHash<typename Model::KeyType, RelationType>
-        buildDictionary(QVector<Related> &&results) const;
+        buildDictionary(QVector<Related> &&results,
+                        typename QVector<Model>::size_type parentsSize) const;
 
         /* Getters / Setters */
         /*! Get the plain foreign key. */
@@ -165,8 +166,7 @@ namespace Orm::Tiny::Relations
     void
     HasOneOrMany<Model, Related>::addEagerConstraints(const QVector<Model> &models) const
     {
-        this->getBaseQuery().whereIn(m_foreignKey,
-                                     this->getKeys(models, m_localKey));
+        this->whereInEager(m_foreignKey, this->getKeys(models, m_localKey));
     }
 
     /* Getters / Setters */
@@ -356,32 +356,42 @@ namespace Orm::Tiny::Relations
             QVector<Model> &models, QVector<Related> &&results,
             const QString &relation) const
     {
-        auto dictionary = buildDictionary<RelationType>(std::move(results));
+        auto dictionary = buildDictionary<RelationType>(std::move(results),
+                                                        models.size());
+
+        typename Relation<Model, Related>::MatchingKeyPosition keyPosition;
 
         /* Once we have the dictionary we can simply spin through the parent models to
            link them up with their children using the keyed dictionary to make the
            matching very convenient and easy work. Then we'll just return them. */
-        for (auto &model : models) {
-            if (const auto key = model.getAttribute(m_localKey)
-                                 .template value<typename Model::KeyType>();
-                dictionary.contains(key)
+        for (auto &model : models)
+            if (const auto itRelated = dictionary.find(
+                    this->template getMatchingKey<typename Model::KeyType>(
+                        model, m_localKey, keyPosition));
+                itRelated != dictionary.end()
             )
-                model.setRelation(relation,
-                                  std::move(dictionary.find(key).value()));
-        }
+                model.setRelation(relation, std::move(itRelated.value()));
     }
 
     template<class Model, class Related>
     template<typename RelationType>
     QHash<typename Model::KeyType, RelationType>
-    HasOneOrMany<Model, Related>::buildDictionary(QVector<Related> &&results) const
+    HasOneOrMany<Model, Related>::buildDictionary(
+            QVector<Related> &&results,
+            const typename QVector<Model>::size_type parentsSize) const
     {
         QHash<typename Model::KeyType, RelationType> dictionary;
+        // Every key matches some parent model
+        dictionary.reserve(std::min(results.size(), parentsSize));
+
+        const auto foreignKey = getForeignKeyName();
+        typename Relation<Model, Related>::MatchingKeyPosition keyPosition;
 
         for (auto &&result : results)
             if constexpr (
-                const auto foreign = result.getAttribute(getForeignKeyName())
-                                     .template value<typename Model::KeyType>();
+                const auto foreign =
+                    this->template getMatchingKey<typename Model::KeyType>(
+                        result, foreignKey, keyPosition);
                 std::is_same_v<RelationType, QVector<Related>>
             )
                 dictionary[foreign] << std::move(result);
@@ -5,9 +5,14 @@
 #include "orm/macros/systemheader.hpp"
 TINY_SYSTEM_HEADER
 
+#include <algorithm>
+#include <optional>
+#include <unordered_map>
+
 #include <range/v3/action/sort.hpp>
 #include <range/v3/action/unique.hpp>
 
+#include "orm/exceptions/logicerror.hpp"
 #include "orm/exceptions/runtimeerror.hpp"
 #include "orm/macros/threadlocal.hpp"
 #include "orm/tiny/relations/relationproxies.hpp"
@@ -84,8 +89,9 @@ namespace Relations
         virtual std::variant<QVector<Related>, std::optional<Related>>
         getResults() const = 0;
 
-        /*! Get the relationship for eager loading. */
-        inline QVector<Related> getEager() const;
+        /*! Get the relationship for eager loading, splits the eager keys into
+            chunks if they exceed the bindings limit. */
+        QVector<Related> getEager() const;
         /*! Execute the query as a "select" statement. */
         inline virtual QVector<Related>
         get(const QVector<Column> &columns = {ASTERISK}) const;
@@ -135,6 +141,30 @@ namespace Relations
         /*! Get all of the primary keys for the vector of models. */
         QVector<QVariant>
         getKeys(const QVector<Model> &models, const QString &key = "") const;
+        /*! Add the "where in" constraint for the eager load keys. */
+        void whereInEager(const QString &column, QVector<QVariant> &&keys) const;
+        /*! Get the number of eager load keys in a single query. */
+        QVector<QVariant>::size_type eagerKeysChunkSize() const;
+        /*! Determine whether the eager load keys can be split into chunks without
+            changing the results of the eager load query. */
+        bool eagerKeysSplittable() const;
+        /*! Throw if the eager load query with all the keys exceeds the bindings
+            limit of the connection. */
+        void throwIfEagerKeysExceedLimit() const;
+
+        /*! Position of the key attribute resolved for the given attributes hash. */
+        struct MatchingKeyPosition
+        {
+            /*! Attributes hash for which the position was resolved. */
+            const std::unordered_map<QString, int> *attributesHash = nullptr;
+            /*! Position of the key attribute (-1 if the attribute doesn't exist). */
+            int position = -1;
+        };
+        /*! Get the key value used to match eagerly loaded models, the key position is
+            resolved only once for all models that share the attributes hash. */
+        template<typename KeyType, typename M>
+        static KeyType getMatchingKey(const M &model, const QString &key,
+                                      MatchingKeyPosition &keyPosition);
 
         /* Querying Relationship Existence/Absence */
         /*! Add the constraints for an internal relationship existence query.
@@ -166,6 +196,23 @@ namespace Relations
         /*! Indicates if the relation is adding constraints. */
         T_THREAD_LOCAL
         inline static bool constraints = true;
+
+        /*! Maximum number of eager load keys in a single query (limits the query
+            string size). */
+        constexpr static QVector<QVariant>::size_type MaxEagerKeysChunkSize = 10000;
+
+        /*! The "where in" constraint for the eager load keys. */
+        struct EagerKeysWhere
+        {
+            /*! Index of the "where in" clause. */
+            QVector<QVariant>::size_type whereIndex;
+            /*! Offset of the keys in the where bindings. */
+            QVector<QVariant>::size_type bindingsOffset;
+            /*! All the eager load keys. */
+            QVector<QVariant> keys;
+        };
+        /*! The "where in" constraint for the eager load keys (set during eager load). */
+        mutable std::optional<EagerKeysWhere> m_eagerKeysWhere = std::nullopt;
     };
 
     /* protected */
@@ -204,7 +251,47 @@ namespace Relations
     QVector<Related>
     Relation<Model, Related>::getEager() const
     {
-        return get();
+        // Nothing to split, the eager load keys were not added by the whereInEager()
+        if (!m_eagerKeysWhere)
+            return get();
+
+        const auto &[whereIndex, bindingsOffset, keys] = *m_eagerKeysWhere;
+        const auto chunkSize = eagerKeysChunkSize();
+
+        // All the keys fit into a single query
+        if (keys.size() <= chunkSize)
+            return get();
+
+        /* The eager constraints don't allow to split the keys, the query is sent with
+           all the keys, it's sent only if it fits the bindings limit. */
+        if (!eagerKeysSplittable()) {
+            throwIfEagerKeysExceedLimit();
+
+            return get();
+        }
+
+        auto &query = getBaseQuery();
+
+        /* The get() can add select columns to the query (BelongsToMany), so columns
+           must be restored before every chunk. */
+        const auto columns = query.getColumns();
+
+        QVector<Related> results;
+
+        for (QVector<QVariant>::size_type offset = 0; offset < keys.size();
+             offset += chunkSize
+        ) {
+            query.setColumns(columns)
+                 .replaceWhereInValues(whereIndex, bindingsOffset,
+                                       keys.mid(offset, chunkSize));
+
+            auto chunk = get();
+
+            results.reserve(results.size() + chunk.size());
+            std::ranges::move(chunk, std::back_inserter(results));
+        }
+
+        return results;
     }
 
     template<class Model, class Related>
@@ -339,6 +426,128 @@ namespace Relations
                 | ranges::actions::unique;
     }
 
+    template<class Model, class Related>
+    void Relation<Model, Related>::whereInEager(const QString &column,
+                                                QVector<QVariant> &&keys) const
+    {
+        auto &query = getBaseQuery();
+
+        /* Bind all the keys as a single array, the query string and the query plan
+           stay the same for any number of keys (PostgreSQL only). */
+        if (query.getConnection().usesEagerArrayBinding()) {
+            query.whereInArray(column, keys);
+            return;
+        }
+
+        /* Remember where the keys are, the getEager() replaces them with chunks of
+           keys if they exceed the bindings limit. */
+        m_eagerKeysWhere.emplace(EagerKeysWhere {
+            query.getWheres().size(),
+            query.getRawBindings().size(BindingType::WHERE),
+            std::move(keys)});
+
+        query.whereIn(column, m_eagerKeysWhere->keys);
+    }
+
+    template<class Model, class Related>
+    QVector<QVariant>::size_type Relation<Model, Related>::eagerKeysChunkSize() const
+    {
+        using SizeType = QVector<QVariant>::size_type;
+
+        const auto &query = getBaseQuery();
+
+        // Other bindings of the query share the bindings limit with the keys
+        const auto otherBindingsCount = query.getRawBindings().size() -
+                                        m_eagerKeysWhere->keys.size(); // NOLINT(bugprone-unchecked-optional-access)
+        const auto maxBindingsCount = static_cast<SizeType>(
+                                          query.getConnection().getMaxBindingsCount());
+
+        return std::clamp<SizeType>(maxBindingsCount - otherBindingsCount, 1,
+                                    MaxEagerKeysChunkSize);
+    }
+
+    template<class Model, class Related>
+    bool Relation<Model, Related>::eagerKeysSplittable() const
+    {
+        const auto &query = getBaseQuery();
+
+        // The limit and offset would be applied to every chunk separately
+        if (query.getLimit() > -1 || query.getOffset() > -1)
+            return false;
+
+        /* The top-level "or where" clause would select the same rows for every chunk,
+           the condition of the first where clause is ignored. Orders are fine, all
+           related models of one parent model are selected by the same chunk. */
+        const auto &wheres = query.getWheres();
+
+        // Also the "or not" condition
+        const auto isOrCondition = [](const QString &condition)
+        {
+            return condition.startsWith(OR, Qt::CaseInsensitive) &&
+                   (condition.size() == OR.size() ||
+                    condition.at(OR.size()) == SPACE);
+        };
+
+        for (QVector<WhereConditionItem>::size_type index = 1; index < wheres.size();
+             ++index
+        )
+            if (isOrCondition(wheres.at(index).condition))
+                return false;
+
+        return true;
+    }
+
+    template<class Model, class Related>
+    void Relation<Model, Related>::throwIfEagerKeysExceedLimit() const
+    {
+        const auto &query = getBaseQuery();
+        const auto &connection = query.getConnection();
+
+        const auto bindingsCount = static_cast<std::size_t>(
+                                       query.getRawBindings().size());
+        const auto maxBindingsCount = connection.getMaxBindingsCount();
+
+        if (bindingsCount <= maxBindingsCount)
+            return;
+
+        throw Orm::Exceptions::LogicError(
+                    QStringLiteral(
+                        "The eager load query of the '%1' relation has %2 bindings, "
+                        "but the '%3' connection allows only %4 bindings. The eager "
+                        "load keys can't be split into chunks because the eager "
+                        "constraints contain the limit, offset, or top-level "
+                        "\"or where\" clause, in %5().")
+                    .arg(relationTypeName()).arg(bindingsCount)
+                    .arg(connection.getName()).arg(maxBindingsCount)
+                    .arg(__tiny_func__));
+    }
+
+    template<class Model, class Related>
+    template<typename KeyType, typename M>
+    KeyType
+    Relation<Model, Related>::getMatchingKey(const M &model, const QString &key,
+                                             MatchingKeyPosition &keyPosition)
+    {
+        const auto &attributesHash = model.getAttributesHash();
+
+        /* Models hydrated from the same result set share the attributes hash, so
+           the key position is looked up only if the hash differs. */
+        if (keyPosition.attributesHash != &attributesHash) {
+            const auto itAttribute = attributesHash.find(key);
+
+            keyPosition.attributesHash = &attributesHash;
+            keyPosition.position = itAttribute == attributesHash.end()
+                                   ? -1 : itAttribute->second;
+        }
+
+        // Model doesn't contain the key
+        if (keyPosition.position == -1)
+            return KeyType();
+
+        return model.getAttributes().at(keyPosition.position).value
+                .template value<KeyType>();
+    }
+
     /* Querying Relationship Existence/Absence */
 
     template<class Model, class Related>
@@ -11,6 +11,7 @@ TINY_SYSTEM_HEADER
 #include <range/v3/algorithm/contains.hpp>
 
 #include "orm/databaseconnection.hpp"
+#include "orm/exceptions/logicerror.hpp"
 #include "orm/tiny/concerns/buildsqueries.hpp"
 #include "orm/tiny/concerns/buildssoftdeletes.hpp"
 #include "orm/tiny/concerns/queriesrelationships.hpp"
@@ -66,6 +67,12 @@ namespace Orm::Tiny
         /* Retrieving results */
         /*! Execute the query as a "select" statement. */
         QVector<Model> get(const QVector<Column> &columns = {ASTERISK});
+        /*! Execute the query as a "select" statement and return the forward-only
+            cursor, models are hydrated lazily one by one (without eager loading). */
+        Cursor<Model> cursor(const QVector<Column> &columns = {ASTERISK});
+        /*! Execute the query as a "select" statement in the connection's worker
+            thread, models are hydrated in the worker thread (without eager loading). */
+        QFuture<QVector<Model>> getAsync(const QVector<Column> &columns = {ASTERISK});
 
         /*! Get a single column's value from the first result of a query. */
         QVariant value(const Column &column);
@@ -276,6 +283,33 @@ namespace Orm::Tiny
         /*! Get the default key name of the table. */
         inline const QString &defaultKeyName() const;
 
+        /*! Alias for the attributes hash. */
+        using AttributesHash = Orm::Tiny::Types::AttributesHash;
+        /*! Alias for the casts resolved to attribute positions. */
+        using HydratedCasts = Orm::Tiny::Types::HydratedCasts;
+
+        /*! Column layout of the result set, computed once and shared by all models
+            hydrated from this result set. */
+        struct HydrationLayout
+        {
+            /*! Positions of the hydrated columns (duplicate columns are skipped). */
+            QVector<int> positions;
+            /*! Attribute names in the hydrated order. */
+            QVector<QString> keys;
+            /*! Attributes hash shared by all hydrated models. */
+            AttributesHash attributesHash;
+            /*! Casts resolved to attribute positions, shared by all hydrated
+                models. */
+            std::shared_ptr<const HydratedCasts> casts;
+        };
+
+        /*! Compute the column layout of the given result set. */
+        static HydrationLayout createHydrationLayout(const Model &instance,
+                                                     const SqlQuery &result);
+        /*! Create a model from the current row of the SqlQuery. */
+        static Model hydrateRow(Model &instance, const SqlQuery &result,
+                                const HydrationLayout &layout);
+
         /*! Parse a list of relations into individuals. */
         QVector<WithItem> parseWithRelations(const QVector<WithItem> &relations);
         /*! Create a constraint to select the given columns for the relation. */
@@ -384,6 +418,64 @@ namespace Orm::Tiny
 //        return getModel().newCollection(models);
     }
 
+    template<typename Model>
+    Cursor<Model>
+    Builder<Model>::cursor(const QVector<Column> &columns)
+    {
+        applySoftDeletes();
+
+        /* The cursor can outlive this builder (eg. Model::query()->cursor()), so
+           capture the model instance only. */
+        return Cursor<Model>(m_query->cursor(columns),
+                             [instance = newModelInstance(),
+                              layout = std::optional<HydrationLayout>()]
+                             (SqlQuery &result) mutable
+        {
+            // The layout is the same for all rows, compute it during the first row
+            if (!layout)
+                layout = createHydrationLayout(instance, result);
+
+            return hydrateRow(instance, result, *layout);
+        });
+    }
+
+    template<typename Model>
+    QFuture<QVector<Model>>
+    Builder<Model>::getAsync(const QVector<Column> &columns)
+    {
+        /* Relations would be eager loaded in the worker thread, but connections used
+           by relation queries are thread-local. */
+        if (!m_eagerLoad.isEmpty())
+            throw Orm::Exceptions::LogicError(
+                    "The getAsync method doesn't support eager loading, please use "
+                    "the load method on the returned models instead.");
+
+        applySoftDeletes();
+
+        auto &query = getQuery();
+
+        // The query is compiled in this thread, only the query runs in the worker thread
+        return query.getConnection().template selectAsync<QVector<Model>>(
+                    query.toSqlWithColumns(columns), query.getBindings(),
+                    !query.usesWriteConnection(),
+                    /* The result can outlive this builder, so capture the model
+                       instance only. */
+                    [instance = newModelInstance()](SqlQuery &result) mutable
+        {
+            QVector<Model> models;
+            std::optional<HydrationLayout> layout;
+
+            while (result.next()) {
+                if (!layout)
+                    layout = createHydrationLayout(instance, result);
+
+                models << hydrateRow(instance, result, *layout);
+            }
+
+            return models;
+        });
+    }
+
     template<typename Model>
     QVariant Builder<Model>::value(const Column &column)
     {
@@ -1095,23 +1187,28 @@ namespace Orm::Tiny
         auto instance = newModelInstance();
 
         QVector<Model> models;
-        models.reserve(QueryUtils::queryResultSize(result));
 
-        const auto fieldsCount = result.record().count();
+        /* Don't pre-count rows if the driver can't report the result size (SQLite),
+           the vector grows as needed in this case, the LIMIT is used as a hint. */
+        if (const auto sizeHint = QueryUtils::queryResultSizeHint(result,
+                                                                  m_query->getLimit());
+            sizeHint > 0
+        )
+            models.reserve(sizeHint);
+
+        // Computed once during the first row, nothing to compute for an empty result
+        std::optional<HydrationLayout> layout;
 
         while (result.next()) {
-            QVector<AttributeItem> row;
-            row.reserve(fieldsCount);
-
-            // Populate model attributes with data from the database (one table row)
-            const auto record = result.record();
-            for (int i = 0; i < record.count(); ++i)
-                row.append({record.fieldName(i), result.value(i)});
+            if (!layout)
+                layout = createHydrationLayout(instance, result);
 
-            // Create a new model instance from the table row
-            models << instance.newFromBuilder(std::move(row));
+            models << hydrateRow(instance, result, *layout);
         }
 
+        // The result set is consumed, re-use the prepared query by the next query
+        result.releaseStatement();
+
         return models;
     }
 
@@ -1195,6 +1292,67 @@ namespace Orm::Tiny
         return m_model.getKeyName();
     }
 
+    template<typename Model>
+    typename Builder<Model>::HydrationLayout
+    Builder<Model>::createHydrationLayout(const Model &instance, const SqlQuery &result)
+    {
+        const auto record = result.record();
+        const auto fieldsCount = record.count();
+
+        /* The last column wins if the result contains duplicate column names, the same
+           as the AttributeUtils::removeDuplicitKeys() does. */
+        std::unordered_map<QString, int> lastPositions;
+        lastPositions.reserve(static_cast<std::size_t>(fieldsCount));
+
+        for (int i = 0; i < fieldsCount; ++i)
+            lastPositions[record.fieldName(i)] = i;
+
+        HydrationLayout layout;
+        layout.positions.reserve(static_cast<int>(lastPositions.size()));
+        layout.keys.reserve(static_cast<int>(lastPositions.size()));
+
+        AttributesHash::HashType attributesHash;
+        attributesHash.reserve(lastPositions.size());
+
+        for (int i = 0; i < fieldsCount; ++i) {
+            auto fieldName = record.fieldName(i);
+
+            // Duplicate column
+            if (lastPositions.at(fieldName) != i)
+                continue;
+
+            attributesHash.emplace(fieldName, static_cast<int>(layout.keys.size()));
+            layout.positions << i;
+            layout.keys << std::move(fieldName);
+        }
+
+        layout.attributesHash = std::move(attributesHash);
+        // Resolve casts only once, attributes are still cast lazily on the access
+        layout.casts = instance.resolveHydratedCasts(layout.attributesHash);
+
+        return layout;
+    }
+
+    template<typename Model>
+    Model Builder<Model>::hydrateRow(Model &instance, const SqlQuery &result,
+                                     const HydrationLayout &layout)
+    {
+        // Populate model attributes with data from the database (one table row)
+        const auto fieldsCount = layout.keys.size();
+
+        QVector<AttributeItem> row;
+        row.reserve(fieldsCount);
+
+        // Keys are implicitly shared, only values are new
+        for (decltype (layout.keys)::size_type i = 0; i < fieldsCount; ++i)
+            row.append({layout.keys.at(i), result.value(layout.positions.at(i))});
+
+        /* Create a new model instance from the table row, the attributes hash and
+           the resolved casts are shared. */
+        return instance.newFromBuilder(std::move(row), layout.attributesHash,
+                                       layout.casts);
+    }
+
     template<typename Model>
     QVector<WithItem>
     Builder<Model>::parseWithRelations(const QVector<WithItem> &relations)
@@ -671,6 +671,10 @@ namespace Tiny
         /*! Lock the selected rows in the table. */
         TinyBuilder<Model> &lock(QString &&value);
 
+        /* Read/write connections */
+        /*! Send the select queries to the write connection. */
+        TinyBuilder<Model> &useWriteConnection(bool value = true);
+
         /* Others proxy methods, not added to the Model and Relation */
         /*! Add an "exists" clause to the query. */
         TinyBuilder<Model> &
@@ -2245,6 +2249,15 @@ namespace Tiny
         return builder();
     }
 
+    /* Read/write connections */
+
+    template<typename Model>
+    TinyBuilder<Model> &BuilderProxies<Model>::useWriteConnection(const bool value)
+    {
+        getQuery().useWriteConnection(value);
+        return builder();
+    }
+
     /* Others proxy methods, not added to the Model and Relation */
 
     template<typename Model>
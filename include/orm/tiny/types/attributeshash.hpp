@@ -0,0 +1,180 @@
+#pragma once
+#ifndef ORM_TINY_TYPES_ATTRIBUTESHASH_HPP
+#define ORM_TINY_TYPES_ATTRIBUTESHASH_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QString>
+
+#include <memory>
+#include <unordered_map>
+
+#include "orm/macros/commonnamespace.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Tiny::Types
+{
+
+    /*! Implicitly shared (copy-on-write) hash that maps an attribute name to
+        the attribute position, models hydrated from the same result set share
+        one instance until some of them is modified. */
+    class AttributesHash
+    {
+    public:
+        /*! Underlying hash type. */
+        using HashType = std::unordered_map<QString, int>;
+        /*! Const iterator type. */
+        using const_iterator = HashType::const_iterator;
+
+        /*! Default constructor, creates an empty hash without any allocation. */
+        inline AttributesHash() = default;
+        /*! Converting constructor from the underlying hash type. */
+        inline AttributesHash(HashType &&hash); // NOLINT(google-explicit-constructor)
+
+        /*! Equality comparison operator, compares the hash content. */
+        inline bool operator==(const AttributesHash &other) const;
+
+        /*! Determine whether the hash contains the given attribute. */
+        inline bool contains(const QString &key) const;
+        /*! Get the position of the given attribute (throws if not found). */
+        inline int at(const QString &key) const;
+        /*! Find the given attribute. */
+        inline const_iterator find(const QString &key) const;
+        /*! Get the past-the-end iterator. */
+        inline const_iterator end() const;
+        /*! Get the number of attributes in the hash. */
+        inline std::size_t size() const;
+        /*! Determine whether the hash is empty. */
+        inline bool empty() const;
+
+        /*! Get the underlying hash. */
+        inline const HashType &hash() const;
+        /*! Get the modifiable underlying hash, detaches (copies) if shared. */
+        inline HashType &detach();
+
+        /*! Insert the given attribute position (detaches). */
+        inline void emplace(const QString &key, int position);
+        /*! Remove the given attribute (detaches). */
+        inline void erase(const QString &key);
+        /*! Remove all attributes, only releases the shared hash. */
+        inline void clear() noexcept;
+
+        /*! Determine whether the hash data are shared with other instances. */
+        inline bool isShared() const noexcept;
+        /*! Determine whether the hash data are shared with the given instance. */
+        inline bool isSharedWith(const AttributesHash &other) const noexcept;
+
+    private:
+        /*! Get the empty hash (used if nothing was allocated yet). */
+        inline static const HashType &emptyHash();
+
+        /*! Shared hash data. */
+        std::shared_ptr<HashType> m_data = nullptr;
+    };
+
+    /* public */
+
+    AttributesHash::AttributesHash(HashType &&hash)
+        : m_data(std::make_shared<HashType>(std::move(hash)))
+    {}
+
+    bool AttributesHash::operator==(const AttributesHash &other) const
+    {
+        // Shared data or both empty
+        if (m_data == other.m_data)
+            return true;
+
+        return hash() == other.hash();
+    }
+
+    bool AttributesHash::contains(const QString &key) const
+    {
+        return m_data && m_data->contains(key);
+    }
+
+    int AttributesHash::at(const QString &key) const
+    {
+        return hash().at(key);
+    }
+
+    AttributesHash::const_iterator AttributesHash::find(const QString &key) const
+    {
+        return hash().find(key);
+    }
+
+    AttributesHash::const_iterator AttributesHash::end() const
+    {
+        return hash().end();
+    }
+
+    std::size_t AttributesHash::size() const
+    {
+        return m_data ? m_data->size() : 0;
+    }
+
+    bool AttributesHash::empty() const
+    {
+        return !m_data || m_data->empty();
+    }
+
+    const AttributesHash::HashType &AttributesHash::hash() const
+    {
+        return m_data ? *m_data : emptyHash();
+    }
+
+    AttributesHash::HashType &AttributesHash::detach()
+    {
+        if (!m_data)
+            m_data = std::make_shared<HashType>();
+
+        else if (m_data.use_count() > 1)
+            m_data = std::make_shared<HashType>(*m_data);
+
+        return *m_data;
+    }
+
+    void AttributesHash::emplace(const QString &key, const int position)
+    {
+        detach().emplace(key, position);
+    }
+
+    void AttributesHash::erase(const QString &key)
+    {
+        // Nothing to do
+        if (!contains(key))
+            return;
+
+        detach().erase(key);
+    }
+
+    void AttributesHash::clear() noexcept
+    {
+        m_data.reset();
+    }
+
+    bool AttributesHash::isShared() const noexcept
+    {
+        return m_data.use_count() > 1;
+    }
+
+    bool AttributesHash::isSharedWith(const AttributesHash &other) const noexcept
+    {
+        return m_data && m_data == other.m_data;
+    }
+
+    /* private */
+
+    const AttributesHash::HashType &AttributesHash::emptyHash()
+    {
+        static const HashType cached;
+
+        return cached;
+    }
+
+} // namespace Orm::Tiny::Types
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TINY_TYPES_ATTRIBUTESHASH_HPP
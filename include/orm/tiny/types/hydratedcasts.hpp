@@ -0,0 +1,79 @@
+#pragma once
+#ifndef ORM_TINY_TYPES_HYDRATEDCASTS_HPP
+#define ORM_TINY_TYPES_HYDRATEDCASTS_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QVector>
+
+#include "orm/macros/commonnamespace.hpp"
+#include "orm/tiny/types/attributeshash.hpp"
+#include "orm/tiny/types/modelcasts.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Tiny::Types
+{
+
+    /*! Casts resolved to attribute positions once per hydrated result set, shared by
+        all models hydrated from this result set. They are used only while the model
+        shares the same attributes hash and casts, attributes are still cast lazily
+        on the attribute access. */
+    class HydratedCasts
+    {
+        Q_DISABLE_COPY(HydratedCasts)
+
+    public:
+        /*! Constructor. */
+        inline HydratedCasts(AttributesHash attributesHash, ModelCasts casts,
+                             QVector<const CastItem *> &&castItems) noexcept;
+        /*! Default destructor. */
+        inline ~HydratedCasts() = default;
+
+        /*! Determine whether the casts were resolved for the given attributes hash and
+            model casts (the model wasn't modified). */
+        inline bool isValidFor(const AttributesHash &attributesHash,
+                               const ModelCasts &casts) const noexcept;
+        /*! Get the cast for the attribute at the given position (nullptr if none). */
+        inline const CastItem *at(int position) const noexcept;
+
+    private:
+        /*! The attributes hash, it keeps the hash data alive, so the shared data can
+            be compared. */
+        AttributesHash m_attributesHash;
+        /*! The model instance casts, the same as above (keeps the casts alive). */
+        ModelCasts m_casts;
+        /*! Casts indexed by the attribute position. */
+        QVector<const CastItem *> m_castItems;
+    };
+
+    /* public */
+
+    HydratedCasts::HydratedCasts(
+            AttributesHash attributesHash, ModelCasts casts,
+            QVector<const CastItem *> &&castItems) noexcept
+        : m_attributesHash(std::move(attributesHash))
+        , m_casts(std::move(casts))
+        , m_castItems(std::move(castItems))
+    {}
+
+    bool HydratedCasts::isValidFor(const AttributesHash &attributesHash,
+                                   const ModelCasts &casts) const noexcept
+    {
+        /* Every modification of the shared attributes hash or casts detaches (copies)
+           them because they are also referenced by this instance. */
+        return m_attributesHash.isSharedWith(attributesHash) &&
+               m_casts.isSharedWith(casts);
+    }
+
+    const CastItem *HydratedCasts::at(const int position) const noexcept
+    {
+        return m_castItems.at(position);
+    }
+
+} // namespace Orm::Tiny::Types
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TINY_TYPES_HYDRATEDCASTS_HPP
@@ -0,0 +1,103 @@
+#pragma once
+#ifndef ORM_TINY_TYPES_MODELCASTS_HPP
+#define ORM_TINY_TYPES_MODELCASTS_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <memory>
+#include <unordered_map>
+
+#include "orm/macros/commonnamespace.hpp"
+#include "orm/tiny/tinytypes.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Tiny::Types
+{
+
+    /*! Casts of the model instance that differ from the casts defined by the model
+        type (merged by the mergeCasts() or withCasts()), implicitly shared
+        (copy-on-write) between model instances created from the same model. */
+    class ModelCasts
+    {
+    public:
+        /*! Underlying hash type. */
+        using HashType = std::unordered_map<QString, CastItem>;
+
+        /*! Default constructor, the model type casts are used. */
+        inline ModelCasts() = default;
+
+        /*! Equality comparison operator, compares the hash content. */
+        inline bool operator==(const ModelCasts &other) const;
+
+        /*! Determine whether the model type casts are used (nothing was merged). */
+        inline bool isNull() const noexcept;
+        /*! Determine whether the given instance uses the same casts (both null or
+            shared data). */
+        inline bool isSharedWith(const ModelCasts &other) const noexcept;
+        /*! Get the instance casts or the given model type casts if null. */
+        inline const HashType &hashOr(const HashType &typeCasts) const noexcept;
+
+        /*! Get the modifiable instance casts, initializes them from the given model
+            type casts if null and detaches (copies) if shared. */
+        inline HashType &detach(const HashType &typeCasts);
+        /*! Replace the instance casts by an empty hash. */
+        inline void clear();
+
+    private:
+        /*! Shared instance casts. */
+        std::shared_ptr<HashType> m_data = nullptr;
+    };
+
+    /* public */
+
+    bool ModelCasts::operator==(const ModelCasts &other) const
+    {
+        // Shared data or both null
+        if (m_data == other.m_data)
+            return true;
+
+        if (!m_data || !other.m_data)
+            return false;
+
+        return *m_data == *other.m_data;
+    }
+
+    bool ModelCasts::isNull() const noexcept
+    {
+        return !m_data;
+    }
+
+    bool ModelCasts::isSharedWith(const ModelCasts &other) const noexcept
+    {
+        return m_data == other.m_data;
+    }
+
+    const ModelCasts::HashType &
+    ModelCasts::hashOr(const HashType &typeCasts) const noexcept
+    {
+        return m_data ? *m_data : typeCasts;
+    }
+
+    ModelCasts::HashType &ModelCasts::detach(const HashType &typeCasts)
+    {
+        if (!m_data)
+            m_data = std::make_shared<HashType>(typeCasts);
+
+        else if (m_data.use_count() > 1)
+            m_data = std::make_shared<HashType>(*m_data);
+
+        return *m_data;
+    }
+
+    void ModelCasts::clear()
+    {
+        m_data = std::make_shared<HashType>();
+    }
+
+} // namespace Orm::Tiny::Types
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TINY_TYPES_MODELCASTS_HPP
@@ -0,0 +1,47 @@
+#pragma once
+#ifndef ORM_TYPES_BATCHSTATEMENT_HPP
+#define ORM_TYPES_BATCHSTATEMENT_HPP
+
+#include <QVariant>
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include "orm/macros/commonnamespace.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+namespace Types
+{
+
+    /*! SQL statement with its bindings executed by the batch. */
+    struct BatchStatement
+    {
+        /*! SQL query with the ? placeholders. */
+        QString query;
+        /*! Bindings for the SQL query. */
+        QVector<QVariant> bindings {};
+    };
+
+    /*! Result of the SQL statement executed by the batch. */
+    struct BatchResult
+    {
+        /*! Number of rows affected by the statement (-1 if it can't be determined). */
+        int affected = -1;
+        /*! ID of the last inserted row (invalid if not supported or nothing was
+            inserted). */
+        QVariant lastInsertId {};
+    };
+
+} // namespace Types
+
+    using BatchResult = Types::BatchResult;
+    using BatchStatement = Types::BatchStatement;
+
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TYPES_BATCHSTATEMENT_HPP
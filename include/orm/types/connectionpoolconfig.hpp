@@ -0,0 +1,44 @@
+#pragma once
+#ifndef ORM_TYPES_CONNECTIONPOOLCONFIG_HPP
+#define ORM_TYPES_CONNECTIONPOOLCONFIG_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QtGlobal>
+
+#include <chrono>
+
+#include "orm/macros/commonnamespace.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+namespace Types
+{
+
+    /*! Connection pool configuration (pool_xyz configuration options). */
+    struct ConnectionPoolConfig
+    {
+        /*! Minimum number of connections kept in the pool (not closed when idle). */
+        std::size_t minSize = 0;
+        /*! Maximum number of connections (checked out and idle) in the pool. */
+        std::size_t maxSize = 0;
+        /*! Close idle connections above the minSize after this time (0 never). */
+        std::chrono::milliseconds idleTimeout {0};
+        /*! Maximum time to wait for a connection if the pool is saturated. */
+        std::chrono::milliseconds waitTimeout {30000};
+        /*! Validate a borrowed opened connection using the pingDatabase(). */
+        bool validate = false;
+    };
+
+} // namespace Types
+
+    using ConnectionPoolConfig = Types::ConnectionPoolConfig;
+
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TYPES_CONNECTIONPOOLCONFIG_HPP
@@ -0,0 +1,87 @@
+#pragma once
+#ifndef ORM_TYPES_CONNECTIONPOOLSTATS_HPP
+#define ORM_TYPES_CONNECTIONPOOLSTATS_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QtGlobal>
+
+#include "orm/macros/commonnamespace.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+namespace Types
+{
+
+    /*! Connection pool metrics, wait times are in milliseconds. */
+    struct ConnectionPoolStats
+    {
+        /*! Maximum number of connections in the pool. */
+        std::size_t maxSize = 0;
+        /*! Number of connections in the pool (checked out and idle). */
+        std::size_t size = 0;
+        /*! Number of idle connections. */
+        std::size_t idle = 0;
+        /*! Number of checked out connections. */
+        std::size_t inUse = 0;
+        /*! Number of retired connections waiting to be closed by the threads that
+            opened them (they count against the maxSize). */
+        std::size_t retired = 0;
+        /*! Maximum number of connections that were checked out at once. */
+        std::size_t peakInUse = 0;
+
+        /*! Number of successful checkouts. */
+        qint64 checkouts = 0;
+        /*! Number of checkouts that had to wait because the pool was saturated. */
+        qint64 waits = 0;
+        /*! Number of checkouts that timed out. */
+        qint64 timeouts = 0;
+        /*! Total time spent waiting for a connection. */
+        qint64 totalWaitTime = 0;
+        /*! The longest time spent waiting for a connection. */
+        qint64 maxWaitTime = 0;
+
+        /*! Number of created connections. */
+        qint64 created = 0;
+        /*! Number of closed connections (idle timeout or failed validation). */
+        qint64 destroyed = 0;
+        /*! Number of borrowed connections that failed the validation. */
+        qint64 validationFailures = 0;
+
+        /*! Get the pool saturation, the ratio of checked out connections to the pool
+            maximum size (1.0 means all connections are in use). */
+        inline double saturation() const noexcept;
+        /*! Get the average time spent waiting for a connection. */
+        inline double averageWaitTime() const noexcept;
+    };
+
+    /* public */
+
+    double ConnectionPoolStats::saturation() const noexcept
+    {
+        if (maxSize == 0)
+            return 0.0;
+
+        return static_cast<double>(inUse) / static_cast<double>(maxSize);
+    }
+
+    double ConnectionPoolStats::averageWaitTime() const noexcept
+    {
+        if (checkouts == 0)
+            return 0.0;
+
+        return static_cast<double>(totalWaitTime) / static_cast<double>(checkouts);
+    }
+
+} // namespace Types
+
+    using ConnectionPoolStats = Types::ConnectionPoolStats;
+
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TYPES_CONNECTIONPOOLSTATS_HPP
@@ -0,0 +1,252 @@
+#pragma once
+#ifndef ORM_TYPES_CURSOR_HPP
+#define ORM_TYPES_CURSOR_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <variant>
+
+#include "orm/types/sqlquery.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+namespace Types
+{
+
+    /*! Forward-only cursor over the result of the select query, it's the input range
+        so it can be iterated only once, rows are fetched lazily one by one (only
+        the current row is kept in the memory). */
+    template<typename T = SqlQuery>
+    class Cursor
+    {
+        Q_DISABLE_COPY(Cursor)
+
+        /*! Determine whether the cursor yields the SqlQuery itself. */
+        constexpr static bool IsSqlQuery = std::is_same_v<T, SqlQuery>;
+
+    public:
+        /*! Type of the row value. */
+        using value_type = T;
+        /*! Transformer type, creates the row value from the current row. */
+        using TransformerType = std::function<T(SqlQuery &)>;
+
+        /*! Input iterator for the cursor. */
+        class Iterator
+        {
+        public:
+            /*! Iterator concept. */
+            using iterator_concept  = std::input_iterator_tag;
+            /*! Iterator category. */
+            using iterator_category = std::input_iterator_tag;
+            /*! Type of the row value. */
+            using value_type        = T;
+            /*! Difference type. */
+            using difference_type   = std::ptrdiff_t;
+            /*! Pointer to the row value. */
+            using pointer           = T *;
+            /*! Reference to the row value. */
+            using reference         = T &;
+
+            /*! Default constructor, creates the past-the-end iterator. */
+            inline Iterator() = default;
+            /*! Constructor. */
+            inline explicit Iterator(Cursor *cursor) noexcept;
+
+            /*! Get the current row value. */
+            inline reference operator*() const;
+            /*! Get a pointer to the current row value. */
+            inline pointer operator->() const;
+
+            /*! Fetch the next row (pre-increment). */
+            inline Iterator &operator++();
+            /*! Fetch the next row (post-increment). */
+            inline void operator++(int);
+
+            /*! Equality comparison operator, all past-the-end iterators are equal. */
+            inline bool operator==(const Iterator &other) const noexcept;
+
+        private:
+            /*! Determine whether the iterator is past-the-end. */
+            inline bool isEnd() const noexcept;
+
+            /*! Pointer to the cursor. */
+            Cursor *m_cursor = nullptr;
+        };
+
+        /*! Alias for the iterator (std naming). */
+        using iterator = Iterator;
+
+        /*! Constructor, the cursor yields the SqlQuery positioned on the current row. */
+        inline explicit Cursor(SqlQuery &&query) requires std::is_same_v<T, SqlQuery>;
+        /*! Constructor, the cursor yields values created by the given transformer. */
+        inline Cursor(SqlQuery &&query, TransformerType &&transformer);
+        /*! Default destructor. */
+        inline ~Cursor() = default;
+
+        /*! Move constructor (iterators obtained before the move are invalidated). */
+        inline Cursor(Cursor &&) = default;
+        /*! Deleted move assignment operator (follow the SqlQuery). */
+        Cursor &operator=(Cursor &&) = delete;
+
+        /*! Get the iterator to the current row, fetches the first row at the first
+            call, it doesn't rewind the cursor. */
+        inline Iterator begin();
+        /*! Get the past-the-end iterator. */
+        inline Iterator end() const noexcept;
+
+        /*! Get the underlying SqlQuery. */
+        inline SqlQuery &query() noexcept;
+
+    private:
+        /*! Fetch the next row from the database. */
+        inline void fetchNext();
+        /*! Get the current row value. */
+        inline T &current();
+
+        /*! Underlying forward-only query. */
+        SqlQuery m_query;
+        /*! Transformer that creates the row value from the current row. */
+        TransformerType m_transformer {};
+        /*! The current row value (not used if the cursor yields the SqlQuery). */
+        std::conditional_t<IsSqlQuery, std::monostate, std::optional<T>> m_current {};
+        /*! Determine whether the first row was already fetched. */
+        bool m_started = false;
+        /*! Determine whether the cursor is positioned on a valid row. */
+        bool m_valid = false;
+    };
+
+    /* Cursor::Iterator */
+
+    /* public */
+
+    template<typename T>
+    Cursor<T>::Iterator::Iterator(Cursor *const cursor) noexcept
+        : m_cursor(cursor)
+    {}
+
+    template<typename T>
+    typename Cursor<T>::Iterator::reference
+    Cursor<T>::Iterator::operator*() const
+    {
+        return m_cursor->current();
+    }
+
+    template<typename T>
+    typename Cursor<T>::Iterator::pointer
+    Cursor<T>::Iterator::operator->() const
+    {
+        return std::addressof(m_cursor->current());
+    }
+
+    template<typename T>
+    typename Cursor<T>::Iterator &
+    Cursor<T>::Iterator::operator++()
+    {
+        m_cursor->fetchNext();
+
+        return *this;
+    }
+
+    template<typename T>
+    void Cursor<T>::Iterator::operator++(int)
+    {
+        ++*this;
+    }
+
+    template<typename T>
+    bool Cursor<T>::Iterator::operator==(const Iterator &other) const noexcept
+    {
+        if (isEnd() || other.isEnd())
+            return isEnd() == other.isEnd();
+
+        return m_cursor == other.m_cursor;
+    }
+
+    /* private */
+
+    template<typename T>
+    bool Cursor<T>::Iterator::isEnd() const noexcept
+    {
+        return m_cursor == nullptr || !m_cursor->m_valid;
+    }
+
+    /* Cursor */
+
+    /* public */
+
+    template<typename T>
+    Cursor<T>::Cursor(SqlQuery &&query) requires std::is_same_v<T, SqlQuery>
+        : m_query(std::move(query))
+    {}
+
+    template<typename T>
+    Cursor<T>::Cursor(SqlQuery &&query, TransformerType &&transformer)
+        : m_query(std::move(query))
+        , m_transformer(std::move(transformer))
+    {}
+
+    template<typename T>
+    typename Cursor<T>::Iterator Cursor<T>::begin()
+    {
+        if (!m_started) {
+            m_started = true;
+
+            fetchNext();
+        }
+
+        return Iterator(this);
+    }
+
+    template<typename T>
+    typename Cursor<T>::Iterator Cursor<T>::end() const noexcept
+    {
+        return {};
+    }
+
+    template<typename T>
+    SqlQuery &Cursor<T>::query() noexcept
+    {
+        return m_query;
+    }
+
+    /* private */
+
+    template<typename T>
+    void Cursor<T>::fetchNext()
+    {
+        m_valid = m_query.next();
+
+        if constexpr (!IsSqlQuery) {
+            if (m_valid)
+                m_current.emplace(std::invoke(m_transformer, m_query));
+            else
+                m_current.reset();
+        }
+    }
+
+    template<typename T>
+    T &Cursor<T>::current()
+    {
+        if constexpr (IsSqlQuery)
+            return m_query;
+        else
+            return *m_current;
+    }
+
+} // namespace Types
+
+    /*! Alias for the Types::Cursor. */
+    template<typename T = SqlQuery>
+    using Cursor = Types::Cursor<T>;
+
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TYPES_CURSOR_HPP
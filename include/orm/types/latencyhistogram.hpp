@@ -0,0 +1,180 @@
+#pragma once
+#ifndef ORM_TYPES_LATENCYHISTOGRAM_HPP
+#define ORM_TYPES_LATENCYHISTOGRAM_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QtGlobal>
+
+#include <vector>
+
+#include "orm/macros/commonnamespace.hpp"
+#include "orm/macros/export.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+namespace Types
+{
+
+    /*! Latency percentiles in nanoseconds. */
+    struct LatencyPercentiles
+    {
+        /*! Number of recorded values. */
+        qint64 count = 0;
+        /*! Median. */
+        qint64 p50 = 0;
+        /*! 90th percentile. */
+        qint64 p90 = 0;
+        /*! 99th percentile. */
+        qint64 p99 = 0;
+        /*! Maximum recorded value (exact). */
+        qint64 max = 0;
+    };
+
+    /*! HDR-style latency histogram, values are recorded into log-linear buckets,
+        every power of two range is divided into the same number of linear
+        sub-buckets, so the relative error of the obtained percentiles is constant
+        (less than 1/64). Recording is O(1) and doesn't allocate (except the first
+        record). */
+    class SHAREDLIB_EXPORT LatencyHistogram
+    {
+    public:
+        /*! Record the given value in nanoseconds (negative values are ignored). */
+        void record(qint64 value);
+        /*! Add all values recorded in the other histogram to this histogram. */
+        LatencyHistogram &merge(const LatencyHistogram &other);
+        /*! Remove all recorded values. */
+        void reset();
+
+        /*! Get the number of recorded values. */
+        inline qint64 count() const noexcept;
+        /*! Determine whether the histogram doesn't contain any values. */
+        inline bool isEmpty() const noexcept;
+        /*! Get the minimum recorded value (exact, 0 if empty). */
+        inline qint64 min() const noexcept;
+        /*! Get the maximum recorded value (exact, 0 if empty). */
+        inline qint64 max() const noexcept;
+        /*! Get the sum of all recorded values. */
+        inline qint64 total() const noexcept;
+        /*! Get the arithmetic mean of all recorded values (0 if empty). */
+        inline qint64 mean() const noexcept;
+
+        /*! Get the value at the given percentile (0-100), it returns the highest value
+            that is equivalent to the recorded values in the same bucket. */
+        qint64 valueAtPercentile(double percentile) const;
+        /*! Get the p50/p90/p99/max percentiles. */
+        LatencyPercentiles percentiles() const;
+
+    private:
+        /*! Get the bucket index for the given value. */
+        static std::size_t bucketIndex(quint64 value) noexcept;
+        /*! Get the highest value that falls into the given bucket. */
+        static qint64 highestEquivalentValue(std::size_t index) noexcept;
+
+        /*! Number of bits of the linear sub-buckets. */
+        constexpr static auto SubBucketBits = 7;
+        /*! Number of sub-buckets in the first (linear) range. */
+        constexpr static std::size_t SubBucketCount = 1U << SubBucketBits;
+        /*! Number of sub-buckets in every power of two range above the first range. */
+        constexpr static std::size_t SubBucketHalfCount = SubBucketCount / 2;
+        /*! Number of bits of the highest trackable value (~18 minutes), higher values
+            are recorded into the last bucket. */
+        constexpr static auto HighestTrackableBits = 40;
+        /*! Total number of buckets. */
+        constexpr static std::size_t BucketsCount =
+                SubBucketCount +
+                (HighestTrackableBits - SubBucketBits) * SubBucketHalfCount;
+
+        /*! Counts of recorded values for every bucket (allocated lazily). */
+        std::vector<qint64> m_counts {};
+        /*! Number of recorded values. */
+        qint64 m_count = 0;
+        /*! Minimum recorded value. */
+        qint64 m_min = 0;
+        /*! Maximum recorded value. */
+        qint64 m_max = 0;
+        /*! Sum of all recorded values. */
+        qint64 m_total = 0;
+    };
+
+    /* public */
+
+    qint64 LatencyHistogram::count() const noexcept
+    {
+        return m_count;
+    }
+
+    bool LatencyHistogram::isEmpty() const noexcept
+    {
+        return m_count == 0;
+    }
+
+    qint64 LatencyHistogram::min() const noexcept
+    {
+        return m_min;
+    }
+
+    qint64 LatencyHistogram::max() const noexcept
+    {
+        return m_max;
+    }
+
+    qint64 LatencyHistogram::total() const noexcept
+    {
+        return m_total;
+    }
+
+    qint64 LatencyHistogram::mean() const noexcept
+    {
+        return m_count == 0 ? 0 : m_total / m_count;
+    }
+
+    /*! Latency histograms of executed statements. */
+    struct LatencyHistograms
+    {
+        /*! Normal statements (SELECT, and statements executed using the statement()
+            or unprepared() methods). */
+        LatencyHistogram normal {};
+        /*! Affecting statements (UPDATE, INSERT, DELETE). */
+        LatencyHistogram affecting {};
+        /*! Transactional statements (START TRANSACTION, ROLLBACK, COMMIT, SAVEPOINT). */
+        LatencyHistogram transactional {};
+
+        /*! Add all values recorded in the other histograms to these histograms. */
+        inline LatencyHistograms &merge(const LatencyHistograms &other);
+        /*! Remove all recorded values. */
+        inline void reset();
+    };
+
+    /* public */
+
+    LatencyHistograms &LatencyHistograms::merge(const LatencyHistograms &other)
+    {
+        normal.merge(other.normal);
+        affecting.merge(other.affecting);
+        transactional.merge(other.transactional);
+
+        return *this;
+    }
+
+    void LatencyHistograms::reset()
+    {
+        normal.reset();
+        affecting.reset();
+        transactional.reset();
+    }
+
+} // namespace Types
+
+    using LatencyHistogram = Types::LatencyHistogram;
+    using LatencyHistograms = Types::LatencyHistograms;
+    using LatencyPercentiles = Types::LatencyPercentiles;
+
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TYPES_LATENCYHISTOGRAM_HPP
@@ -0,0 +1,155 @@
+#pragma once
+#ifndef ORM_TYPES_QUERYSTATISTICS_HPP
+#define ORM_TYPES_QUERYSTATISTICS_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QHash>
+#include <QVector>
+
+#include <algorithm>
+#include <optional>
+
+#include "orm/macros/commonnamespace.hpp"
+#include "orm/macros/export.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+namespace Types
+{
+
+    /*! Statistics of all executed queries with the same normalized query string. */
+    struct QueryStatistic
+    {
+        /*! Normalized query string (fingerprint). */
+        QString query;
+        /*! Number of times the query was executed. */
+        qint64 calls = 0;
+        /*! Total execution time in nanoseconds. */
+        qint64 totalTime = 0;
+        /*! Minimum execution time in nanoseconds. */
+        qint64 minTime = 0;
+        /*! Maximum execution time in nanoseconds. */
+        qint64 maxTime = 0;
+        /*! Total number of rows returned or affected (only rows reported
+            by the driver are counted). */
+        qint64 rows = 0;
+
+        /*! Get the mean execution time in nanoseconds. */
+        inline qint64 meanTime() const noexcept;
+    };
+
+    /* public */
+
+    qint64 QueryStatistic::meanTime() const noexcept
+    {
+        return calls == 0 ? 0 : totalTime / calls;
+    }
+
+    /*! Sort order for the top query statistics. */
+    enum struct QueryStatisticsSort
+    {
+        /*! Sort by the total execution time. */
+        TotalTime,
+        /*! Sort by the mean execution time. */
+        MeanTime,
+        /*! Sort by the maximum execution time. */
+        MaxTime,
+        /*! Sort by the number of calls. */
+        Calls,
+        /*! Sort by the number of rows returned or affected. */
+        Rows,
+    };
+
+    /*! Normalized query statistics table (pg_stat_statements-style), queries are
+        grouped by the fingerprint, the number of tracked fingerprints is bounded,
+        the least executed fingerprints are evicted when the table is full. */
+    class SHAREDLIB_EXPORT QueryStatistics
+    {
+    public:
+        /*! Default maximum number of tracked fingerprints. */
+        constexpr static std::size_t DefaultMaxSize = 1000;
+
+        /*! Constructor. */
+        inline explicit QueryStatistics(std::size_t maxSize = DefaultMaxSize);
+
+        /*! Record the executed query (elapsed time in nanoseconds). */
+        void record(const QString &query, qint64 elapsed, qint64 rows);
+        /*! Remove all statistics. */
+        void clear();
+
+        /*! Get the top N statistics ordered by the given criteria (descending). */
+        QVector<QueryStatistic>
+        top(std::size_t count, QueryStatisticsSort sortBy = QueryStatisticsSort::TotalTime)
+        const;
+        /*! Get the statistic for the given query (the query will be normalized). */
+        std::optional<QueryStatistic> statistic(const QString &query) const;
+
+        /*! Get the number of tracked fingerprints. */
+        inline std::size_t size() const noexcept;
+        /*! Determine whether no query was recorded. */
+        inline bool isEmpty() const noexcept;
+        /*! Get the maximum number of tracked fingerprints. */
+        inline std::size_t maxSize() const noexcept;
+        /*! Set the maximum number of tracked fingerprints (evicts if needed). */
+        void setMaxSize(std::size_t maxSize);
+        /*! Get the number of evicted fingerprints. */
+        inline qint64 evictions() const noexcept;
+
+        /*! Normalize the given query, collapse whitespaces and replace literals,
+            placeholders, and lists of placeholders with the ? character. */
+        static QString fingerprint(const QString &query);
+
+    private:
+        /*! Evict the least executed fingerprints so the table has free space for
+            at least the given number of fingerprints. */
+        void evictLeastExecuted(std::size_t freeSpace);
+
+        /*! Statistics keyed by the fingerprint. */
+        QHash<QString, QueryStatistic> m_statistics {};
+        /*! Maximum number of tracked fingerprints. */
+        std::size_t m_maxSize;
+        /*! Number of evicted fingerprints. */
+        qint64 m_evictions = 0;
+    };
+
+    /* public */
+
+    QueryStatistics::QueryStatistics(const std::size_t maxSize)
+        : m_maxSize(std::max<std::size_t>(1, maxSize))
+    {}
+
+    std::size_t QueryStatistics::size() const noexcept
+    {
+        return static_cast<std::size_t>(m_statistics.size());
+    }
+
+    bool QueryStatistics::isEmpty() const noexcept
+    {
+        return m_statistics.isEmpty();
+    }
+
+    std::size_t QueryStatistics::maxSize() const noexcept
+    {
+        return m_maxSize;
+    }
+
+    qint64 QueryStatistics::evictions() const noexcept
+    {
+        return m_evictions;
+    }
+
+} // namespace Types
+
+    using QueryStatistic = Types::QueryStatistic;
+    using QueryStatistics = Types::QueryStatistics;
+    using QueryStatisticsSort = Types::QueryStatisticsSort;
+
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TYPES_QUERYSTATISTICS_HPP
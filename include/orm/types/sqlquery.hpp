@@ -7,6 +7,7 @@ TINY_SYSTEM_HEADER
 
 #include <QtSql/QSqlQuery>
 
+#include <memory>
 #include <optional>
 
 #include "orm/macros/export.hpp"
@@ -20,6 +21,10 @@ namespace Query::Grammars
 {
     class Grammar;
 }
+namespace Support
+{
+    class PreparedStatementsCache;
+}
 
 namespace Types
 {
@@ -54,6 +59,16 @@ namespace Types
         /*! Return the value of the field called name in the current record. */
         inline QVariant value(const QString &name) const;
 
+        /*! Release the result set and check in the prepared query to the statements
+            cache it was checked out from, this query is empty after that (nothing
+            happens if it wasn't checked out). */
+        void releaseStatement();
+        /*! Set the statements cache the prepared query is checked in to by
+            the releaseStatement() (used by the DatabaseConnection). */
+        inline void setStatementsCache(
+                std::weak_ptr<Support::PreparedStatementsCache> statementsCache,
+                QString queryString);
+
     private:
         /*! Common value() method that correctly handles QDateTime's time zone. */
         QVariant valueInternal(QVariant &&value) const;
@@ -80,6 +95,11 @@ namespace Types
         std::optional<QString> m_dateFormat;
         /*! Determine whether to return the QDateTime or QString (SQLite only). */
         std::optional<bool> m_returnQDateTime;
+
+        /*! Statements cache the prepared query was checked out from (if any). */
+        std::weak_ptr<Support::PreparedStatementsCache> m_statementsCache {};
+        /*! Query string used as the statements cache key. */
+        QString m_statementsCacheKey {};
     };
 
     /* public */
@@ -94,6 +114,14 @@ namespace Types
         return valueInternal(QSqlQuery::value(name));
     }
 
+    void SqlQuery::setStatementsCache(
+            std::weak_ptr<Support::PreparedStatementsCache> statementsCache,
+            QString queryString)
+    {
+        m_statementsCache = std::move(statementsCache);
+        m_statementsCacheKey = std::move(queryString);
+    }
+
 } // namespace Types
 
     using SqlQuery = Types::SqlQuery;
@@ -0,0 +1,36 @@
+#pragma once
+#ifndef ORM_TYPES_STATEMENTSCACHECOUNTER_HPP
+#define ORM_TYPES_STATEMENTSCACHECOUNTER_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QtGlobal>
+
+#include "orm/macros/commonnamespace.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+namespace Types
+{
+
+    /*! Prepared statements cache counter. */
+    struct StatementsCacheCounter
+    {
+        /*! Prepared queries obtained from the cache. */
+        qint64 hits = 0;
+        /*! Prepared queries that had to be prepared (and were cached). */
+        qint64 misses = 0;
+    };
+
+} // namespace Types
+
+    using StatementsCacheCounter = Types::StatementsCacheCounter;
+
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TYPES_STATEMENTSCACHECOUNTER_HPP
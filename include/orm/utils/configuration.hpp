@@ -7,14 +7,18 @@ TINY_SYSTEM_HEADER
 
 #include <QVariantHash>
 
+#include <optional>
+
 #include "orm/macros/commonnamespace.hpp"
 #include "orm/macros/export.hpp"
+#include "orm/types/connectionpoolconfig.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
 namespace Orm
 {
     struct QtTimeZoneConfig;
+    enum struct ReadStrategy;
 
 namespace Utils
 {
@@ -42,6 +46,21 @@ namespace Utils
         static QtTimeZoneConfig
         prepareQtTimeZone(const QVariant &qtTimeZone, const QString &connection);
 
+        /*! Prepare the statements_cache_size config. option (0 if not defined). */
+        static std::size_t
+        prepareStatementsCacheSize(const QVariantHash &config,
+                                   const QString &connection);
+        /*! Prepare the compiled_sql_cache_size config. option (0 if not defined). */
+        static std::size_t
+        prepareCompiledSqlCacheSize(const QVariantHash &config,
+                                    const QString &connection);
+        /*! Prepare the pool_xyz config. options (nullopt if the pool is disabled). */
+        static std::optional<ConnectionPoolConfig>
+        preparePoolConfig(const QVariantHash &config, const QString &connection);
+        /*! Prepare the read_strategy config. option (random if not defined). */
+        static ReadStrategy
+        prepareReadStrategy(const QVariantHash &config, const QString &connection);
+
         /* MySQL section */
         /*! Get a MySQL SSL-related options hash (for TLS connection). */
         static QVariantHash mysqlSslOptions();
@@ -66,6 +66,10 @@ namespace Orm::Utils
 
         /*! Returns the size of the result (number of rows returned). */
         static int queryResultSize(QSqlQuery &query);
+        /*! Returns the size of the result if the driver can report it, otherwise
+            the given limit (capped) or -1, never walks the result set so it also
+            works with forward-only results (ideal for the reserve). */
+        static int queryResultSizeHint(const QSqlQuery &query, int limit = -1);
     };
 
     /* public */
@@ -8,6 +8,12 @@ TINYORM_BEGIN_COMMON_NAMESPACE
 namespace Orm
 {
 
+namespace
+{
+    /*! The column or table alias separator. */
+    const auto AsTmpl = QStringLiteral(" as ");
+} // namespace
+
 /*
    wrap methods are only for column names, table names and identifiers, they use
    primarily Column type and QString type.
@@ -31,6 +37,11 @@ namespace Orm
    for parameter bindings (?) use parameter()/parametrize(), for column names use
    wrap() related methods and for quoting raw strings eg. in the schema use
    the quoteString(), all these methods support container types.
+
+   The xyzTo() methods (wrapTo(), columnizeTo(), parametrizeTo(), ...) append
+   the result to the given SQL buffer instead of returning a new string, they are used
+   by the query grammars to compile the whole query into one buffer, the methods
+   returning the QString only call them with their own buffer.
 */
 
 /* public */
@@ -42,14 +53,34 @@ const QString &BaseGrammar::getDateFormat() const
     return cachedFormat;
 }
 
-// NOLINTNEXTLINE(misc-no-recursion)
 QString BaseGrammar::wrap(const QString &value, const bool prefixAlias) const
+{
+    QString wrapped;
+    // Quotes of the table and column segments
+    wrapped.reserve(value.size() + 6);
+
+    wrapTo(wrapped, value, prefixAlias);
+
+    return wrapped;
+}
+
+QString BaseGrammar::wrap(const Column &value) const
+{
+    return std::holds_alternative<Expression>(value)
+            ? getValue(std::get<Expression>(value)).value<QString>()
+            : wrap(std::get<QString>(value));
+}
+
+void BaseGrammar::wrapTo(QString &sql, const QString &value,
+                         const bool prefixAlias) const
 {
     /* If the value being wrapped has a column alias we will need to separate out
        the pieces so we can wrap each of the segments of the expression on its
        own, and then join these both back together using the "as" connector. */
-    if (value.contains(QStringLiteral(" as ")))
-        return wrapAliasedValue(value, prefixAlias);
+    if (value.contains(AsTmpl)) {
+        wrapAliasedValueTo(sql, value, prefixAlias);
+        return;
+    }
 
     // FEATURE json columns, this code has to be in the Grammars::Grammar silverqx
     /* If the given value is a JSON selector we will wrap it differently than a
@@ -58,23 +89,47 @@ QString BaseGrammar::wrap(const QString &value, const bool prefixAlias) const
 //    if (isJsonSelector(value))
 //        return wrapJsonSelector(value);
 
-    return wrapSegments(value.split(DOT));
+    wrapSegmentsTo(sql, value);
 }
 
-QString BaseGrammar::wrap(const Column &value) const
+void BaseGrammar::wrapTo(QString &sql, const Column &value) const
 {
-    return std::holds_alternative<Expression>(value)
-            ? getValue(std::get<Expression>(value)).value<QString>()
-            : wrap(std::get<QString>(value));
+    if (std::holds_alternative<Expression>(value))
+        sql += getValue(std::get<Expression>(value)).value<QString>();
+    else
+        wrapTo(sql, std::get<QString>(value));
 }
 
-// NOLINTNEXTLINE(misc-no-recursion)
 QString BaseGrammar::wrapTable(const QString &table) const
 {
-    return wrap(NOSPACE.arg(m_tablePrefix, table), true);
+    QString wrapped;
+    wrapped.reserve(m_tablePrefix.size() + table.size() + 6);
+
+    wrapTableTo(wrapped, table);
+
+    return wrapped;
 }
 
 QString BaseGrammar::wrapTable(const FromClause &table) const
+{
+    if (std::holds_alternative<Expression>(table))
+        return getValue(std::get<Expression>(table)).value<QString>();
+
+    QString wrapped;
+    wrapTableTo(wrapped, table);
+
+    return wrapped;
+}
+
+void BaseGrammar::wrapTableTo(QString &sql, const QString &table) const
+{
+    if (m_tablePrefix.isEmpty())
+        wrapTo(sql, table, true);
+    else
+        wrapTo(sql, NOSPACE.arg(m_tablePrefix, table), true);
+}
+
+void BaseGrammar::wrapTableTo(QString &sql, const FromClause &table) const
 {
     if (std::holds_alternative<std::monostate>(table))
         // Not InvalidArgumentError because table argument was not passed by user
@@ -83,9 +138,9 @@ QString BaseGrammar::wrapTable(const FromClause &table) const
                 .arg(__tiny_func__));
 
     if (std::holds_alternative<Expression>(table))
-        return getValue(std::get<Expression>(table)).value<QString>();
-
-    return wrapTable(std::get<QString>(table));
+        sql += getValue(std::get<Expression>(table)).value<QString>();
+    else
+        wrapTableTo(sql, std::get<QString>(table));
 }
 
 QString BaseGrammar::quoteString(const QString &value)
@@ -145,43 +200,107 @@ QString BaseGrammar::parameter(const QVariant &value)
                                : QChar::fromLatin1('?');
 }
 
-// NOLINTNEXTLINE(misc-no-recursion)
-QString BaseGrammar::wrapAliasedValue(const QString &value, const bool prefixAlias) const
+void BaseGrammar::parameterTo(QString &sql, const QVariant &value)
 {
-    auto segments = getSegmentsFromFrom(value);
+    if (isExpression(value))
+        sql += getValue(value).value<QString>();
+    else
+        sql += QLatin1Char('?');
+}
+
+void BaseGrammar::wrapAliasedValueTo(QString &sql, const QStringView value,
+                                     const bool prefixAlias) const
+{
+    const auto asIndex = value.indexOf(AsTmpl, 0, Qt::CaseInsensitive);
+
+    Q_ASSERT(asIndex != -1);
+
+    // Remove leading/ending whitespaces
+    const auto column = value.left(asIndex).trimmed();
+    const auto alias = value.mid(asIndex + AsTmpl.size()).trimmed();
+
+    wrapSegmentsTo(sql, column);
+
+    sql += AsTmpl;
 
     /* If we are wrapping a table we need to prefix the alias with the table prefix
        as well in order to generate proper syntax. If this is a column of course
        no prefix is necessary. The condition will be true when from wrapTable. */
-    if (prefixAlias)
-        segments[1] = NOSPACE.arg(m_tablePrefix, segments[1]);
+    if (prefixAlias && !m_tablePrefix.isEmpty())
+        wrapValueTo(sql, NOSPACE.arg(m_tablePrefix, alias.toString()));
+    else
+        wrapValueTo(sql, alias);
+}
+
+QString BaseGrammar::wrapValue(const QString &value) const
+{
+    QString wrapped;
+    wrapped.reserve(value.size() + 2);
 
-    return QStringLiteral("%1 as %2").arg(wrap(segments.constFirst()),
-                                          wrapValue(segments[1]));
+    wrapValueTo(wrapped, value);
+
+    return wrapped;
+}
+
+void BaseGrammar::wrapValueTo(QString &sql, const QStringView value) const
+{
+    wrapValueWith(sql, value, QUOTE);
 }
 
-QString BaseGrammar::wrapValue(QString value) const
+void BaseGrammar::wrapValueWith(QString &sql, const QStringView value, const QChar quote)
 {
-    if (value == ASTERISK_C)
-        return value;
+    if (value.size() == 1 && value.front() == ASTERISK_C) {
+        sql += ASTERISK_C;
+        return;
+    }
+
+    sql += quote;
+
+    // Escape the quote characters by doubling them
+    QStringView::size_type from = 0;
+
+    for (auto index = value.indexOf(quote); index != -1;
+         index = value.indexOf(quote, from)
+    ) {
+        sql.append(value.mid(from, index - from + 1));
+        sql += quote;
 
-    return TMPL_DQUOTES.arg(value.replace(QUOTE, QStringLiteral("\"\"")));
+        from = index + 1;
+    }
+
+    sql.append(value.mid(from));
+
+    sql += quote;
 }
 
-// NOLINTNEXTLINE(misc-no-recursion)
-QString BaseGrammar::wrapSegments(QStringList segments) const
+void BaseGrammar::wrapSegmentsTo(QString &sql, const QStringView value) const
 {
-    const auto size = segments.size();
-    // eg table_name.column is qualified
-    const auto isQualifiedSegment = size > 1;
+    auto dotIndex = value.indexOf(DOT);
+
+    // Not qualified column or table name
+    if (dotIndex == -1) {
+        wrapValueTo(sql, value);
+        return;
+    }
+
+    // eg. table_name.column is qualified, the table name has to be prefixed
+    if (m_tablePrefix.isEmpty())
+        wrapValueTo(sql, value.left(dotIndex));
+    else
+        wrapValueTo(sql, NOSPACE.arg(m_tablePrefix, value.left(dotIndex).toString()));
+
+    // Remaining segments (schema.table.column has two remaining segments)
+    do {
+        const auto from = dotIndex + 1;
+
+        sql += DOT;
+
+        dotIndex = value.indexOf(DOT, from);
 
-    for (auto i = 0; i < size; ++i)
-        if (i == 0 && isQualifiedSegment)
-            segments[i] = wrapTable(segments[i]);
-        else
-            segments[i] = wrapValue(segments[i]);
+        wrapValueTo(sql, dotIndex == -1 ? value.mid(from)
+                                        : value.mid(from, dotIndex - from));
 
-    return segments.join(DOT);
+    } while (dotIndex != -1);
 }
 
 QStringList BaseGrammar::getSegmentsFromFrom(const QString &from)
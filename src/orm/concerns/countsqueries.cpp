@@ -109,6 +109,92 @@ DatabaseConnection &CountsQueries::resetStatementsCounter()
     return databaseConnection();
 }
 
+const StatementsCacheCounter &CountsQueries::getStatementsCacheCounter() const
+{
+    return m_statementsCacheCounter;
+}
+
+StatementsCacheCounter CountsQueries::takeStatementsCacheCounter()
+{
+    const auto counter = m_statementsCacheCounter;
+
+    m_statementsCacheCounter.hits   = 0;
+    m_statementsCacheCounter.misses = 0;
+
+    return counter;
+}
+
+DatabaseConnection &CountsQueries::resetStatementsCacheCounter()
+{
+    m_statementsCacheCounter.hits   = 0;
+    m_statementsCacheCounter.misses = 0;
+
+    return databaseConnection();
+}
+
+bool CountsQueries::countingLatency() const
+{
+    return m_countingLatency;
+}
+
+DatabaseConnection &CountsQueries::enableLatencyHistograms()
+{
+    m_countingLatency = true;
+
+    return databaseConnection();
+}
+
+DatabaseConnection &CountsQueries::disableLatencyHistograms()
+{
+    m_countingLatency = false;
+
+    m_latencyHistograms.reset();
+
+    return databaseConnection();
+}
+
+const LatencyHistograms &CountsQueries::getLatencyHistograms() const
+{
+    return m_latencyHistograms;
+}
+
+LatencyHistograms CountsQueries::takeLatencyHistograms()
+{
+    if (!m_countingLatency)
+        return {};
+
+    auto histograms = m_latencyHistograms;
+
+    m_latencyHistograms.reset();
+
+    return histograms;
+}
+
+DatabaseConnection &CountsQueries::resetLatencyHistograms()
+{
+    m_latencyHistograms.reset();
+
+    return databaseConnection();
+}
+
+/* protected */
+
+qint64 CountsQueries::hitElapsedCounters(const qint64 elapsedNs,
+                                         LatencyHistogram &latencyHistogram)
+{
+    const auto elapsed = elapsedNs / 1'000'000;
+
+    // Queries execution time counter
+    if (m_countingElapsed)
+        m_elapsedCounter += elapsed;
+
+    // Queries latency histogram
+    if (m_countingLatency)
+        latencyHistogram.record(elapsedNs);
+
+    return elapsed;
+}
+
 /* private */
 
 std::optional<qint64>
@@ -117,13 +203,10 @@ CountsQueries::hitTransactionalCounters(const QElapsedTimer timer,
 {
     std::optional<qint64> elapsed;
 
-    if (countElapsed) {
-        // Hit elapsed timer
-        elapsed = timer.elapsed();
-
-        // Queries execution time counter
-        m_elapsedCounter += *elapsed;
-    }
+    // Queries execution time counter / Queries latency histogram
+    if (countElapsed)
+        elapsed = hitElapsedCounters(timer.nsecsElapsed(),
+                                     m_latencyHistograms.transactional);
 
     // Query statements counter
     if (m_countingStatements)
@@ -4,8 +4,11 @@
 #  include <QDebug>
 #endif
 
+#include <algorithm>
+
 #include "orm/databaseconnection.hpp"
 #include "orm/macros/likely.hpp"
+#include "orm/support/querylogsink.hpp"
 #ifdef TINYORM_DEBUG_SQL
 #  include "orm/utils/query.hpp"
 #endif
@@ -32,7 +35,7 @@ void LogsQueries::logQueryForPretend(
 #endif
 {
     if (m_loggingQueries && m_queryLog)
-        m_queryLog->append({query, preparedBindings, Log::Type::NORMAL, ++m_queryLogId});
+        appendQueryLog({query, preparedBindings, Log::Type::NORMAL, ++m_queryLogId});
 
 #ifdef TINYORM_DEBUG_SQL
     // Debugging SQL queries is disabled
@@ -53,8 +56,8 @@ void LogsQueries::logTransactionQuery(
         const QString &query, const std::optional<qint64> elapsed) const
 {
     if (m_loggingQueries && m_queryLog)
-        m_queryLog->append({query, {}, Log::Type::TRANSACTION, ++m_queryLogId,
-                            elapsed ? *elapsed : -1});
+        appendQueryLog({query, {}, Log::Type::TRANSACTION, ++m_queryLogId,
+                        elapsed ? *elapsed : -1});
 
 #ifdef TINYORM_DEBUG_SQL
     // Debugging SQL queries is disabled
@@ -75,7 +78,7 @@ void LogsQueries::logTransactionQuery(
 void LogsQueries::logTransactionQueryForPretend(const QString &query) const
 {
     if (m_loggingQueries && m_queryLog)
-        m_queryLog->append({query, {}, Log::Type::TRANSACTION, ++m_queryLogId});
+        appendQueryLog({query, {}, Log::Type::TRANSACTION, ++m_queryLogId});
 
 #ifdef TINYORM_DEBUG_SQL
     // Debugging SQL queries is disabled
@@ -90,12 +93,27 @@ void LogsQueries::logTransactionQueryForPretend(const QString &query) const
 #endif
 }
 
+std::shared_ptr<QVector<Log>> LogsQueries::getQueryLog() const
+{
+    /* Rotate the ring buffer lazily, right before it is really needed, so the oldest
+       record is the first one. */
+    if (m_queryLog && m_queryLogHead != 0) {
+        std::rotate(m_queryLog->begin(), m_queryLog->begin() + m_queryLogHead,
+                    m_queryLog->end());
+
+        m_queryLogHead = 0;
+    }
+
+    return m_queryLog;
+}
+
 void LogsQueries::flushQueryLog()
 {
     // TODO sync silverqx
     if (m_queryLog)
         m_queryLog->clear();
 
+    m_queryLogHead = 0;
     m_queryLogId = 0;
 }
 
@@ -109,6 +127,58 @@ void LogsQueries::enableQueryLog()
     m_loggingQueries = true;
 }
 
+void LogsQueries::setQueryLogCapacity(const std::size_t capacity)
+{
+    m_queryLogCapacity = capacity;
+
+    // Nothing to do
+    if (!m_queryLog)
+        return;
+
+    // Order the query log from the oldest record
+    getQueryLog();
+
+    const auto size = static_cast<std::size_t>(m_queryLog->size());
+
+    // Keep the newest records
+    if (m_queryLogCapacity != 0 && size > m_queryLogCapacity)
+        m_queryLog->remove(0, static_cast<QVector<Log>::size_type>(
+                                  size - m_queryLogCapacity));
+}
+
+void LogsQueries::setQueryLogSink(std::shared_ptr<Support::QueryLogSink> sink) noexcept
+{
+    m_queryLogSink = std::move(sink);
+}
+
+QVector<QueryStatistic>
+LogsQueries::topQueryStatistics(const std::size_t count,
+                                const QueryStatisticsSort sortBy) const
+{
+    if (!m_queryStatistics)
+        return {};
+
+    return m_queryStatistics->top(count, sortBy);
+}
+
+void LogsQueries::flushQueryStatistics()
+{
+    if (m_queryStatistics)
+        m_queryStatistics->clear();
+}
+
+void LogsQueries::enableQueryStatistics(const std::size_t maxSize)
+{
+    /* Instantiate the queries statistics lazily, right before they are really needed,
+       and do not flush them. */
+    if (m_queryStatistics)
+        m_queryStatistics->setMaxSize(maxSize);
+    else
+        m_queryStatistics = std::make_shared<QueryStatistics>(maxSize);
+
+    m_collectingStatistics = true;
+}
+
 /* protected */
 
 QVector<Log>
@@ -119,7 +189,9 @@ LogsQueries::withFreshQueryLog(const std::function<QVector<Log>()> &callback)
        have a new log of all the queries that will be executed. */
     const auto loggingQueries = m_loggingQueries;
     const auto queryLogId = m_queryLogId.load();
+    const auto queryLogHead = m_queryLogHead;
     m_queryLogId.store(0);
+    m_queryLogHead = 0;
 
     enableQueryLog();
 
@@ -141,6 +213,7 @@ LogsQueries::withFreshQueryLog(const std::function<QVector<Log>()> &callback)
     m_queryLog.swap(m_queryLogForPretend);
     m_loggingQueries = loggingQueries;
     m_queryLogId.store(queryLogId);
+    m_queryLogHead = queryLogHead;
 
     // NRVO kicks in
     return result;
@@ -161,15 +234,16 @@ void LogsQueries::logQueryInternal(
         if (executedQuery.isEmpty())
             executedQuery = query.lastQuery();
 
-        m_queryLog->append({std::move(executedQuery),
+        // Bindings are not replaced in the query here, the log is formatted lazily
+        appendQueryLog({std::move(executedQuery),
 #if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
-                            query.boundValues(),
+                        query.boundValues(),
 #else
-                            convertNamedToPositionalBindings(query.boundValues()),
+                        convertNamedToPositionalBindings(query.boundValues()),
 #endif
-                            Log::Type::NORMAL, ++m_queryLogId,
-                            elapsed ? *elapsed : -1, query.size(),
-                            query.numRowsAffected()});
+                        Log::Type::NORMAL, ++m_queryLogId,
+                        elapsed ? *elapsed : -1, query.size(),
+                        query.numRowsAffected()});
     }
 
 #ifdef TINYORM_DEBUG_SQL
@@ -191,6 +265,32 @@ void LogsQueries::logQueryInternal(
 #endif
 }
 
+void LogsQueries::appendQueryLog(Log &&log) const
+{
+    // The pretend query log is unbounded and isn't drained to the sink
+    if (databaseConnection().pretending()) {
+        m_queryLog->append(std::move(log));
+        return;
+    }
+
+    // Formatting and the I/O are done in the sink thread
+    if (m_queryLogSink)
+        m_queryLogSink->push(databaseConnection().getName(), log);
+
+    if (m_queryLogCapacity == 0 ||
+        static_cast<std::size_t>(m_queryLog->size()) < m_queryLogCapacity
+    ) {
+        m_queryLog->append(std::move(log));
+        return;
+    }
+
+    // The query log is full, overwrite the oldest record
+    (*m_queryLog)[m_queryLogHead] = std::move(log);
+
+    if (++m_queryLogHead == m_queryLog->size())
+        m_queryLogHead = 0;
+}
+
 QVector<QVariant>
 LogsQueries::convertNamedToPositionalBindings(QVariantMap &&bindings)
 {
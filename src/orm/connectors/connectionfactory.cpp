@@ -21,12 +21,16 @@ namespace Orm::Connectors
 /* public */
 
 std::unique_ptr<DatabaseConnection>
-ConnectionFactory::make(QVariantHash &config, const ConnectionName &connection)
+ConnectionFactory::make(QVariantHash &config, const ConnectionName &connection,
+                        const ConnectionName &qtConnection)
 {
     // Parse and prepare the database configuration
     auto configCopy = parseConfiguration(config, connection);
 
-    return createSingleConnection(std::move(configCopy));
+    if (configCopy.contains(read_))
+        return createReadWriteConnection(config, connection, qtConnection);
+
+    return createSingleConnection(std::move(configCopy), qtConnection);
 }
 
 std::unique_ptr<ConnectorInterface>
@@ -70,20 +74,108 @@ ConnectionFactory::parseConfiguration(QVariantHash &config,
 }
 
 std::unique_ptr<DatabaseConnection>
-ConnectionFactory::createSingleConnection(QVariantHash &&config)
+ConnectionFactory::createSingleConnection(QVariantHash &&config,
+                                          const ConnectionName &qtConnection)
 {
     // The config[return_qdatetime] is guaranteed to have a value for SQLite connection
     auto returnQDateTime = config[driver_] == QSQLITE
                            ? std::make_optional(config[return_qdatetime].value<bool>())
                            : std::nullopt;
 
+    /* The QSqlDatabase connection name can differ from the TinyORM connection name,
+       the getName() must always return the TinyORM connection name. */
+    std::function<ConnectionName()> resolver;
+
+    if (qtConnection.isEmpty())
+        resolver = createQSqlDatabaseResolver(config);
+    else {
+        auto qtConfig = config;
+        qtConfig[NAME] = qtConnection;
+
+        resolver = createQSqlDatabaseResolver(qtConfig);
+    }
+
     return createConnection(
-                config[driver_].value<QString>(), createQSqlDatabaseResolver(config),
+                config[driver_].value<QString>(), std::move(resolver),
                 config[database_].value<QString>(), config[prefix_].value<QString>(),
                 config[qt_timezone].value<QtTimeZoneConfig>(),
                 std::move(config), std::move(returnQDateTime));
 }
 
+std::unique_ptr<DatabaseConnection>
+ConnectionFactory::createReadWriteConnection(
+        const QVariantHash &config, const ConnectionName &connection,
+        const ConnectionName &qtConnection)
+{
+    /* The read and write configurations are merged with the original configuration
+       and parsed separately, so they can override any configuration option. */
+    auto writeConfig = getWriteConfig(config);
+    auto readConfig  = getReadConfig(config);
+
+    auto connection_ = createSingleConnection(
+                           parseConfiguration(writeConfig, connection), qtConnection);
+
+    connection_->setReadQtConnectionResolvers(
+                createReadQSqlDatabaseResolvers(
+                    parseConfiguration(readConfig, connection), qtConnection));
+
+    return connection_;
+}
+
+std::vector<std::function<ConnectionName()>>
+ConnectionFactory::createReadQSqlDatabaseResolvers(const QVariantHash &config,
+                                                   const ConnectionName &qtConnection)
+{
+    const auto qtConnectionName = qtConnection.isEmpty()
+                                  ? config[NAME].value<QString>()
+                                  : qtConnection;
+
+    const auto hasHosts = config.contains(host_);
+    // The SQLite connection doesn't have any host, it has only one read connection
+    const auto hosts = hasHosts ? parseHosts(config) : QStringList {EMPTY};
+
+    std::vector<std::function<ConnectionName()>> resolvers;
+    resolvers.reserve(static_cast<std::size_t>(hosts.size()));
+
+    for (QStringList::size_type index = 0; index < hosts.size(); ++index) {
+        auto readConfig = config;
+
+        readConfig[NAME] = QStringLiteral("%1-read-%2").arg(qtConnectionName)
+                                                       .arg(index + 1);
+        if (hasHosts)
+            readConfig[host_] = hosts.at(index);
+
+        resolvers.emplace_back(createQSqlDatabaseResolver(readConfig));
+    }
+
+    return resolvers;
+}
+
+QVariantHash ConnectionFactory::getReadConfig(const QVariantHash &config)
+{
+    return mergeReadWriteConfig(config, config.value(read_).value<QVariantHash>());
+}
+
+QVariantHash ConnectionFactory::getWriteConfig(const QVariantHash &config)
+{
+    return mergeReadWriteConfig(config, config.value(write_).value<QVariantHash>());
+}
+
+QVariantHash
+ConnectionFactory::mergeReadWriteConfig(const QVariantHash &config,
+                                        const QVariantHash &merge)
+{
+    auto mergedConfig = config;
+
+    mergedConfig.remove(read_);
+    mergedConfig.remove(write_);
+
+    for (auto itOption = merge.constBegin(); itOption != merge.constEnd(); ++itOption)
+        mergedConfig.insert(itOption.key(), itOption.value());
+
+    return mergedConfig;
+}
+
 std::function<ConnectionName()>
 ConnectionFactory::createQSqlDatabaseResolver(const QVariantHash &config)
 {
@@ -101,7 +193,7 @@ ConnectionFactory::createQSqlDatabaseResolverWithHosts(const QVariantHash &confi
         const auto hosts = parseHosts(config);
         std::exception_ptr lastException;
 
-        // FUTURE add support for multiple hosts and connect randomly to one of them, in this step have to take into account also the sticky config paramater silverqx
+        // FUTURE add support for multiple hosts and connect randomly to one of them, read hosts are split to separate read connections in the createReadQSqlDatabaseResolvers() silverqx
         /* This for statement do nothing for now, it purpose is to randomly
            shuffle hosts and try to connect to them one be one, until the connection
            will be successful. */
@@ -105,6 +105,20 @@ namespace Orm::Constants
     const QString application_name        = QStringLiteral("application_name");
     const QString synchronous_commit      = QStringLiteral("synchronous_commit");
     const QString spatial_ref_sys         = QStringLiteral("spatial_ref_sys");
+    const QString statements_cache_size   = QStringLiteral("statements_cache_size");
+    const QString compiled_sql_cache_size = QStringLiteral("compiled_sql_cache_size");
+    const QString eager_load_any_array    = QStringLiteral("eager_load_any_array");
+    const QString pool_min_size           = QStringLiteral("pool_min_size");
+    const QString pool_max_size           = QStringLiteral("pool_max_size");
+    const QString pool_idle_timeout       = QStringLiteral("pool_idle_timeout");
+    const QString pool_wait_timeout       = QStringLiteral("pool_wait_timeout");
+    const QString pool_validate           = QStringLiteral("pool_validate");
+    const QString read_                   = QStringLiteral("read");
+    const QString write_                  = QStringLiteral("write");
+    const QString sticky_                 = QStringLiteral("sticky");
+    const QString read_strategy           = QStringLiteral("read_strategy");
+    const QString random_                 = QStringLiteral("random");
+    const QString round_robin             = QStringLiteral("round_robin");
 
     const QString H127001   = QStringLiteral("127.0.0.1");
     const QString LOCALHOST = QStringLiteral("localhost");
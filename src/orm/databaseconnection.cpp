@@ -4,11 +4,19 @@
 #  include <QDebug>
 #endif
 
+#include <QRandomGenerator>
 #include <QtSql/QSqlRecord>
 
+#include <algorithm>
+#include <atomic>
+#include <limits>
+
+#include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/exceptions/logicerror.hpp"
 #include "orm/exceptions/multiplecolumnsselectederror.hpp"
 #include "orm/query/querybuilder.hpp"
 #include "orm/utils/configuration.hpp"
+#include "orm/utils/query.hpp"
 #include "orm/utils/type.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
@@ -16,6 +24,7 @@ TINYORM_BEGIN_COMMON_NAMESPACE
 using Orm::Utils::Helpers;
 
 using ConfigUtils = Orm::Utils::Configuration;
+using QueryUtils = Orm::Utils::Query;
 
 namespace Orm
 {
@@ -53,6 +62,11 @@ DatabaseConnection::DatabaseConnection(
     , m_config(std::move(config))
     , m_connectionName(getConfig(NAME).value<QString>())
     , m_hostName(getConfig(host_).value<QString>())
+    , m_statementsCache(std::make_shared<Support::PreparedStatementsCache>(
+                            ConfigUtils::prepareStatementsCacheSize(m_config,
+                                                                    m_connectionName)))
+    , m_readStrategy(ConfigUtils::prepareReadStrategy(m_config, m_connectionName))
+    , m_sticky(getConfig(sticky_).value<bool>())
 {}
 
 DatabaseConnection::DatabaseConnection(
@@ -69,6 +83,11 @@ DatabaseConnection::DatabaseConnection(
     , m_config(std::move(config))
     , m_connectionName(getConfig(NAME).value<QString>())
     , m_hostName(getConfig(host_).value<QString>())
+    , m_statementsCache(std::make_shared<Support::PreparedStatementsCache>(
+                            ConfigUtils::prepareStatementsCacheSize(m_config,
+                                                                    m_connectionName)))
+    , m_readStrategy(ConfigUtils::prepareReadStrategy(m_config, m_connectionName))
+    , m_sticky(getConfig(sticky_).value<bool>())
 {}
 
 std::shared_ptr<QueryBuilder>
@@ -106,19 +125,25 @@ std::shared_ptr<QueryBuilder> DatabaseConnection::query()
 
 SqlQuery
 DatabaseConnection::select(const QString &queryString,
-                           const QVector<QVariant> &bindings)
+                           const QVector<QVariant> &bindings,
+                           const bool useReadConnection)
 {
+    /* Select the read connection outside of the run() method, so the query will be
+       re-run on the same read connection if the connection was lost. */
+    auto *const readConnection = selectReadConnection(useReadConnection);
+
     auto queryResult = run<QSqlQuery>(
                            queryString, bindings, Prepared,
-                           [this](const QString &queryString_,
-                                  const QVector<QVariant> &preparedBindings)
+                           [this, readConnection]
+                           (const QString &queryString_,
+                            const QVector<QVariant> &preparedBindings)
                            -> QSqlQuery
     {
         if (m_pretending)
             return getQtQueryForPretend();
 
         // Prepare QSqlQuery
-        auto query = prepareQuery(queryString_);
+        auto query = prepareQuery(queryString_, false, readConnection);
 
         bindValues(query, preparedBindings);
 
@@ -139,14 +164,65 @@ DatabaseConnection::select(const QString &queryString,
                     query, preparedBindings);
     });
 
-    return {std::move(queryResult), m_qtTimeZone, *m_queryGrammar, m_returnQDateTime};
+    SqlQuery result(std::move(queryResult), m_qtTimeZone, *m_queryGrammar,
+                    m_returnQDateTime);
+
+    // The result set is consumed by the caller, it's checked in on the release
+    checkInQueryOnRelease(result, queryString, readConnection);
+
+    return result;
+}
+
+Cursor<>
+DatabaseConnection::cursor(const QString &queryString,
+                           const QVector<QVariant> &bindings,
+                           const bool useReadConnection)
+{
+    // Select the read connection outside of the run() method, look at the select()
+    auto *const readConnection = selectReadConnection(useReadConnection);
+
+    auto queryResult = run<QSqlQuery>(
+                           queryString, bindings, Prepared,
+                           [this, readConnection]
+                           (const QString &queryString_,
+                            const QVector<QVariant> &preparedBindings)
+                           -> QSqlQuery
+    {
+        if (m_pretending)
+            return getQtQueryForPretend();
+
+        // Prepare the forward-only QSqlQuery
+        auto query = prepareQuery(queryString_, true, readConnection);
+
+        bindValues(query, preparedBindings);
+
+        if (query.exec()) {
+            // Query statements counter
+            if (m_countingStatements)
+                ++m_statementsCounter.normal;
+
+            return query;
+        }
+
+        /* If an error occurs when attempting to run a query, we'll transform it
+           to the exception QueryError(), which formats the error message to
+           include the bindings with SQL, which will make this exception a lot
+           more helpful to the developer instead of just the database's errors. */
+        throw Exceptions::QueryError(
+                    "Select statement in DatabaseConnection::cursor() failed.",
+                    query, preparedBindings);
+    });
+
+    return Cursor<>({std::move(queryResult), m_qtTimeZone, *m_queryGrammar,
+                     m_returnQDateTime});
 }
 
 SqlQuery
 DatabaseConnection::selectOne(const QString &queryString,
-                              const QVector<QVariant> &bindings)
+                              const QVector<QVariant> &bindings,
+                              const bool useReadConnection)
 {
-    auto query = select(queryString, bindings);
+    auto query = select(queryString, bindings, useReadConnection);
 
     query.first();
 
@@ -154,20 +230,28 @@ DatabaseConnection::selectOne(const QString &queryString,
 }
 
 QVariant
-DatabaseConnection::scalar(const QString &queryString, const QVector<QVariant> &bindings)
+DatabaseConnection::scalar(const QString &queryString, const QVector<QVariant> &bindings,
+                           const bool useReadConnection)
 {
-    const auto query = selectOne(queryString, bindings);
+    auto query = selectOne(queryString, bindings, useReadConnection);
 
     // Nothing to do, the query should be positioned on the first row/record
-    if (!query.isValid())
+    if (!query.isValid()) {
+        query.releaseStatement();
         return {};
+    }
 
     if (const auto count = query.record().count();
         count > 1
     )
         throw Exceptions::MultipleColumnsSelectedError(count, __tiny_func__);
 
-    return query.value(0);
+    auto value = query.value(0);
+
+    // The result set is consumed, the next scalar() re-uses the prepared query
+    query.releaseStatement();
+
+    return value;
 }
 
 SqlQuery DatabaseConnection::statement(const QString &queryString,
@@ -194,6 +278,9 @@ SqlQuery DatabaseConnection::statement(const QString &queryString,
 
             recordsHaveBeenModified();
 
+            // Cached prepared statements may be invalid after the schema change
+            flushStatementsCacheIfDdl(queryString_);
+
             return query;
         }
 
@@ -207,48 +294,31 @@ SqlQuery DatabaseConnection::statement(const QString &queryString,
                     query, preparedBindings);
     });
 
-    return {std::move(queryResult), m_qtTimeZone, *m_queryGrammar, m_returnQDateTime};
+    SqlQuery result(std::move(queryResult), m_qtTimeZone, *m_queryGrammar,
+                    m_returnQDateTime);
+
+    // The DDL query has flushed the cache, it's not worth caching anyway
+    if (m_statementsCache->isEnabled() && !isDdlQuery(queryString))
+        checkInQueryOnRelease(result, queryString);
+
+    return result;
 }
 
 std::tuple<int, QSqlQuery>
 DatabaseConnection::affectingStatement(const QString &queryString,
                                        const QVector<QVariant> &bindings)
 {
-    return run<std::tuple<int, QSqlQuery>>(
-               queryString, bindings, Prepared,
-               [this](const QString &queryString_,
-                      const QVector<QVariant> &preparedBindings)
-               -> std::tuple<int, QSqlQuery>
-    {
-        if (m_pretending)
-            return {-1, getQtQueryForPretend()};
-
-        // Prepare QSqlQuery
-        auto query = prepareQuery(queryString_);
-
-        bindValues(query, preparedBindings);
-
-        if (query.exec()) {
-            // Affecting statements counter
-            if (m_countingStatements)
-                ++m_statementsCounter.affecting;
+    auto result = runAffectingStatement(queryString, bindings);
 
-            auto numRowsAffected = query.numRowsAffected();
-
-            recordsHaveBeenModified(numRowsAffected > 0);
+    // The DDL query has flushed the cache, it's not worth caching anyway
+    if (m_pretending || !m_statementsCache->isEnabled() || isDdlQuery(queryString))
+        return result;
 
-            return {numRowsAffected, query};
-        }
+    /* The number of affected rows was already read, so the prepared query is checked
+       in right away and the empty query is returned instead. */
+    checkInQuery(std::move(std::get<1>(result)), queryString);
 
-        /* If an error occurs when attempting to run a query, we'll transform it
-           to the exception QueryError(), which formats the error message to
-           include the bindings with SQL, which will make this exception a lot
-           more helpful to the developer instead of just the database's errors. */
-        throw Exceptions::QueryError(
-                    "Affecting statement in DatabaseConnection::affectingStatement() "
-                    "failed.",
-                    query, preparedBindings);
-    });
+    return {std::get<0>(result), QSqlQuery()};
 }
 
 SqlQuery DatabaseConnection::unprepared(const QString &queryString)
@@ -272,6 +342,9 @@ SqlQuery DatabaseConnection::unprepared(const QString &queryString)
 
             recordsHaveBeenModified();
 
+            // Cached prepared statements may be invalid after the schema change
+            flushStatementsCacheIfDdl(queryString_);
+
             return query;
         }
 
@@ -287,6 +360,179 @@ SqlQuery DatabaseConnection::unprepared(const QString &queryString)
     return {std::move(queryResult), m_qtTimeZone, *m_queryGrammar, m_returnQDateTime};
 }
 
+/* Batched statements */
+
+QVector<BatchResult>
+DatabaseConnection::batch(const QVector<BatchStatement> &statements)
+{
+    // Nothing to do
+    if (statements.isEmpty())
+        return {};
+
+    /* All statements share a single transaction (one commit instead of the commit
+       after every statement), the active transaction is used if there is one. */
+    const auto ownTransaction = !m_pretending && !inTransaction();
+
+    if (ownTransaction)
+        beginTransaction();
+
+    try {
+        auto results = runBatch(statements);
+
+        if (ownTransaction)
+            commit();
+
+        return results;
+
+    } catch (...) {
+
+        if (ownTransaction)
+            rollBack();
+        // Re-throw
+        throw;
+    }
+}
+
+quint64 DatabaseConnection::execBatch(const QString &queryString,
+                                      const QVector<QVariantList> &values,
+                                      const std::size_t batchSize)
+{
+    const auto rowsCount = batchRowsCount(values);
+
+    // Nothing to do
+    if (rowsCount == 0)
+        return 0;
+
+    const auto chunkSize = std::max<std::size_t>(1, batchSize);
+
+    /* All chunks share a single transaction, the active transaction is used
+       if there is one. */
+    const auto ownTransaction = !m_pretending && !inTransaction();
+
+    if (ownTransaction)
+        beginTransaction();
+
+    try {
+        // Memory stays flat, only the current chunk of values is prepared
+        for (std::size_t offset = 0; offset < rowsCount; offset += chunkSize)
+            runExecBatch(queryString, values, offset,
+                         std::min(chunkSize, rowsCount - offset));
+
+        if (ownTransaction)
+            commit();
+
+        return rowsCount;
+
+    } catch (...) {
+
+        if (ownTransaction)
+            rollBack();
+        // Re-throw
+        throw;
+    }
+}
+
+/* Bulk load */
+
+quint64 DatabaseConnection::bulkLoad(
+        const QString &table, const QVector<QString> &columns,
+        const BulkLoadRowSource &rowSource)
+{
+    if (table.isEmpty() || columns.isEmpty())
+        throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The table and columns can't be empty in %1().")
+                .arg(__tiny_func__));
+
+    /* All rows are loaded in a single transaction (one commit instead of the commit
+       after every row), the active transaction is used if there is one. */
+    const auto ownTransaction = !m_pretending && !inTransaction();
+
+    if (ownTransaction)
+        beginTransaction();
+
+    try {
+        const auto loaded = runBulkLoad(table, columns, rowSource);
+
+        if (ownTransaction)
+            commit();
+
+        return loaded;
+
+    } catch (...) {
+
+        if (ownTransaction)
+            rollBack();
+        // Re-throw
+        throw;
+    }
+}
+
+/* Asynchronous queries */
+
+QFuture<QVector<QSqlRecord>>
+DatabaseConnection::selectAsync(const QString &queryString,
+                                const QVector<QVariant> &bindings,
+                                const bool useReadConnection)
+{
+    return selectAsync<QVector<QSqlRecord>>(queryString, bindings, useReadConnection,
+                                            [](SqlQuery &result)
+    {
+        QVector<QSqlRecord> records;
+
+        if (const auto sizeHint = QueryUtils::queryResultSizeHint(result);
+            sizeHint > 0
+        )
+            records.reserve(sizeHint);
+
+        /* The QSqlQuery can't leave the worker thread, so materialize all rows, values
+           are obtained using the SqlQuery::value() to correctly convert time zones. */
+        while (result.next()) {
+            auto record = result.record();
+
+            for (int i = 0; i < record.count(); ++i)
+                record.setValue(i, result.value(i));
+
+            records << std::move(record);
+        }
+
+        return records;
+    });
+}
+
+QFuture<int>
+DatabaseConnection::statementAsync(const QString &queryString,
+                                   const QVector<QVariant> &bindings)
+{
+    return runAsync<int>([queryString, bindings](DatabaseConnection &connection)
+    {
+        return connection.statement(queryString, bindings).numRowsAffected();
+    });
+}
+
+std::size_t DatabaseConnection::pendingAsyncQueries() const
+{
+    // Nothing to do, no asynchronous query was executed yet
+    if (!m_asyncWorker)
+        return 0;
+
+    return m_asyncWorker->pending();
+}
+
+void DatabaseConnection::waitForAsyncQueries()
+{
+    if (m_asyncWorker)
+        m_asyncWorker->waitForDone();
+}
+
+DatabaseConnection &
+DatabaseConnection::setAsyncConnectionFactory(
+        Support::AsyncQueryWorker::FactoryType &&factory)
+{
+    m_asyncConnectionFactory = std::move(factory);
+
+    return *this;
+}
+
 /* Obtain connection instance */
 
 QSqlDatabase DatabaseConnection::getQtConnection()
@@ -342,6 +588,12 @@ DatabaseConnection::setQtConnectionResolver(
     m_qtConnection.reset();
     m_qtConnectionResolver = resolver;
 
+    // Prepared statements are bound to the previous connection
+    resetStatementsCache(m_statementsCache);
+
+    // Read connections will be also resolved again lazily
+    resetReadConnections();
+
     return *this;
 }
 
@@ -350,11 +602,102 @@ QSqlQuery DatabaseConnection::getQtQuery()
     return QSqlQuery(getQtConnection());
 }
 
-// TODO perf, modify bindings directly and return reference, debug impact silverqx
+/* Prepared statements cache */
+
+DatabaseConnection &DatabaseConnection::setStatementsCacheSize(const std::size_t size)
+{
+    m_statementsCache->setCapacity(size);
+
+    for (auto &readConnection : m_readConnections)
+        readConnection.statementsCache->setCapacity(size);
+
+    return *this;
+}
+
+DatabaseConnection &DatabaseConnection::flushStatementsCache()
+{
+    resetStatementsCache(m_statementsCache);
+
+    for (auto &readConnection : m_readConnections)
+        resetStatementsCache(readConnection.statementsCache);
+
+    return *this;
+}
+
+/* Read/write connections */
+
+DatabaseConnection &
+DatabaseConnection::setReadQtConnectionResolvers(
+        std::vector<std::function<Connectors::ConnectionName()>> &&resolvers)
+{
+    m_readConnections.clear();
+    m_nextReadConnection = 0;
+
+    for (auto &resolver : resolvers)
+        m_readConnections.emplace_back(std::move(resolver),
+                                       m_statementsCache->capacity());
+
+    return *this;
+}
+
+QStringList DatabaseConnection::getReadQtConnectionNames() const
+{
+    QStringList names;
+    names.reserve(static_cast<QStringList::size_type>(m_readConnections.size()));
+
+    for (const auto &readConnection : m_readConnections)
+        if (readConnection.qtConnection)
+            names << *readConnection.qtConnection;
+
+    return names;
+}
+
+bool DatabaseConnection::shouldUseReadConnection() const
+{
+    // Nothing to balance
+    if (m_readConnections.empty())
+        return false;
+
+    // The transaction is always started on the write connection
+    if (inTransaction())
+        return false;
+
+    /* Read the records that have been modified by this connection back from the write
+       connection, the replication can be delayed. This state is reset using
+       the forgetRecordModificationState() method (eg. at the end of a request). */
+    return !(m_sticky && m_recordsModified);
+}
+
 QVector<QVariant>
 DatabaseConnection::prepareBindings(QVector<QVariant> bindings) const
 {
-    for (auto &binding : bindings) {
+    // Only the date bindings are converted
+    const auto isDateBinding = [](const QVariant &binding)
+    {
+        if (!binding.isValid() || binding.isNull())
+            return false;
+
+        const auto typeId = Helpers::qVariantTypeId(binding);
+
+        return typeId == QMetaType::QDate || typeId == QMetaType::QDateTime;
+    };
+
+    /* Find the first binding to convert using the const iterators, so the implicitly
+       shared bindings are not detached (copied) if there is nothing to convert. */
+    const auto itFirst = std::find_if(bindings.cbegin(), bindings.cend(),
+                                      isDateBinding);
+
+    // Nothing to convert
+    if (itFirst == bindings.cend())
+        return bindings;
+
+    const auto firstIndex = std::distance(bindings.cbegin(), itFirst);
+
+    for (auto itBinding = bindings.begin() + firstIndex; itBinding != bindings.end();
+         ++itBinding
+    ) {
+        auto &binding = *itBinding;
+
         // Nothing to convert
         if (!binding.isValid() || binding.isNull())
             continue;
@@ -423,6 +766,19 @@ void DatabaseConnection::reconnect() const
 
 void DatabaseConnection::disconnect()
 {
+    /* Cached prepared statements are invalidated by the close() below, they would be
+       invalid anyway if the connection was already closed. */
+    resetStatementsCache(m_statementsCache);
+
+    // Close read connections, their connection resolvers are still valid
+    for (const auto &readConnection : m_readConnections)
+        if (readConnection.qtConnection &&
+            QSqlDatabase::contains(*readConnection.qtConnection)
+        )
+            QSqlDatabase::database(*readConnection.qtConnection, false).close();
+
+    resetReadConnections();
+
     // Nothing to disconnect
     if (!m_qtConnection)
         return;
@@ -565,6 +921,9 @@ DatabaseConnection::pretend(const std::function<void(DatabaseConnection &)> &cal
 void DatabaseConnection::useDefaultQueryGrammar()
 {
     m_queryGrammar = getDefaultQueryGrammar();
+
+    m_queryGrammar->setCompiledSqlCacheSize(
+                ConfigUtils::prepareCompiledSqlCacheSize(m_config, m_connectionName));
 }
 
 void DatabaseConnection::useDefaultSchemaGrammar()
@@ -600,21 +959,336 @@ void DatabaseConnection::reconnectIfMissingConnection() const
     reconnect();
 }
 
+std::tuple<int, QSqlQuery>
+DatabaseConnection::runAffectingStatement(const QString &queryString,
+                                          const QVector<QVariant> &bindings)
+{
+    return run<std::tuple<int, QSqlQuery>>(
+               queryString, bindings, Prepared,
+               [this](const QString &queryString_,
+                      const QVector<QVariant> &preparedBindings)
+               -> std::tuple<int, QSqlQuery>
+    {
+        if (m_pretending)
+            return {-1, getQtQueryForPretend()};
+
+        // Prepare QSqlQuery
+        auto query = prepareQuery(queryString_);
+
+        bindValues(query, preparedBindings);
+
+        if (query.exec()) {
+            // Affecting statements counter
+            if (m_countingStatements)
+                ++m_statementsCounter.affecting;
+
+            auto numRowsAffected = query.numRowsAffected();
+
+            recordsHaveBeenModified(numRowsAffected > 0);
+
+            return {numRowsAffected, std::move(query)};
+        }
+
+        /* If an error occurs when attempting to run a query, we'll transform it
+           to the exception QueryError(), which formats the error message to
+           include the bindings with SQL, which will make this exception a lot
+           more helpful to the developer instead of just the database's errors. */
+        throw Exceptions::QueryError(
+                    "Affecting statement in DatabaseConnection::affectingStatement() "
+                    "failed.",
+                    query, preparedBindings);
+    });
+}
+
+QVector<BatchResult>
+DatabaseConnection::runBatch(const QVector<BatchStatement> &statements)
+{
+    QVector<BatchResult> results;
+    results.reserve(statements.size());
+
+    // Repeated statements re-use the cached prepared statement (if enabled)
+    for (const auto &[queryString, bindings] : statements) {
+        auto [affected, query] = runAffectingStatement(queryString, bindings);
+
+        results.append({affected, query.lastInsertId()});
+
+        // The DDL query has flushed the cache, it's not worth caching anyway
+        if (!isDdlQuery(queryString))
+            checkInQuery(std::move(query), queryString);
+    }
+
+    return results;
+}
+
+quint64 DatabaseConnection::runBulkLoad(
+        const QString &table, const QVector<QString> &columns,
+        const BulkLoadRowSource &rowSource)
+{
+    return runBulkInsert(table, columns, rowSource, 1);
+}
+
+quint64 DatabaseConnection::runBulkInsert(
+        const QString &table, const QVector<QString> &columns,
+        const BulkLoadRowSource &rowSource, const std::size_t chunkSize)
+{
+    const auto &grammar = getQueryGrammar();
+    const auto queryString = grammar.compileBulkInsert(table, columns, chunkSize);
+    quint64 loaded = 0;
+
+    // Logged and counted as one query, rows are bound to the same prepared statement
+    auto result = run<std::tuple<int, QSqlQuery>>(
+                queryString, {}, Prepared,
+                [this, &grammar, &table, &columns, &rowSource, chunkSize, &loaded]
+                (const QString &queryString_, const QVector<QVariant> &/*unused*/)
+                -> std::tuple<int, QSqlQuery>
+    {
+        // Nothing to load, rows are not even consumed
+        if (m_pretending)
+            return {-1, getQtQueryForPretend()};
+
+        QVector<QVariant> bindings;
+        bindings.reserve(columns.size() *
+                         static_cast<QVector<QVariant>::size_type>(chunkSize));
+
+        auto executed = 0;
+
+        const auto execute = [this, &bindings, &executed](QSqlQuery &query)
+        {
+            bindValues(query, prepareBindings(bindings));
+
+            if (!query.exec())
+                throw Exceptions::QueryError(
+                            "Bulk insert in DatabaseConnection::runBulkInsert() "
+                            "failed.",
+                            query, bindings);
+
+            bindings.clear();
+            ++executed;
+        };
+
+        auto query = prepareQuery(queryString_);
+        std::size_t rows = 0;
+
+        while (auto row = std::invoke(rowSource)) {
+            if (row->size() != columns.size())
+                throw Exceptions::InvalidArgumentError(
+                        QStringLiteral("The row has %1 values but %2 columns were "
+                                       "given in %3().")
+                        .arg(row->size()).arg(columns.size()).arg(__tiny_func__));
+
+            bindings << *row;
+
+            // Wait for the full chunk
+            if (++rows < chunkSize)
+                continue;
+
+            execute(query);
+
+            loaded += rows;
+            rows = 0;
+        }
+
+        // The last partial chunk needs its own statement
+        if (rows > 0) {
+            const auto lastQueryString = grammar.compileBulkInsert(table, columns,
+                                                                   rows);
+            /* Prepared outside of the statements cache, the row count varies, so
+               it's never checked in and it must not count as a cache miss. */
+            auto lastQuery = getQtQuery();
+            lastQuery.prepare(lastQueryString);
+
+            execute(lastQuery);
+
+            loaded += rows;
+        }
+
+        // Affecting statements counter
+        if (m_countingStatements)
+            m_statementsCounter.affecting += executed;
+
+        recordsHaveBeenModified(loaded > 0);
+
+        // The number of affected rows is logged, it's saturated for huge loads
+        const auto affected = std::min<quint64>(loaded,
+                                                std::numeric_limits<int>::max());
+
+        return {static_cast<int>(affected), std::move(query)};
+    });
+
+    // Re-use the full chunk statement by the next bulk insert
+    checkInQuery(std::move(std::get<1>(result)), queryString);
+
+    return loaded;
+}
+
+std::size_t DatabaseConnection::bulkInsertChunkSize(const std::size_t columnsCount)
+{
+    /* The PostgreSQL and MySQL allow 65535 bind parameters in a single statement,
+       longer statements don't make the load faster. */
+    constexpr static std::size_t MaxBindings = 65535;
+    constexpr static std::size_t MaxRows = 1000;
+
+    const auto maxRows = MaxBindings / std::max<std::size_t>(1, columnsCount);
+
+    return std::clamp<std::size_t>(maxRows, 1, MaxRows);
+}
+
 /* private */
 
-QSqlQuery DatabaseConnection::prepareQuery(const QString &queryString)
+DatabaseConnection::ReadConnection *
+DatabaseConnection::selectReadConnection(const bool useReadConnection)
+{
+    if (!useReadConnection || !shouldUseReadConnection())
+        return nullptr;
+
+    const auto size = m_readConnections.size();
+
+    // Nothing to select
+    if (size == 1)
+        return &m_readConnections.front();
+
+    if (m_readStrategy == ReadStrategy::RoundRobin) {
+        auto &readConnection = m_readConnections[m_nextReadConnection % size];
+
+        m_nextReadConnection = (m_nextReadConnection + 1) % size;
+
+        return &readConnection;
+    }
+
+    return &m_readConnections[QRandomGenerator::global()->bounded(
+                                  static_cast<quint32>(size))];
+}
+
+QSqlDatabase DatabaseConnection::getReadQtConnection(ReadConnection &readConnection)
+{
+    auto &qtConnection = readConnection.qtConnection;
+
+    if (!qtConnection) {
+        // Resolve lazily, the read connection is connected during the first select
+        qtConnection = std::invoke(readConnection.resolver);
+
+        if (!QSqlDatabase::contains(*qtConnection))
+            throw Exceptions::RuntimeError(
+                    QStringLiteral("QSqlDatabase does not contain '%1' connection.")
+                    .arg(*qtConnection));
+    }
+
+    return QSqlDatabase::database(*qtConnection);
+}
+
+void DatabaseConnection::resetReadConnections()
+{
+    for (auto &readConnection : m_readConnections) {
+        readConnection.qtConnection.reset();
+        resetStatementsCache(readConnection.statementsCache);
+    }
+}
+
+QSqlQuery DatabaseConnection::prepareQuery(const QString &queryString,
+                                           const bool forwardOnly,
+                                           ReadConnection *const readConnection)
 {
+    const auto &statementsCache_ = statementsCache(readConnection);
+
+    /* The forward-only query is never cached, the cursor holds its result set
+       for the whole iteration and it's never checked in. */
+    const auto useCache = !forwardOnly && statementsCache_->isEnabled();
+
+    /* Check out the already prepared query from the cache, it's checked in again
+       after its result set is consumed, so a prepared query is never shared between
+       live result sets (nested queries with the same query string prepare their own
+       query). */
+    if (useCache) {
+        if (auto cachedQuery = statementsCache_->take(queryString);
+            cachedQuery
+        ) {
+            ++m_statementsCacheCounter.hits;
+
+            return std::move(*cachedQuery);
+        }
+
+        ++m_statementsCacheCounter.misses;
+    }
+
     // Prepare query string
-    auto query = getQtQuery();
+    auto query = readConnection == nullptr
+                 ? getQtQuery()
+                 : QSqlQuery(getReadQtConnection(*readConnection));
 
-    // TODO solve setForwardOnly() in DatabaseConnection class, again this problem 🤔 silverqx
-//    query.setForwardOnly(m_forwardOnly);
+    /* Must be set before the prepare(), the forward-only mode allows drivers to fetch
+       rows lazily (eg. the single-row mode for the PostgreSQL). */
+    query.setForwardOnly(forwardOnly);
 
+    // The failed query is never checked in, it's thrown away with the QueryError
     query.prepare(queryString);
 
     return query;
 }
 
+void DatabaseConnection::checkInQuery(QSqlQuery &&query, const QString &queryString,
+                                      ReadConnection *const readConnection)
+{
+    // Nothing to do, the pretended query isn't prepared
+    if (m_pretending)
+        return;
+
+    // The cache releases the result set and drops the query if it's disabled
+    statementsCache(readConnection)->insert(queryString, std::move(query));
+}
+
+void DatabaseConnection::checkInQueryOnRelease(
+        SqlQuery &query, const QString &queryString,
+        ReadConnection *const readConnection)
+{
+    const auto &statementsCache_ = statementsCache(readConnection);
+
+    // Nothing to do, the pretended query isn't prepared
+    if (m_pretending || !statementsCache_->isEnabled())
+        return;
+
+    query.setStatementsCache(statementsCache_, queryString);
+}
+
+void DatabaseConnection::resetStatementsCache(
+        std::shared_ptr<Support::PreparedStatementsCache> &statementsCache_)
+{
+    /* The new cache instance expires all weak pointers held by the checked out
+       queries, they were prepared for the invalidated statements. */
+    statementsCache_ = std::make_shared<Support::PreparedStatementsCache>(
+                           statementsCache_->capacity());
+}
+
+void DatabaseConnection::flushStatementsCacheIfDdl(const QString &queryString)
+{
+    /* Nothing to flush, checked out queries must be invalidated too, so the number of
+       cached queries can't be used here. */
+    if (!m_statementsCache->isEnabled())
+        return;
+
+    // The schema change is also replicated to the read connections
+    if (isDdlQuery(queryString))
+        flushStatementsCache();
+}
+
+namespace
+{
+    /*! Keywords that start the DDL queries. */
+    const std::array<QLatin1String, 5> DdlKeywords {
+        QLatin1String("create"), QLatin1String("alter"), QLatin1String("drop"),
+        QLatin1String("truncate"), QLatin1String("rename"),
+    };
+} // namespace
+
+bool DatabaseConnection::isDdlQuery(const QString &queryString)
+{
+    const auto query = QStringView(queryString).trimmed();
+
+    return std::ranges::any_of(DdlKeywords, [query](const QLatin1String keyword)
+    {
+        return query.startsWith(keyword, Qt::CaseInsensitive);
+    });
+}
+
 QDateTime DatabaseConnection::prepareBinding(const QDateTime &binding) const
 {
     /* Nothing to convert, the qt_timezone config. option is not valid or was not defined
@@ -627,6 +1301,144 @@ QDateTime DatabaseConnection::prepareBinding(const QDateTime &binding) const
     return Helpers::convertTimeZone(binding, m_qtTimeZone);
 }
 
+void DatabaseConnection::runExecBatch(
+        const QString &queryString, const QVector<QVariantList> &values,
+        const std::size_t offset, const std::size_t size)
+{
+    auto result = run<std::tuple<int, QSqlQuery>>(
+                queryString, {}, Prepared,
+                [this, &values, offset, size](const QString &queryString_,
+                                              const QVector<QVariant> &/*unused*/)
+                -> std::tuple<int, QSqlQuery>
+    {
+        if (m_pretending)
+            return {-1, getQtQueryForPretend()};
+
+        // Prepared only once, it's obtained from the cache for next chunks (if enabled)
+        auto query = prepareQuery(queryString_);
+
+        // Every placeholder is bound to the list of values
+        for (const auto &column : values)
+            query.addBindValue(prepareBatchColumn(column, offset, size));
+
+        if (query.execBatch()) {
+            // Affecting statements counter
+            if (m_countingStatements)
+                ++m_statementsCounter.affecting;
+
+            /* Drivers without the native batch support execute the statement for every
+               row, the number of affected rows is reported only for the last row. */
+            recordsHaveBeenModified();
+
+            return {static_cast<int>(size), std::move(query)};
+        }
+
+        throw Exceptions::QueryError(
+                    "Batch execution in DatabaseConnection::execBatch() failed.",
+                    query);
+    });
+
+    // Check in for the next chunk
+    checkInQuery(std::move(std::get<1>(result)), queryString);
+}
+
+QVariantList
+DatabaseConnection::prepareBatchColumn(const QVariantList &column,
+                                       const std::size_t offset,
+                                       const std::size_t size) const
+{
+    QVector<QVariant> chunk;
+
+    // The only value is bound to every row
+    if (column.size() == 1)
+        chunk.fill(column.constFirst(), static_cast<QVector<QVariant>::size_type>(size));
+    else {
+        const auto itBegin = column.cbegin() + static_cast<std::ptrdiff_t>(offset);
+
+        chunk = QVector<QVariant>(itBegin, itBegin + static_cast<std::ptrdiff_t>(size));
+    }
+
+    const auto preparedChunk = prepareBindings(std::move(chunk));
+
+    return QVariantList(preparedChunk.cbegin(), preparedChunk.cend());
+}
+
+std::size_t DatabaseConnection::batchRowsCount(const QVector<QVariantList> &values)
+{
+    if (values.isEmpty())
+        throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The values for the batch execution can't be empty "
+                               "in %1().")
+                .arg(__tiny_func__));
+
+    auto rowsCount = static_cast<std::size_t>(values.constFirst().size());
+
+    for (const auto &column : values) {
+        const auto size = static_cast<std::size_t>(column.size());
+
+        // Lists with one value are bound to every row
+        if (size == rowsCount || size == 1)
+            continue;
+
+        if (rowsCount == 1) {
+            rowsCount = size;
+            continue;
+        }
+
+        throw Exceptions::InvalidArgumentError(
+                QStringLiteral("All lists of values for the batch execution must have "
+                               "the same number of values or only one value in %1().")
+                .arg(__tiny_func__));
+    }
+
+    return rowsCount;
+}
+
+namespace
+{
+    /*! The last asynchronous query worker ID, used in the QSqlDatabase connection
+        names (connections with the same name can exist in many threads). */
+    std::atomic<std::size_t> lastAsyncWorkerId = 0; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+} // namespace
+
+Support::AsyncQueryWorker &DatabaseConnection::asyncWorker()
+{
+    /* The worker's connection is a separate connection, it would execute queries for
+       real in the pretend mode. */
+    if (m_pretending)
+        throw Exceptions::LogicError(
+                QStringLiteral("Asynchronous queries are not supported in the pretend "
+                               "mode for the '%1' connection in %2().")
+                .arg(m_connectionName, __tiny_func__));
+
+    /* The worker's connection is outside of the active transaction, the statement
+       would be committed outside of it and could even wait for the locks held by
+       this transaction, and the select wouldn't see its uncommitted changes. */
+    if (inTransaction())
+        throw Exceptions::LogicError(
+                QStringLiteral("The asynchronous query is executed on its own "
+                               "connection outside of the active transaction on "
+                               "the '%1' connection, in %2().")
+                .arg(m_connectionName, __tiny_func__));
+
+    if (m_asyncWorker)
+        return *m_asyncWorker;
+
+    if (!m_asyncConnectionFactory)
+        throw Exceptions::LogicError(
+                QStringLiteral("The asynchronous connection factory is not set for "
+                               "the '%1' connection, it's set for all connections "
+                               "created by the DatabaseManager, in %2().")
+                .arg(m_connectionName, __tiny_func__));
+
+    m_asyncWorker = std::make_unique<Support::AsyncQueryWorker>(
+                        QStringLiteral("%1-async-%2").arg(m_connectionName)
+                        .arg(++lastAsyncWorkerId),
+                        m_asyncConnectionFactory);
+
+    return *m_asyncWorker;
+}
+
 void DatabaseConnection::logConnected()
 {
 #ifdef TINYORM_MYSQL_PING
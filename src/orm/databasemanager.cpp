@@ -6,12 +6,33 @@
 #include "orm/connectors/connectionfactory.hpp"
 #include "orm/exceptions/invalidargumenterror.hpp"
 #include "orm/schema.hpp"
+#include "orm/utils/configuration.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
+using ConfigUtils = Orm::Utils::Configuration;
+
 namespace Orm
 {
 
+namespace
+{
+    /*! Create the factory that creates connections with the given QSqlDatabase
+        connection name, the configuration is thread-local, so the factory keeps
+        its own copy to be able to create connections in any thread. */
+    Support::AsyncQueryWorker::FactoryType
+    connectionFactory(const QVariantHash &config, const QString &connection)
+    {
+        return [config, connection](const QString &qtConnectionName)
+        {
+            auto config_ = config;
+
+            return Connectors::ConnectionFactory::make(config_, connection,
+                                                       qtConnectionName);
+        };
+    }
+} // namespace
+
 /* public */
 
 /* This is needed because of the std::unique_ptr is used in the m_connections
@@ -51,6 +72,9 @@ DatabaseManager::DatabaseManager(const ConfigurationsType &configs,
     : DatabaseManager(defaultConnection)
 {
     *m_configuration = configs;
+
+    for (const auto &[name, config] : configs)
+        createPool(config, name);
 }
 
 DatabaseManager &DatabaseManager::setupDefaultReconnector()
@@ -137,6 +161,13 @@ DatabaseManager::selectFromWriteConnection(
     return this->connection(connection).selectFromWriteConnection(query, bindings);
 }
 
+Cursor<>
+DatabaseManager::cursor(const QString &query, const QVector<QVariant> &bindings,
+                        const QString &connection)
+{
+    return this->connection(connection).cursor(query, bindings);
+}
+
 SqlQuery
 DatabaseManager::selectOne(const QString &query, const QVector<QVariant> &bindings,
                            const QString &connection)
@@ -193,6 +224,27 @@ SqlQuery DatabaseManager::unprepared(const QString &query,
     return this->connection(connection).unprepared(query);
 }
 
+QVector<BatchResult>
+DatabaseManager::batch(const QVector<BatchStatement> &statements,
+                       const QString &connection)
+{
+    return this->connection(connection).batch(statements);
+}
+
+QFuture<QVector<QSqlRecord>>
+DatabaseManager::selectAsync(const QString &query, const QVector<QVariant> &bindings,
+                             const QString &connection)
+{
+    return this->connection(connection).selectAsync(query, bindings);
+}
+
+QFuture<int>
+DatabaseManager::statementAsync(const QString &query, const QVector<QVariant> &bindings,
+                                const QString &connection)
+{
+    return this->connection(connection).statementAsync(query, bindings);
+}
+
 bool DatabaseManager::beginTransaction(const QString &connection)
 {
     return this->connection(connection).beginTransaction();
@@ -278,6 +330,13 @@ DatabaseConnection &DatabaseManager::connection(const QString &name)
 {
     const auto &connectionName = parseConnectionName(name);
 
+    /* The pooled connection is shared by all threads, return the connection borrowed
+       for the current task by the checkout(), it's returned to the pool when
+       the PooledConnection is destroyed. */
+    if (m_hasPools.load(std::memory_order_acquire))
+        if (const auto pool = this->pool(connectionName); pool)
+            return pool->currentOrFail();
+
     /* If we haven't created this connection, we'll create it based on the provided
        config. Once we've created the connections we will configure it. */
     if (!m_connections->contains(connectionName))
@@ -295,6 +354,8 @@ DatabaseManager::addConnection(const QVariantHash &config, const QString &name)
                 QStringLiteral("The database connection '%1' already exists.")
                 .arg(name));
 
+    createPool(config, name);
+
     m_configuration->emplace(name, config);
 
     return *this;
@@ -328,6 +389,16 @@ bool DatabaseManager::removeConnection(const QString &name)
     if (!connectionNames().contains(name_))
         return false;
 
+    /* Remove the connection pool, every checked out connection keeps the pool
+       alive, so the pool and all its connections are closed after the last checked
+       out connection is returned. */
+    if (const auto pool = this->pool(name_); pool) {
+        const QWriteLocker locker(&m_poolsLock);
+
+        m_pools.erase(name_);
+        m_hasPools.store(!m_pools.empty(), std::memory_order_release);
+    }
+
     /* If currently removed connection is the default connection, then reset default
        connection. */
     const auto resetDefaultConnection_ = [this, &name]
@@ -343,8 +414,13 @@ bool DatabaseManager::removeConnection(const QString &name)
         return true;
     }
 
+    auto &connection_ = *m_connections->find(name_)->second;
+
+    // Read connections are reset during the disconnect()
+    const auto readQtConnectionNames = connection_.getReadQtConnectionNames();
+
     // Disconnect first to be nice 😁 and safe 😂
-    m_connections->find(name_)->second->disconnect();
+    connection_.disconnect();
 
     /* If connection was not removed, return false and don't remove Qt's database
        connection and also don't remove connection configuration. */
@@ -360,6 +436,9 @@ bool DatabaseManager::removeConnection(const QString &name)
     // Remove Qt's database connection, ~QSqlDatabase() internally also calls close()
     QSqlDatabase::removeDatabase(name_);
 
+    for (const auto &readQtConnectionName : readQtConnectionNames)
+        QSqlDatabase::removeDatabase(readQtConnectionName);
+
     resetDefaultConnection_();
 
     return true;
@@ -374,6 +453,15 @@ DatabaseConnection &DatabaseManager::reconnect(const QString &name)
 {
     const auto &name_ = parseConnectionName(name);
 
+    // The pool refreshes the connection borrowed for the current task
+    if (const auto pool = this->pool(name_); pool) {
+        auto &connection = pool->currentOrFail();
+
+        connection.reconnect();
+
+        return connection;
+    }
+
     disconnect(name_);
 
     if (!m_connections->contains(name_))
@@ -386,6 +474,14 @@ void DatabaseManager::disconnect(const QString &name) const
 {
     const auto &name_ = parseConnectionName(name);
 
+    // Disconnect the connection borrowed for the current task
+    if (const auto pool = this->pool(name_); pool) {
+        if (auto *const connection = pool->current(); connection != nullptr)
+            connection->disconnect();
+
+        return;
+    }
+
     if (!m_connections->contains(name_))
         return;
 
@@ -472,6 +568,44 @@ DatabaseManager::setReconnector(const ReconnectorType &reconnector)
     return *this;
 }
 
+/* Connection pool */
+
+PooledConnection DatabaseManager::checkout(const QString &connection)
+{
+    auto pool = poolOrFail(connection);
+
+    auto &pooledConnection = pool->checkout();
+
+    return {std::move(pool), pooledConnection};
+}
+
+bool DatabaseManager::isPooled(const QString &connection) const
+{
+    return pool(parseConnectionName(connection)) != nullptr;
+}
+
+ConnectionPoolStats DatabaseManager::poolStats(const QString &connection) const
+{
+    return poolOrFail(connection)->stats();
+}
+
+void DatabaseManager::resetPoolStats(const QString &connection)
+{
+    poolOrFail(connection)->resetStats();
+}
+
+std::size_t DatabaseManager::removeExpiredPooledConnections()
+{
+    const QReadLocker locker(&m_poolsLock);
+
+    std::size_t removed = 0;
+
+    for (const auto &pool : m_pools | ranges::views::values)
+        removed += pool->removeExpiredConnections();
+
+    return removed;
+}
+
 /* Getters / Setters */
 
 QString DatabaseManager::driverName(const QString &connection)
@@ -628,6 +762,59 @@ std::size_t DatabaseManager::getQueryLogOrder() const noexcept // NOLINT(readabi
     return DatabaseConnection::getQueryLogOrder();
 }
 
+std::size_t DatabaseManager::getQueryLogCapacity(const QString &connection)
+{
+    return this->connection(connection).getQueryLogCapacity();
+}
+
+void DatabaseManager::setQueryLogCapacity(const std::size_t capacity,
+                                          const QString &connection)
+{
+    this->connection(connection).setQueryLogCapacity(capacity);
+}
+
+void DatabaseManager::setQueryLogSink(std::shared_ptr<Support::QueryLogSink> sink,
+                                      const QString &connection)
+{
+    this->connection(connection).setQueryLogSink(std::move(sink));
+}
+
+/* Normalized queries statistics */
+
+std::shared_ptr<QueryStatistics>
+DatabaseManager::getQueryStatistics(const QString &connection)
+{
+    return this->connection(connection).getQueryStatistics();
+}
+
+QVector<QueryStatistic>
+DatabaseManager::topQueryStatistics(const std::size_t count,
+                                    const QueryStatisticsSort sortBy,
+                                    const QString &connection)
+{
+    return this->connection(connection).topQueryStatistics(count, sortBy);
+}
+
+void DatabaseManager::flushQueryStatistics(const QString &connection)
+{
+    this->connection(connection).flushQueryStatistics();
+}
+
+void DatabaseManager::enableQueryStatistics(const QString &connection)
+{
+    this->connection(connection).enableQueryStatistics();
+}
+
+void DatabaseManager::disableQueryStatistics(const QString &connection)
+{
+    this->connection(connection).disableQueryStatistics();
+}
+
+bool DatabaseManager::collectingQueryStatistics(const QString &connection)
+{
+    return this->connection(connection).collectingQueryStatistics();
+}
+
 /* Queries execution time counter */
 
 bool DatabaseManager::countingElapsed(const QString &connection)
@@ -882,6 +1069,149 @@ void DatabaseManager::resetStatementCounters(const QStringList &connections)
     }
 }
 
+/* Prepared statements cache counter */
+
+const StatementsCacheCounter &
+DatabaseManager::getStatementsCacheCounter(const QString &connection)
+{
+    return this->connection(connection).getStatementsCacheCounter();
+}
+
+StatementsCacheCounter
+DatabaseManager::takeStatementsCacheCounter(const QString &connection)
+{
+    return this->connection(connection).takeStatementsCacheCounter();
+}
+
+DatabaseConnection &
+DatabaseManager::resetStatementsCacheCounter(const QString &connection)
+{
+    return this->connection(connection).resetStatementsCacheCounter();
+}
+
+/* Queries latency histograms */
+
+bool DatabaseManager::countingLatency(const QString &connection)
+{
+    return this->connection(connection).countingLatency();
+}
+
+DatabaseConnection &DatabaseManager::enableLatencyHistograms(const QString &connection)
+{
+    return this->connection(connection).enableLatencyHistograms();
+}
+
+DatabaseConnection &DatabaseManager::disableLatencyHistograms(const QString &connection)
+{
+    return this->connection(connection).disableLatencyHistograms();
+}
+
+const LatencyHistograms &
+DatabaseManager::getLatencyHistograms(const QString &connection)
+{
+    return this->connection(connection).getLatencyHistograms();
+}
+
+LatencyHistograms DatabaseManager::takeLatencyHistograms(const QString &connection)
+{
+    return this->connection(connection).takeLatencyHistograms();
+}
+
+DatabaseConnection &DatabaseManager::resetLatencyHistograms(const QString &connection)
+{
+    return this->connection(connection).resetLatencyHistograms();
+}
+
+bool DatabaseManager::anyCountingLatency()
+{
+    return std::ranges::any_of(openedConnectionNames(),
+                               [this](const auto &connectionName)
+    {
+        return connection(connectionName).countingLatency();
+    });
+}
+
+void DatabaseManager::enableAllLatencyHistograms()
+{
+    enableLatencyHistograms(openedConnectionNames());
+}
+
+void DatabaseManager::disableAllLatencyHistograms()
+{
+    disableLatencyHistograms(openedConnectionNames());
+}
+
+LatencyHistograms DatabaseManager::getAllLatencyHistograms()
+{
+    return getLatencyHistograms(openedConnectionNames());
+}
+
+LatencyHistograms DatabaseManager::takeAllLatencyHistograms()
+{
+    return takeLatencyHistograms(openedConnectionNames());
+}
+
+void DatabaseManager::resetAllLatencyHistograms()
+{
+    resetLatencyHistograms(openedConnectionNames());
+}
+
+void DatabaseManager::enableLatencyHistograms(const QStringList &connections)
+{
+    for (const auto &connectionName : connections)
+        connection(connectionName).enableLatencyHistograms();
+}
+
+void DatabaseManager::disableLatencyHistograms(const QStringList &connections)
+{
+    for (const auto &connectionName : connections)
+        connection(connectionName).disableLatencyHistograms();
+}
+
+LatencyHistograms DatabaseManager::getLatencyHistograms(const QStringList &connections)
+{
+    LatencyHistograms histograms;
+
+    if (!anyCountingLatency())
+        return histograms;
+
+    for (const auto &connectionName : connections) {
+        const auto &connection = this->connection(connectionName);
+
+        if (connection.countingLatency())
+            histograms.merge(connection.getLatencyHistograms());
+    }
+
+    return histograms;
+}
+
+LatencyHistograms DatabaseManager::takeLatencyHistograms(const QStringList &connections)
+{
+    LatencyHistograms histograms;
+
+    if (!anyCountingLatency())
+        return histograms;
+
+    for (const auto &connectionName : connections) {
+        auto &connection = this->connection(connectionName);
+
+        if (connection.countingLatency())
+            histograms.merge(connection.takeLatencyHistograms());
+    }
+
+    return histograms;
+}
+
+void DatabaseManager::resetLatencyHistograms(const QStringList &connections)
+{
+    for (const auto &connectionName : connections) {
+        auto &connection = this->connection(connectionName);
+
+        if (connection.countingLatency())
+            connection.resetLatencyHistograms();
+    }
+}
+
 /* private */
 
 const QString &
@@ -897,7 +1227,12 @@ DatabaseManager::makeConnection(const QString &connection)
 
     // FUTURE add support for extensions silverqx
 
-    return Connectors::ConnectionFactory::make(config, connection);
+    auto connection_ = Connectors::ConnectionFactory::make(config, connection);
+
+    // Asynchronous queries are executed in the worker thread on its own connection
+    connection_->setAsyncConnectionFactory(connectionFactory(config, connection));
+
+    return connection_;
 }
 
 /* Can not be const because I'm modifying the Configuration (QVariantHash)
@@ -953,6 +1288,74 @@ DatabaseManager::refreshQtConnection(const QString &connection)
                 fresh->getQtConnectionResolver());
 }
 
+void DatabaseManager::createPool(const QVariantHash &config, const QString &connection)
+{
+    const auto poolConfig = ConfigUtils::preparePoolConfig(config, connection);
+
+    // Nothing to do, the connection isn't pooled
+    if (!poolConfig)
+        return;
+
+    /* The configuration is thread-local, so the factory keeps its own copy to be able
+       to create connections in any thread. Every pooled connection has its own
+       QSqlDatabase connection name, but the getName() returns the connection name. */
+    auto factory = [factory_ = connectionFactory(config, connection)]
+                   (const QString &qtConnectionName)
+    {
+        auto connection_ = std::invoke(factory_, qtConnectionName);
+
+        // Asynchronous queries are executed in the worker thread on its own connection
+        auto asyncFactory = factory_;
+        connection_->setAsyncConnectionFactory(std::move(asyncFactory));
+
+        return connection_;
+    };
+
+    auto pool = std::make_shared<Support::ConnectionPool>(connection, *poolConfig,
+                                                          std::move(factory));
+
+    {
+        const QWriteLocker locker(&m_poolsLock);
+
+        m_pools.insert_or_assign(connection, pool);
+
+        m_hasPools.store(true, std::memory_order_release);
+    }
+
+    /* Pre-warm the pool outside of the lock, connections are opened in the current
+       thread and they are reused by this thread first. */
+    pool->openMinConnections();
+}
+
+std::shared_ptr<Support::ConnectionPool>
+DatabaseManager::pool(const QString &connection) const
+{
+    if (!m_hasPools.load(std::memory_order_acquire))
+        return nullptr;
+
+    const QReadLocker locker(&m_poolsLock);
+
+    if (const auto itPool = m_pools.find(connection); itPool != m_pools.cend())
+        return itPool->second;
+
+    return nullptr;
+}
+
+std::shared_ptr<Support::ConnectionPool>
+DatabaseManager::poolOrFail(const QString &connection) const
+{
+    const auto &connectionName = parseConnectionName(connection);
+
+    if (auto pool = this->pool(connectionName); pool)
+        return pool;
+
+    throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The '%1' database connection doesn't use "
+                               "the connection pool, set the '%2' configuration option "
+                               "to enable it, in %3().")
+                .arg(connectionName, pool_max_size, __tiny_func__));
+}
+
 void DatabaseManager::checkInstance()
 {
     if (!m_instance)
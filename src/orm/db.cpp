@@ -72,6 +72,13 @@ DB::selectFromWriteConnection(const QString &query, const QVector<QVariant> &bin
     return manager().connection(connection).selectFromWriteConnection(query, bindings);
 }
 
+Cursor<>
+DB::cursor(const QString &query, const QVector<QVariant> &bindings,
+           const QString &connection)
+{
+    return manager().connection(connection).cursor(query, bindings);
+}
+
 SqlQuery
 DB::selectOne(const QString &query, const QVector<QVariant> &bindings,
               const QString &connection)
@@ -127,6 +134,26 @@ SqlQuery DB::unprepared(const QString &query,
     return manager().connection(connection).unprepared(query);
 }
 
+QVector<BatchResult>
+DB::batch(const QVector<BatchStatement> &statements, const QString &connection)
+{
+    return manager().connection(connection).batch(statements);
+}
+
+QFuture<QVector<QSqlRecord>>
+DB::selectAsync(const QString &query, const QVector<QVariant> &bindings,
+                const QString &connection)
+{
+    return manager().connection(connection).selectAsync(query, bindings);
+}
+
+QFuture<int>
+DB::statementAsync(const QString &query, const QVector<QVariant> &bindings,
+                   const QString &connection)
+{
+    return manager().connection(connection).statementAsync(query, bindings);
+}
+
 // NOTE api different silverqx
 bool DB::beginTransaction(const QString &connection)
 {
@@ -294,6 +321,33 @@ DB::setReconnector(const ReconnectorType &reconnector)
     return manager().setReconnector(reconnector);
 }
 
+/* Connection pool */
+
+PooledConnection DB::checkout(const QString &connection)
+{
+    return manager().checkout(connection);
+}
+
+bool DB::isPooled(const QString &connection)
+{
+    return manager().isPooled(connection);
+}
+
+ConnectionPoolStats DB::poolStats(const QString &connection)
+{
+    return manager().poolStats(connection);
+}
+
+void DB::resetPoolStats(const QString &connection)
+{
+    manager().resetPoolStats(connection);
+}
+
+std::size_t DB::removeExpiredPooledConnections()
+{
+    return manager().removeExpiredPooledConnections();
+}
+
 /* Getters / Setters */
 
 QString DB::driverName(const QString &connection)
@@ -445,6 +499,58 @@ std::size_t DB::getQueryLogOrder() noexcept
     return manager().getQueryLogOrder();
 }
 
+std::size_t DB::getQueryLogCapacity(const QString &connection)
+{
+    return manager().connection(connection).getQueryLogCapacity();
+}
+
+void DB::setQueryLogCapacity(const std::size_t capacity,
+                             const QString &connection)
+{
+    manager().connection(connection).setQueryLogCapacity(capacity);
+}
+
+void DB::setQueryLogSink(std::shared_ptr<Support::QueryLogSink> sink,
+                         const QString &connection)
+{
+    manager().connection(connection).setQueryLogSink(std::move(sink));
+}
+
+/* Normalized queries statistics */
+
+std::shared_ptr<QueryStatistics>
+DB::getQueryStatistics(const QString &connection)
+{
+    return manager().connection(connection).getQueryStatistics();
+}
+
+QVector<QueryStatistic>
+DB::topQueryStatistics(const std::size_t count, const QueryStatisticsSort sortBy,
+                       const QString &connection)
+{
+    return manager().connection(connection).topQueryStatistics(count, sortBy);
+}
+
+void DB::flushQueryStatistics(const QString &connection)
+{
+    manager().connection(connection).flushQueryStatistics();
+}
+
+void DB::enableQueryStatistics(const QString &connection)
+{
+    manager().connection(connection).enableQueryStatistics();
+}
+
+void DB::disableQueryStatistics(const QString &connection)
+{
+    manager().connection(connection).disableQueryStatistics();
+}
+
+bool DB::collectingQueryStatistics(const QString &connection)
+{
+    return manager().connection(connection).collectingQueryStatistics();
+}
+
 /* Queries execution time counter */
 
 bool DB::countingElapsed(const QString &connection)
@@ -619,6 +725,110 @@ void DB::resetStatementCounters(const QStringList &connections)
     manager().resetStatementCounters(connections);
 }
 
+/* Prepared statements cache counter */
+
+const StatementsCacheCounter &DB::getStatementsCacheCounter(const QString &connection)
+{
+    return manager().connection(connection).getStatementsCacheCounter();
+}
+
+StatementsCacheCounter DB::takeStatementsCacheCounter(const QString &connection)
+{
+    return manager().connection(connection).takeStatementsCacheCounter();
+}
+
+DatabaseConnection &DB::resetStatementsCacheCounter(const QString &connection)
+{
+    return manager().connection(connection).resetStatementsCacheCounter();
+}
+
+/* Queries latency histograms */
+
+bool DB::countingLatency(const QString &connection)
+{
+    return manager().connection(connection).countingLatency();
+}
+
+DatabaseConnection &DB::enableLatencyHistograms(const QString &connection)
+{
+    return manager().connection(connection).enableLatencyHistograms();
+}
+
+DatabaseConnection &DB::disableLatencyHistograms(const QString &connection)
+{
+    return manager().connection(connection).disableLatencyHistograms();
+}
+
+const LatencyHistograms &DB::getLatencyHistograms(const QString &connection)
+{
+    return manager().connection(connection).getLatencyHistograms();
+}
+
+LatencyHistograms DB::takeLatencyHistograms(const QString &connection)
+{
+    return manager().connection(connection).takeLatencyHistograms();
+}
+
+DatabaseConnection &DB::resetLatencyHistograms(const QString &connection)
+{
+    return manager().connection(connection).resetLatencyHistograms();
+}
+
+bool DB::anyCountingLatency()
+{
+    return manager().anyCountingLatency();
+}
+
+void DB::enableAllLatencyHistograms()
+{
+    manager().enableAllLatencyHistograms();
+}
+
+void DB::disableAllLatencyHistograms()
+{
+    manager().disableAllLatencyHistograms();
+}
+
+LatencyHistograms DB::getAllLatencyHistograms()
+{
+    return manager().getAllLatencyHistograms();
+}
+
+LatencyHistograms DB::takeAllLatencyHistograms()
+{
+    return manager().takeAllLatencyHistograms();
+}
+
+void DB::resetAllLatencyHistograms()
+{
+    manager().resetAllLatencyHistograms();
+}
+
+void DB::enableLatencyHistograms(const QStringList &connections)
+{
+    manager().enableLatencyHistograms(connections);
+}
+
+void DB::disableLatencyHistograms(const QStringList &connections)
+{
+    manager().disableLatencyHistograms(connections);
+}
+
+LatencyHistograms DB::getLatencyHistograms(const QStringList &connections)
+{
+    return manager().getLatencyHistograms(connections);
+}
+
+LatencyHistograms DB::takeLatencyHistograms(const QStringList &connections)
+{
+    return manager().takeLatencyHistograms(connections);
+}
+
+void DB::resetLatencyHistograms(const QStringList &connections)
+{
+    manager().resetLatencyHistograms(connections);
+}
+
 /* private */
 
 DatabaseManager &DB::manager()
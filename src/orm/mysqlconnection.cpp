@@ -3,8 +3,11 @@
 #ifdef TINYORM_MYSQL_PING
 #  include <QDebug>
 #endif
+#include <QTemporaryFile>
 #include <QVersionNumber>
 #include <QtSql/QSqlDriver>
+#include <QtSql/QSqlError>
+#include <QtSql/QSqlField>
 
 #ifdef TINYORM_MYSQL_PING
 #  ifdef __MINGW32__
@@ -22,15 +25,18 @@ disable TINYORM_MYSQL_PING preprocessor directive.
 #  endif
 #endif
 
+#include "orm/exceptions/invalidargumenterror.hpp"
 #include "orm/query/grammars/mysqlgrammar.hpp"
 #include "orm/query/processors/mysqlprocessor.hpp"
 #include "orm/schema/grammars/mysqlschemagrammar.hpp"
 #include "orm/schema/mysqlschemabuilder.hpp"
 #include "orm/utils/configuration.hpp"
+#include "orm/utils/helpers.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
 using ConfigUtils = Orm::Utils::Configuration;
+using Orm::Utils::Helpers;
 
 namespace Orm
 {
@@ -233,6 +239,129 @@ bool MySqlConnection::pingDatabase()
 
 /* protected */
 
+QVector<BatchResult>
+MySqlConnection::runBatch(const QVector<BatchStatement> &statements)
+{
+    // Nothing to send together
+    if (m_pretending || statements.size() < 2 || !multiStatementsEnabled())
+        return DatabaseConnection::runBatch(statements);
+
+    /* Bindings can't be bound to the multi-statement query, so they are formatted
+       and escaped by the QSqlDriver and inlined into the query. */
+    QStringList queryStrings;
+    queryStrings.reserve(statements.size());
+
+    for (const auto &[queryString, bindings] : statements)
+        queryStrings << inlineBindings(queryString, prepareBindings(bindings));
+
+    QVector<BatchResult> results;
+
+    // Logged and counted as one query, it's sent to the server in one round trip
+    run<std::tuple<int, QSqlQuery>>(
+                queryStrings.join(QStringLiteral("; ")), {}, Unprepared,
+                [this, &results, &statements](const QString &queryString_,
+                                              const QVector<QVariant> &/*unused*/)
+                -> std::tuple<int, QSqlQuery>
+    {
+        results.clear();
+        results.reserve(statements.size());
+
+        auto query = getQtQuery();
+
+        if (!query.exec(queryString_))
+            throw Exceptions::QueryError(
+                    "Multi-statement batch in MySqlConnection::runBatch() failed.",
+                    query);
+
+        // Every statement has its own result
+        auto affected = 0;
+        do {
+            const auto numRowsAffected = query.numRowsAffected();
+
+            results.append({numRowsAffected, query.lastInsertId()});
+
+            affected += std::max(0, numRowsAffected);
+
+        } while (query.nextResult());
+
+        // An error in the subsequent statement is reported by the nextResult()
+        if (query.lastError().isValid())
+            throw Exceptions::QueryError(
+                    "Multi-statement batch in MySqlConnection::runBatch() failed.",
+                    query);
+
+        // Affecting statements counter
+        if (m_countingStatements)
+            m_statementsCounter.affecting += static_cast<int>(results.size());
+
+        recordsHaveBeenModified(affected > 0);
+
+        return {affected, query};
+    });
+
+    return results;
+}
+
+quint64 MySqlConnection::runBulkLoad(
+        const QString &table, const QVector<QString> &columns,
+        const BulkLoadRowSource &rowSource)
+{
+    // The load data local infile is disabled, fall back to the multi-row inserts
+    if (m_pretending || !localInfileEnabled())
+        return runBulkInsert(table, columns, rowSource,
+                             bulkInsertChunkSize(
+                                 static_cast<std::size_t>(columns.size())));
+
+    QTemporaryFile file;
+
+    if (!file.open())
+        throw Exceptions::RuntimeError(
+                QStringLiteral("Can't create the temporary file for the bulk load, "
+                               "%1 in %2().")
+                .arg(file.errorString(), __tiny_func__));
+
+    const auto written = writeBulkLoadFile(file, columns.size(), rowSource);
+
+    // Nothing to load
+    if (written == 0)
+        return 0;
+
+    // The file is read by the MySQL client library, it's removed in the destructor
+    file.close();
+
+    quint64 loaded = 0;
+
+    run<std::tuple<int, QSqlQuery>>(
+                getQueryGrammar().compileLoadDataFile(table, columns, file.fileName()),
+                {}, Unprepared,
+                [this, written, &loaded](const QString &queryString_,
+                                         const QVector<QVariant> &/*unused*/)
+                -> std::tuple<int, QSqlQuery>
+    {
+        auto query = getQtQuery();
+
+        if (!query.exec(queryString_))
+            throw Exceptions::QueryError(
+                    "Load data local infile in MySqlConnection::runBulkLoad() failed.",
+                    query);
+
+        // Affecting statements counter
+        if (m_countingStatements)
+            ++m_statementsCounter.affecting;
+
+        const auto numRowsAffected = query.numRowsAffected();
+
+        loaded = numRowsAffected >= 0 ? static_cast<quint64>(numRowsAffected)
+                                      : written;
+
+        recordsHaveBeenModified(loaded > 0);
+
+        return {numRowsAffected, query};
+    });
+
+    return loaded;
+}
+
 std::unique_ptr<QueryGrammar> MySqlConnection::getDefaultQueryGrammar() const
 {
     // Ownership of a unique_ptr()
@@ -258,6 +387,239 @@ std::unique_ptr<QueryProcessor> MySqlConnection::getDefaultPostProcessor() const
     return std::make_unique<Query::Processors::MySqlProcessor>();
 }
 
+/* private */
+
+bool MySqlConnection::multiStatementsEnabled()
+{
+    // Return the cached value
+    if (m_multiStatements)
+        return *m_multiStatements;
+
+    // Cache the value
+    m_multiStatements = hasConnectOption(QLatin1String("CLIENT_MULTI_STATEMENTS")) &&
+                        driver()->hasFeature(QSqlDriver::MultipleResultSets);
+
+    return *m_multiStatements;
+}
+
+bool MySqlConnection::localInfileEnabled()
+{
+    // Return the cached value
+    if (m_localInfile)
+        return *m_localInfile;
+
+    // Cache the value
+    m_localInfile = hasConnectOption(QLatin1String("MYSQL_OPT_LOCAL_INFILE"));
+
+    return *m_localInfile;
+}
+
+bool MySqlConnection::hasConnectOption(const QLatin1String name)
+{
+    const auto connectOptions = getQtConnection().connectOptions()
+                                .split(QLatin1Char(';'), Qt::SkipEmptyParts);
+
+    // The option can be passed without the value or with the 1/TRUE value
+    return std::ranges::any_of(connectOptions, [name](const QString &option)
+    {
+        const auto option_ = QStringView(option).trimmed();
+        const auto separator = option_.indexOf(QLatin1Char('='));
+
+        if (option_.left(separator).trimmed().compare(name, Qt::CaseInsensitive) != 0)
+            return false;
+
+        // Without the value
+        if (separator == -1)
+            return true;
+
+        const auto value = option_.mid(separator + 1).trimmed();
+
+        return value == QLatin1String("1") ||
+               value.compare(QLatin1String("TRUE"), Qt::CaseInsensitive) == 0;
+    });
+}
+
+QString MySqlConnection::inlineBindings(const QString &queryString,
+                                        const QVector<QVariant> &bindings)
+{
+    using SizeType = QString::size_type;
+
+    const auto *const driver = this->driver();
+
+    QString result;
+    result.reserve(queryString.size() + (bindings.size() * 8));
+
+    const auto size = queryString.size();
+    QVector<QVariant>::size_type bindingIndex = 0;
+    QChar quote;
+
+    for (SizeType index = 0; index < size; ++index) {
+        const auto character = queryString.at(index);
+
+        result.append(character);
+
+        // Inside the string literal or quoted identifier, placeholders are ignored
+        if (!quote.isNull()) {
+            if (character == QLatin1Char('\\') && index + 1 < size)
+                result.append(queryString.at(++index));
+            else if (character == quote)
+                quote = QChar();
+
+            continue;
+        }
+
+        if (character == QLatin1Char('\'') || character == QLatin1Char('"') ||
+            character == QLatin1Char('`')
+        ) {
+            quote = character;
+            continue;
+        }
+
+        if (character != QLatin1Char('?'))
+            continue;
+
+        if (bindingIndex >= bindings.size())
+            throw Exceptions::InvalidArgumentError(
+                    QStringLiteral("The number of bindings is lower than the number "
+                                   "of placeholders in the '%1' query in %2().")
+                    .arg(queryString, __tiny_func__));
+
+        // Replace the placeholder with the formatted binding
+        result.chop(1);
+
+        const auto &binding = bindings.at(bindingIndex++);
+
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+        QSqlField field(QString(), binding.metaType());
+#else
+        QSqlField field(QString(), binding.type());
+#endif
+        field.setValue(binding);
+
+        result.append(driver->formatValue(field));
+    }
+
+    if (bindingIndex != bindings.size())
+        throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The number of bindings is greater than the number "
+                               "of placeholders in the '%1' query in %2().")
+                .arg(queryString, __tiny_func__));
+
+    return result;
+}
+
+quint64 MySqlConnection::writeBulkLoadFile(
+        QIODevice &file, const QVector<QString>::size_type columnsCount,
+        const BulkLoadRowSource &rowSource)
+{
+    // Rows are written to the file in 1MB blocks
+    constexpr static QByteArray::size_type BlockSize = 1024 * 1024;
+
+    QByteArray buffer;
+    buffer.reserve(BlockSize);
+
+    const auto writeBuffer = [&file, &buffer]
+    {
+        if (file.write(buffer) != buffer.size())
+            throw Exceptions::RuntimeError(
+                    QStringLiteral("Can't write the bulk load file, %1 in %2().")
+                    .arg(file.errorString(), __tiny_func__));
+
+        buffer.resize(0);
+    };
+
+    quint64 written = 0;
+
+    while (const auto row = std::invoke(rowSource)) {
+        if (row->size() != columnsCount)
+            throw Exceptions::InvalidArgumentError(
+                    QStringLiteral("The row has %1 values but %2 columns were given "
+                                   "in %3().")
+                    .arg(row->size()).arg(columnsCount).arg(__tiny_func__));
+
+        // Converts the QDateTime bindings to the connection's time zone
+        const auto preparedRow = prepareBindings(*row);
+
+        for (QVector<QVariant>::size_type index = 0; index < columnsCount; ++index) {
+            if (index > 0)
+                buffer.append('\t');
+
+            appendBulkLoadValue(buffer, preparedRow.at(index));
+        }
+
+        buffer.append('\n');
+        ++written;
+
+        if (buffer.size() >= BlockSize)
+            writeBuffer();
+    }
+
+    if (!buffer.isEmpty())
+        writeBuffer();
+
+    return written;
+}
+
+void MySqlConnection::appendBulkLoadValue(QByteArray &buffer, const QVariant &value)
+{
+    if (!value.isValid() || value.isNull()) {
+        buffer.append("\\N");
+        return;
+    }
+
+    QByteArray rawValue;
+
+    switch (Helpers::qVariantTypeId(value)) {
+    case QMetaType::Bool:
+        rawValue = value.value<bool>() ? "1" : "0";
+        break;
+
+    case QMetaType::QByteArray:
+        rawValue = value.value<QByteArray>();
+        break;
+
+    case QMetaType::QDateTime:
+        rawValue = value.value<QDateTime>()
+                   .toString(QStringLiteral("yyyy-MM-dd HH:mm:ss.zzz")).toUtf8();
+        break;
+
+    case QMetaType::QTime:
+        rawValue = value.value<QTime>().toString(QStringLiteral("HH:mm:ss.zzz"))
+                   .toUtf8();
+        break;
+
+    default:
+        rawValue = value.value<QString>().toUtf8();
+    }
+
+    // Escape characters that have a special meaning in the load data file
+    for (const auto character : std::as_const(rawValue))
+        switch (character) {
+        case '\\':
+            buffer.append("\\\\");
+            break;
+
+        case '\t':
+            buffer.append("\\t");
+            break;
+
+        case '\n':
+            buffer.append("\\n");
+            break;
+
+        case '\r':
+            buffer.append("\\r");
+            break;
+
+        case '\0':
+            buffer.append("\\0");
+            break;
+
+        default:
+            buffer.append(character);
+        }
+}
+
 } // namespace Orm
 
 TINYORM_END_COMMON_NAMESPACE
@@ -37,6 +37,11 @@ std::unique_ptr<SchemaBuilder> PostgresConnection::getSchemaBuilder()
     return std::make_unique<SchemaNs::PostgresSchemaBuilder>(*this);
 }
 
+bool PostgresConnection::usesEagerArrayBinding() const
+{
+    return getConfig(eager_load_any_array).value<bool>();
+}
+
 /* protected */
 
 std::unique_ptr<QueryGrammar> PostgresConnection::getDefaultQueryGrammar() const
@@ -64,6 +69,16 @@ std::unique_ptr<QueryProcessor> PostgresConnection::getDefaultPostProcessor() co
     return std::make_unique<Query::Processors::PostgresProcessor>();
 }
 
+quint64 PostgresConnection::runBulkLoad(
+        const QString &table, const QVector<QString> &columns,
+        const BulkLoadRowSource &rowSource)
+{
+    /* Every chunk is sent in one round trip, it's still much faster than loading
+       rows one by one. */
+    return runBulkInsert(table, columns, rowSource,
+                         bulkInsertChunkSize(static_cast<std::size_t>(columns.size())));
+}
+
 } // namespace Orm
 
 TINYORM_END_COMMON_NAMESPACE
@@ -9,33 +9,265 @@ TINYORM_BEGIN_COMMON_NAMESPACE
 namespace Orm::Query::Grammars
 {
 
+namespace
+{
+    /*! Minimal size reserved for the compiled select query. */
+    constexpr QString::size_type MinSqlSizeEstimate = 128;
+
+    /*! Get the size of the leading and/or of the condition (0 if there is none). */
+    QString::size_type leadingBooleanSize(const QString &condition)
+    {
+        const auto startsWith = [&condition](const QString &boolean)
+        {
+            return condition.startsWith(boolean) &&
+                   (condition.size() == boolean.size() ||
+                    condition.at(boolean.size()) == SPACE);
+        };
+
+        if (startsWith(AND))
+            return AND.size();
+        if (startsWith(OR))
+            return OR.size();
+
+        return 0;
+    }
+
+    /*! Append the and/or condition of the where or having clause, the leading
+        and/or of the first clause is skipped (the "and not" condition becomes
+        the "not"). */
+    void appendBoolean(QString &sql, const QString &condition, const bool first)
+    {
+        if (!first) {
+            sql += condition;
+            sql += SPACE;
+            return;
+        }
+
+        const auto rest = QStringView(condition).mid(leadingBooleanSize(condition))
+                          .trimmed();
+
+        // Nothing left after the leading and/or
+        if (rest.isEmpty())
+            return;
+
+        sql.append(rest);
+        sql += SPACE;
+    }
+
+    /*! Separator of the query shape parts (the unit separator control character). */
+    const auto ShapeSeparator = QChar(0x1f);
+
+    /*! Append the tagged part to the query shape. */
+    void appendShapePart(QString &shape, const QChar tag, const QString &part = {})
+    {
+        shape += tag;
+        shape += part;
+        shape += ShapeSeparator;
+    }
+
+    /*! Append the column or raw expression to the query shape. */
+    void appendColumnShape(QString &shape, const Column &column)
+    {
+        if (std::holds_alternative<Expression>(column))
+            appendShapePart(shape, QLatin1Char('e'),
+                            std::get<Expression>(column).getValue().value<QString>());
+        else
+            appendShapePart(shape, QLatin1Char('c'), std::get<QString>(column));
+    }
+
+    /*! Append the value to the query shape, only raw expressions are compiled
+        into SQL, other values are bound using the ? placeholder. */
+    void appendValueShape(QString &shape, const QVariant &value)
+    {
+        if (BaseGrammar::isExpression(value))
+            appendShapePart(shape, QLatin1Char('e'),
+                            BaseGrammar::getValue(value).value<QString>());
+        else
+            appendShapePart(shape, QLatin1Char('?'));
+    }
+
+    /*! Append the values to the query shape. */
+    void appendValuesShape(QString &shape, const QVector<QVariant> &values)
+    {
+        // The number of values affects the number of ? placeholders
+        appendShapePart(shape, QLatin1Char('s'), QString::number(values.size()));
+
+        for (const auto &value : values)
+            appendValueShape(shape, value);
+    }
+
+    /*! Append the from clause or join table to the query shape. */
+    void appendFromShape(QString &shape, const FromClause &from)
+    {
+        if (std::holds_alternative<QString>(from))
+            appendShapePart(shape, QLatin1Char('t'), std::get<QString>(from));
+        else if (std::holds_alternative<Expression>(from))
+            appendShapePart(shape, QLatin1Char('e'),
+                            std::get<Expression>(from).getValue().value<QString>());
+        else
+            appendShapePart(shape, QLatin1Char('t'));
+    }
+
+    void appendQueryShape(QString &shape, const QueryBuilder &query);
+
+    /*! Append the where clause data to the query shape. */
+    void appendWhereDataShape(QString &shape, const WhereConditionData &data) // NOLINT(misc-no-recursion)
+    {
+        if (std::holds_alternative<QVariant>(data))
+            appendValueShape(shape, std::get<QVariant>(data));
+
+        else if (std::holds_alternative<std::shared_ptr<QueryBuilder>>(data)) {
+            appendShapePart(shape, QLatin1Char('('));
+            appendQueryShape(shape, *std::get<std::shared_ptr<QueryBuilder>>(data));
+            appendShapePart(shape, QLatin1Char(')'));
+        }
+        else if (std::holds_alternative<QVector<QVariant>>(data))
+            appendValuesShape(shape, std::get<QVector<QVariant>>(data));
+
+        else if (std::holds_alternative<WhereColumnTwoItem>(data))
+            appendColumnShape(shape, std::get<WhereColumnTwoItem>(data).column);
+
+        else if (std::holds_alternative<WhereRowValuesItem>(data)) {
+            const auto &rowValues = std::get<WhereRowValuesItem>(data);
+
+            for (const auto &column : rowValues.columns)
+                appendColumnShape(shape, column);
+
+            appendValuesShape(shape, rowValues.values);
+        }
+        else if (std::holds_alternative<WhereRawItem>(data))
+            appendShapePart(shape, QLatin1Char('r'), std::get<WhereRawItem>(data).sql);
+
+        else if (std::holds_alternative<WhereBetweenItem>(data)) {
+            const auto &between = std::get<WhereBetweenItem>(data);
+
+            appendValueShape(shape, between.min);
+            appendValueShape(shape, between.max);
+        }
+        else if (std::holds_alternative<WhereBetweenColumnsItem>(data)) {
+            const auto &betweenColumns = std::get<WhereBetweenColumnsItem>(data);
+
+            appendColumnShape(shape, betweenColumns.min);
+            appendColumnShape(shape, betweenColumns.max);
+        }
+    }
+
+    /*! Append the where clauses to the query shape. */
+    void appendWheresShape(QString &shape, const QVector<WhereConditionItem> &wheres) // NOLINT(misc-no-recursion)
+    {
+        for (const auto &where : wheres) {
+            appendShapePart(shape, QLatin1Char('w'),
+                            QString::number(static_cast<int>(where.type)));
+            appendShapePart(shape, QLatin1Char('b'), where.condition);
+            appendShapePart(shape, QLatin1Char('o'), where.comparison);
+            appendColumnShape(shape, where.column);
+            appendShapePart(shape, QLatin1Char('n'),
+                            where.nope ? QStringLiteral("1") : QStringLiteral("0"));
+
+            appendWhereDataShape(shape, where.data);
+        }
+    }
+
+    /*! Append all the components of the query that are compiled into SQL to
+        the query shape. */
+    void appendQueryShape(QString &shape, const QueryBuilder &query) // NOLINT(misc-no-recursion)
+    {
+        if (const auto &aggregate = query.getAggregate(); aggregate) {
+            appendShapePart(shape, QLatin1Char('a'), aggregate->function);
+
+            for (const auto &column : aggregate->columns)
+                appendColumnShape(shape, column);
+        }
+
+        if (const auto &distinct = query.getDistinct();
+            std::holds_alternative<bool>(distinct)
+        )
+            appendShapePart(shape, QLatin1Char('d'), std::get<bool>(distinct)
+                                                     ? QStringLiteral("1")
+                                                     : QStringLiteral("0"));
+        else
+            appendShapePart(shape, QLatin1Char('D'),
+                            std::get<QStringList>(distinct).join(ShapeSeparator));
+
+        appendShapePart(shape, QLatin1Char('C'));
+        for (const auto &column : query.getColumns())
+            appendColumnShape(shape, column);
+
+        appendShapePart(shape, QLatin1Char('F'));
+        appendFromShape(shape, query.getFrom());
+
+        for (const auto &join : query.getJoins()) {
+            appendShapePart(shape, QLatin1Char('J'), join->getType());
+            appendFromShape(shape, join->getTable());
+            appendWheresShape(shape, join->getWheres());
+        }
+
+        appendShapePart(shape, QLatin1Char('W'));
+        appendWheresShape(shape, query.getWheres());
+
+        appendShapePart(shape, QLatin1Char('G'));
+        for (const auto &column : query.getGroups())
+            appendColumnShape(shape, column);
+
+        for (const auto &having : query.getHavings()) {
+            appendShapePart(shape, QLatin1Char('H'),
+                            QString::number(static_cast<int>(having.type)));
+            appendShapePart(shape, QLatin1Char('b'), having.condition);
+            appendShapePart(shape, QLatin1Char('o'), having.comparison);
+            appendColumnShape(shape, having.column);
+            appendValueShape(shape, having.value);
+            appendShapePart(shape, QLatin1Char('r'), having.sql);
+        }
+
+        for (const auto &order : query.getOrders()) {
+            appendShapePart(shape, QLatin1Char('O'), order.direction);
+            appendColumnShape(shape, order.column);
+            appendShapePart(shape, QLatin1Char('r'), order.sql);
+        }
+
+        // The limit and offset are not bound, they are compiled into SQL
+        appendShapePart(shape, QLatin1Char('L'), QString::number(query.getLimit()));
+        appendShapePart(shape, QLatin1Char('S'), QString::number(query.getOffset()));
+
+        if (const auto &lock = query.getLock(); std::holds_alternative<bool>(lock))
+            appendShapePart(shape, QLatin1Char('K'), std::get<bool>(lock)
+                                                     ? QStringLiteral("1")
+                                                     : QStringLiteral("0"));
+        else if (std::holds_alternative<QString>(lock))
+            appendShapePart(shape, QLatin1Char('K'), std::get<QString>(lock));
+    }
+} // namespace
+
 /* public */
 
 QString Grammar::compileSelect(QueryBuilder &query) const
 {
-    /* If the query does not have any columns set, we'll set the columns to the
-       * character to just get all of the columns from the database. Then we
-       can build the query and concatenate all the pieces together as one. */
-    auto original = query.getColumns();
+    // Nothing to do, the compiled SQL cache is disabled
+    if (!m_compiledSqlCache.isEnabled())
+        return compileSelectInternal(query);
 
-    if (original.isEmpty())
-        query.setColumns({ASTERISK});
+    /* Queries with the same shape differ only in binding values, the bindings are
+       collected by the query builder so the cached SQL can be re-used as it is. */
+    const auto shape = getQueryShape(query);
 
-    /* To compile the query, we'll spin through each component of the query and
-       see if that component exists. If it does we'll just call the compiler
-       function for the component which is responsible for making the SQL. */
-    auto sql = concatenate(compileComponents(query));
+    if (const auto *const sql = m_compiledSqlCache.find(shape); sql != nullptr)
+        return *sql;
 
-    // Restore original columns value
-    query.setColumns(std::move(original));
+    auto sql = compileSelectInternal(query);
+
+    m_compiledSqlCache.insert(shape, sql);
 
     return sql;
 }
 
 QString Grammar::compileExists(QueryBuilder &query) const
 {
-    return QStringLiteral("select exists(%1) as %2").arg(compileSelect(query),
-                                                         wrap(QStringLiteral("exists")));
+    auto sql = QStringLiteral("select exists(");
+    sql += compileSelect(query);
+    sql += QStringLiteral(") as ");
+    wrapTo(sql, QStringLiteral("exists"));
+
+    return sql;
 }
 
 QString Grammar::compileInsert(const QueryBuilder &query,
@@ -62,12 +294,37 @@ QString Grammar::compileInsertOrIgnore(const QueryBuilder &/*unused*/,
                 "errors.");
 }
 
+QString Grammar::compileBulkInsert(const QString &table,
+                                   const QVector<QString> &columns,
+                                   const std::size_t rows) const
+{
+    const auto row = QStringLiteral("(%1)").arg(
+                         columnizeWithoutWrap(QVector<QString>(columns.size(),
+                                                               QStringLiteral("?"))));
+
+    return QStringLiteral("insert into %1 (%2) values %3").arg(
+                wrapTable(table), columnize(columns),
+                columnizeWithoutWrap(QVector<QString>(
+                                         static_cast<QVector<QString>::size_type>(rows),
+                                         row)));
+}
+
+QString Grammar::compileLoadDataFile(const QString &/*unused*/,
+                                     const QVector<QString> &/*unused*/,
+                                     const QString &/*unused*/) const
+{
+    throw Exceptions::RuntimeError(
+                "This database engine does not support loading data from the file.");
+}
+
 QString Grammar::compileUpdate(QueryBuilder &query,
                                const QVector<UpdateItem> &values) const
 {
     const auto table   = wrapTable(query.getFrom());
     const auto columns = compileUpdateColumns(values);
-    const auto wheres  = compileWheres(query);
+
+    QString wheres;
+    compileWheres(wheres, query);
 
     return query.getJoins().isEmpty()
             ? compileUpdateWithoutJoins(query, table, columns, wheres)
@@ -75,20 +332,21 @@ QString Grammar::compileUpdate(QueryBuilder &query,
 }
 
 QVector<QVariant>
-Grammar::prepareBindingsForUpdate(const BindingsMap &bindings, // NOLINT(readability-convert-member-functions-to-static)
+Grammar::prepareBindingsForUpdate(const Bindings &bindings, // NOLINT(readability-convert-member-functions-to-static)
                                   const QVector<UpdateItem> &values) const
 {
-    const auto &joinBindings = bindings.find(BindingType::JOIN).value();
+    const auto &allBindings = bindings.all();
+    const auto itBindings = allBindings.cbegin();
 
     QVector<QVariant> preparedBindings;
-    preparedBindings.reserve(
-                joinBindings.size() + values.size() +
-                // Rest of the bindings
-                computeReserveForBindingsMap(bindings, {BindingType::SELECT,
-                                                        BindingType::JOIN}));
+    // All bindings except the select bindings
+    preparedBindings.reserve(bindings.size() - bindings.size(BindingType::SELECT) +
+                             values.size());
 
     // Join bindings have to go first, I don't remember why 🫤
-    preparedBindings << joinBindings;
+    const auto itJoin = itBindings + bindings.offset(BindingType::JOIN);
+    std::copy(itJoin, itJoin + bindings.size(BindingType::JOIN),
+              std::back_inserter(preparedBindings));
 
     // Merge update values bindings
     std::transform(values.cbegin(), values.cend(), std::back_inserter(preparedBindings),
@@ -97,13 +355,14 @@ Grammar::prepareBindingsForUpdate(const BindingsMap &bindings, // NOLINT(readabi
         return updateItem.value;
     });
 
-    /* Flatten bindings map and exclude select and join bindings and than merge
-       all remaining bindings from flatten bindings map. */
-    const auto flatten = flatBindingsForUpdateDelete(bindings, {BindingType::SELECT,
-                                                                BindingType::JOIN});
+    /* Merge all remaining bindings, segments are ordered by the binding type so
+       the from bindings and all bindings after the join bindings are contiguous. */
+    const auto itFrom = itBindings + bindings.offset(BindingType::FROM);
+    std::copy(itFrom, itFrom + bindings.size(BindingType::FROM),
+              std::back_inserter(preparedBindings));
 
-    // std::copy() is ok, 'flatten' contains vector of references
-    std::copy(flatten.cbegin(), flatten.cend(), std::back_inserter(preparedBindings));
+    std::copy(itBindings + bindings.offset(BindingType::WHERE), allBindings.cend(),
+              std::back_inserter(preparedBindings));
 
     return preparedBindings;
 }
@@ -118,26 +377,18 @@ QString Grammar::compileUpsert(
 QString Grammar::compileDelete(QueryBuilder &query) const
 {
     const auto table  = wrapTable(query.getFrom());
-    const auto wheres = compileWheres(query);
+
+    QString wheres;
+    compileWheres(wheres, query);
 
     return query.getJoins().isEmpty() ? compileDeleteWithoutJoins(query, table, wheres)
                                       : compileDeleteWithJoins(query, table, wheres);
 }
 
-QVector<QVariant> Grammar::prepareBindingsForDelete(const BindingsMap &bindings) const  // NOLINT(readability-convert-member-functions-to-static)
+QVector<QVariant> Grammar::prepareBindingsForDelete(const Bindings &bindings) const  // NOLINT(readability-convert-member-functions-to-static)
 {
-    QVector<QVariant> preparedBindings;
-    preparedBindings.reserve(
-                computeReserveForBindingsMap(bindings, {BindingType::SELECT}));
-
-    /* Flatten bindings map and exclude select bindings and than merge all remaining
-       bindings from flatten bindings map. */
-    const auto flatten = flatBindingsForUpdateDelete(bindings, {BindingType::SELECT});
-
-    // std::copy() is ok, 'flatten' contains vector of references
-    std::copy(flatten.cbegin(), flatten.cend(), std::back_inserter(preparedBindings));
-
-    return preparedBindings;
+    // All bindings except the select bindings, they are the first segment
+    return bindings.valuesFrom(BindingType::FROM);
 }
 
 std::unordered_map<QString, QVector<QVariant>>
@@ -160,8 +411,84 @@ const QVector<QString> &Grammar::getOperators() const
     return cachedOperators;
 }
 
+Grammar &Grammar::setCompiledSqlCacheSize(const std::size_t size)
+{
+    m_compiledSqlCache.setCapacity(size);
+
+    return *this;
+}
+
+Grammar &Grammar::flushCompiledSqlCache()
+{
+    m_compiledSqlCache.clear();
+
+    return *this;
+}
+
 /* protected */
 
+QString Grammar::compileSelectInternal(QueryBuilder &query) const
+{
+    /* If the query does not have any columns set, we'll set the columns to the
+       * character to just get all of the columns from the database. Then we
+       can build the query and concatenate all the pieces together as one. */
+    auto original = query.getColumns();
+
+    if (original.isEmpty())
+        query.setColumns({ASTERISK});
+
+    /* Nested selects (eg. the whereExists()) are compiled by the compileSelect()
+       too, only the outermost select uses and updates the running estimate, short
+       nested selects would lower it. */
+    const auto outermost = m_compileSelectDepth == 0;
+
+    /* All the components are compiled into one SQL buffer, it's reserved using
+       the running estimate so it's mostly allocated only once. */
+    QString sql;
+    sql.reserve(outermost ? std::max(m_sqlSizeEstimate, MinSqlSizeEstimate)
+                          : MinSqlSizeEstimate);
+
+    ++m_compileSelectDepth;
+
+    /* To compile the query, we'll spin through each component of the query and
+       see if that component exists. If it does we'll just call the compiler
+       function for the component which is responsible for making the SQL. */
+    try {
+        compileComponents(sql, query);
+
+    } catch (...) {
+
+        --m_compileSelectDepth;
+        // Re-throw
+        throw;
+    }
+
+    --m_compileSelectDepth;
+
+    // Decrease the estimate slowly so one long query doesn't oversize all next buffers
+    if (outermost)
+        m_sqlSizeEstimate = std::max(sql.size(),
+                                     m_sqlSizeEstimate - m_sqlSizeEstimate / 8);
+
+    // Restore original columns value
+    query.setColumns(std::move(original));
+
+    return sql;
+}
+
+QString Grammar::getQueryShape(const QueryBuilder &query) const
+{
+    QString shape;
+    shape.reserve(256);
+
+    // The table prefix is compiled into SQL too
+    appendShapePart(shape, QLatin1Char('P'), getTablePrefix());
+
+    appendQueryShape(shape, query);
+
+    return shape;
+}
+
 bool Grammar::shouldCompileAggregate(const std::optional<AggregateItem> &aggregate)
 {
     return aggregate.has_value() && !aggregate->function.isEmpty();
@@ -182,52 +509,59 @@ bool Grammar::shouldCompileFrom(const FromClause &from)
              !std::get<QString>(from).isEmpty());
 }
 
-QStringList Grammar::compileComponents(const QueryBuilder &query) const
+void Grammar::compileComponents(QString &sql, const QueryBuilder &query) const
 {
-    const auto &compileMap = getCompileMap();
-    /* This is not 100% correct as the getCompileMap() is virtual, but it's guaranteed
-       that all compileMap-s have the same size, so it's safe to cache this size. */
-    static const auto compileMapSize = compileMap.size();
+    for (const auto &component : getCompileMap()) {
+        if (!component.isset || !component.isset(query))
+            continue;
 
-    QStringList sql;
-    sql.reserve(compileMapSize);
+        const auto size = sql.size();
 
-    for (const auto &component : compileMap)
-        if (component.isset && component.isset(query))
-            sql << std::invoke(component.compileMethod, query);
+        // Components are separated by the space
+        if (size > 0)
+            sql += SPACE;
 
-    return sql;
+        std::invoke(component.compileMethod, sql, query);
+
+        // Nothing was compiled (eg. the lock), remove the separator
+        if (sql.size() == size + 1)
+            sql.truncate(size);
+    }
 }
 
-QString Grammar::compileAggregate(const QueryBuilder &query) const
+void Grammar::compileAggregate(QString &sql, const QueryBuilder &query) const
 {
     /* Whether the aggregate contains a value is checked earlier by
        the shouldCompileAggregate() method. */
     const auto &[function, columns] = *query.getAggregate(); // NOLINT(bugprone-unchecked-optional-access)
     const auto &distinct = query.getDistinct();
 
-    auto column = columnize(columns);
+    sql += QStringLiteral("select ");
+    sql += function;
+    sql += QLatin1Char('(');
 
     /* If the query has a "distinct" constraint and we're not asking for all columns
        we need to prepend "distinct" onto the column name so that the query takes
        it into account when it performs the aggregating operations on the data. */
-    if (std::holds_alternative<bool>(distinct) && query.getDistinct<bool>() &&
-        column != ASTERISK
-    ) T_LIKELY
-        column = QStringLiteral("distinct %1").arg(column);
+    if (std::holds_alternative<bool>(distinct)) T_LIKELY {
+        const auto position = sql.size();
 
-    else if (std::holds_alternative<QStringList>(distinct)) T_UNLIKELY
-        column = QStringLiteral("distinct %1")
-                 .arg(columnize(std::get<QStringList>(distinct)));
+        columnizeTo(sql, columns);
 
-    return QStringLiteral("select %1(%2) as %3").arg(function, column,
-                                                     wrap(QStringLiteral("aggregate")));
+        if (std::get<bool>(distinct) && QStringView(sql).mid(position) != ASTERISK)
+            sql.insert(position, QStringLiteral("distinct "));
+    }
+    else T_UNLIKELY {
+        sql += QStringLiteral("distinct ");
+        columnizeTo(sql, std::get<QStringList>(distinct));
+    }
+
+    sql += QStringLiteral(") as ");
+    wrapTo(sql, QStringLiteral("aggregate"));
 }
 
-QString Grammar::compileColumns(const QueryBuilder &query) const
+void Grammar::compileColumns(QString &sql, const QueryBuilder &query) const
 {
-    QString select;
-
     const auto &distinct = query.getDistinct();
 
     if (!std::holds_alternative<bool>(distinct))
@@ -237,88 +571,97 @@ QString Grammar::compileColumns(const QueryBuilder &query) const
                 .arg(query.getConnection().getName()));
 
     if (std::get<bool>(distinct))
-        select = QStringLiteral("select distinct %1");
+        sql += QStringLiteral("select distinct ");
     else
-        select = QStringLiteral("select %1");
+        sql += QStringLiteral("select ");
 
-    return select.arg(columnize(query.getColumns()));
+    columnizeTo(sql, query.getColumns());
 }
 
-QString Grammar::compileFrom(const QueryBuilder &query) const
+void Grammar::compileFrom(QString &sql, const QueryBuilder &query) const
 {
-    return QStringLiteral("from %1").arg(wrapTable(query.getFrom()));
+    sql += QStringLiteral("from ");
+    wrapTableTo(sql, query.getFrom());
 }
 
-QString Grammar::compileWheres(const QueryBuilder &query) const
+void Grammar::compileWheres(QString &sql, const QueryBuilder &query) const
 {
-    const auto sql = compileWheresToVector(query);
+    // Nothing to compile
+    if (query.getWheres().isEmpty())
+        return;
 
-    if (!sql.isEmpty())
-        return concatenateWhereClauses(query, sql);
+    // Is it a query instance of the JoinClause?
+    if (dynamic_cast<const JoinClause *>(&query) == nullptr)
+        sql += QStringLiteral("where ");
+    else
+        sql += QStringLiteral("on ");
 
-    return {};
+    compileWhereClauses(sql, query);
 }
 
-QStringList Grammar::compileWheresToVector(const QueryBuilder &query) const
+void Grammar::compileWhereClauses(QString &sql, const QueryBuilder &query) const
 {
     const auto &wheres = query.getWheres();
 
-    QStringList compiledWheres;
-    compiledWheres.reserve(wheres.size());
-
-    for (const auto &where : wheres)
-        compiledWheres << SPACE_IN.arg(where.condition,
-                                       std::invoke(getWhereMethod(where.type), where));
+    for (auto itWhere = wheres.cbegin(); itWhere != wheres.cend(); ++itWhere) {
+        const auto isFirst = itWhere == wheres.cbegin();
 
-    return compiledWheres;
-}
+        if (!isFirst)
+            sql += SPACE;
 
-QString Grammar::concatenateWhereClauses(const QueryBuilder &query,
-                                         const QStringList &sql)
-{
-    // Is it a query instance of the JoinClause?
-    const auto conjunction = dynamic_cast<const JoinClause *>(&query) == nullptr
-                             ? QStringLiteral("where")
-                             : QStringLiteral("on");
+        appendBoolean(sql, itWhere->condition, isFirst);
 
-    return SPACE_IN.arg(conjunction, removeLeadingBoolean(sql.join(SPACE)));
+        std::invoke(getWhereMethod(itWhere->type), sql, *itWhere);
+    }
 }
 
-QString Grammar::compileJoins(const QueryBuilder &query) const
+void Grammar::compileJoins(QString &sql, const QueryBuilder &query) const
 {
     const auto &joins = query.getJoins();
 
-    QStringList sql;
-    sql.reserve(joins.size());
+    for (auto itJoin = joins.cbegin(); itJoin != joins.cend(); ++itJoin) {
+        const auto &join = **itJoin;
+
+        if (itJoin != joins.cbegin())
+            sql += SPACE;
 
-    for (const auto &join : joins)
-        sql << QStringLiteral("%1 join %2 %3").arg(join->getType(),
-                                                   wrapTable(join->getTable()),
-                                                   compileWheres(*join));
+        sql += join.getType();
+        sql += QStringLiteral(" join ");
+        wrapTableTo(sql, join.getTable());
 
-    return sql.join(SPACE);
+        // The cross join doesn't need to have any constraints
+        if (!join.getWheres().isEmpty()) {
+            sql += SPACE;
+            compileWheres(sql, join);
+        }
+    }
 }
 
-QString Grammar::compileGroups(const QueryBuilder &query) const
+void Grammar::compileGroups(QString &sql, const QueryBuilder &query) const
 {
-    return QStringLiteral("group by %1").arg(columnize(query.getGroups()));
+    sql += QStringLiteral("group by ");
+    columnizeTo(sql, query.getGroups());
 }
 
-QString Grammar::compileHavings(const QueryBuilder &query) const
+void Grammar::compileHavings(QString &sql, const QueryBuilder &query) const
 {
     const auto &havings = query.getHavings();
 
-    QStringList compiledHavings;
-    compiledHavings.reserve(havings.size());
+    sql += QStringLiteral("having ");
+
+    for (auto itHaving = havings.cbegin(); itHaving != havings.cend(); ++itHaving) {
+        const auto isFirst = itHaving == havings.cbegin();
+
+        if (!isFirst)
+            sql += SPACE;
 
-    for (const auto &having : havings)
-        compiledHavings << compileHaving(having);
+        appendBoolean(sql, itHaving->condition, isFirst);
 
-    return QStringLiteral("having %1").arg(removeLeadingBoolean(
-                                               compiledHavings.join(SPACE)));
+        compileHaving(sql, *itHaving);
+    }
 }
 
-QString Grammar::compileHaving(const HavingConditionItem &having) const
+void Grammar::compileHaving(QString &sql, const HavingConditionItem &having) const
 {
     /* If the having clause is "raw", we can just return the clause straight away
        without doing any more processing on it. Otherwise, we will compile the
@@ -326,11 +669,13 @@ QString Grammar::compileHaving(const HavingConditionItem &having) const
     switch (having.type) {
     T_LIKELY
     case HavingType::BASIC:
-        return compileBasicHaving(having);
+        compileBasicHaving(sql, having);
+        break;
 
     T_UNLIKELY
     case HavingType::RAW:
-        return SPACE_IN.arg(having.condition, having.sql);
+        sql += having.sql;
+        break;
 
     T_UNLIKELY
     default:
@@ -338,190 +683,219 @@ QString Grammar::compileHaving(const HavingConditionItem &having) const
     }
 }
 
-QString Grammar::compileBasicHaving(const HavingConditionItem &having) const
+void Grammar::compileBasicHaving(QString &sql, const HavingConditionItem &having) const
 {
-    return QStringLiteral("%1 %2 %3 %4").arg(having.condition, wrap(having.column),
-                                             having.comparison, parameter(having.value));
+    wrapTo(sql, having.column);
+    sql += SPACE;
+    sql += having.comparison;
+    sql += SPACE;
+    parameterTo(sql, having.value);
 }
 
-QString Grammar::compileOrders(const QueryBuilder &query) const
+void Grammar::compileOrders(QString &sql, const QueryBuilder &query) const
 {
-    if (query.getOrders().isEmpty())
-        return QLatin1String("");
+    const auto &orders = query.getOrders();
 
-    return QStringLiteral("order by %1")
-            .arg(columnizeWithoutWrap(compileOrdersToVector(query)));
-}
+    if (orders.isEmpty())
+        return;
 
-QStringList Grammar::compileOrdersToVector(const QueryBuilder &query) const
-{
-    const auto &orders = query.getOrders();
+    sql += QStringLiteral("order by ");
 
-    QStringList compiledOrders;
-    compiledOrders.reserve(orders.size());
+    for (auto itOrder = orders.cbegin(); itOrder != orders.cend(); ++itOrder) {
+        if (itOrder != orders.cbegin())
+            sql += COMMA;
 
-    for (const auto &order : orders)
-        if (order.sql.isEmpty()) T_LIKELY
-            compiledOrders << SPACE_IN.arg(wrap(order.column),
-                                           order.direction.toLower());
+        if (itOrder->sql.isEmpty()) T_LIKELY {
+            wrapTo(sql, itOrder->column);
+            sql += SPACE;
+            sql += itOrder->direction.toLower();
+        }
         else T_UNLIKELY
-            compiledOrders << order.sql;
-
-    return compiledOrders;
+            sql += itOrder->sql;
+    }
 }
 
-QString Grammar::compileLimit(const QueryBuilder &query) const // NOLINT(readability-convert-member-functions-to-static)
+void Grammar::compileLimit(QString &sql, const QueryBuilder &query) const // NOLINT(readability-convert-member-functions-to-static)
 {
-    return QStringLiteral("limit %1").arg(query.getLimit());
+    sql += QStringLiteral("limit ");
+    sql += QString::number(query.getLimit());
 }
 
-QString Grammar::compileOffset(const QueryBuilder &query) const // NOLINT(readability-convert-member-functions-to-static)
+void Grammar::compileOffset(QString &sql, const QueryBuilder &query) const // NOLINT(readability-convert-member-functions-to-static)
 {
-    return QStringLiteral("offset %1").arg(query.getOffset());
+    sql += QStringLiteral("offset ");
+    sql += QString::number(query.getOffset());
 }
 
-QString Grammar::compileLock(const QueryBuilder &query) const
+void Grammar::compileLock(QString &sql, const QueryBuilder &query) const
 {
-    const auto &lock = query.getLock();
-
-    if (std::holds_alternative<QString>(lock))
-        return std::get<QString>(lock);
-
-    return QLatin1String("");
+    if (const auto &lock = query.getLock(); std::holds_alternative<QString>(lock))
+        sql += std::get<QString>(lock);
 }
 
-QString Grammar::whereBasic(const WhereConditionItem &where) const
+void Grammar::whereBasic(QString &sql, const WhereConditionItem &where) const
 {
     // FEATURE postgres, try operators with ? vs pdo str_replace(?, ??) https://wiki.php.net/rfc/pdo_escape_placeholders silverqx
-    return QStringLiteral("%1 %2 %3").arg(wrap(where.column),
-                                          where.comparison,
-                                          parameter(where.value));
+    wrapTo(sql, where.column);
+    sql += SPACE;
+    sql += where.comparison;
+    sql += SPACE;
+    parameterTo(sql, std::get<QVariant>(where.data));
 }
 
-QString Grammar::whereNested(const WhereConditionItem &where) const
+void Grammar::whereNested(QString &sql, const WhereConditionItem &where) const
 {
-    /* Here we will calculate what portion of the string we need to remove. If this
-       is a join clause query, we need to remove the "on" portion of the SQL and
-       if it is a normal query we need to take the leading "where" of queries. */
-    auto compiled = compileWheres(*where.nestedQuery);
-
-    const auto offset = compiled.indexOf(SPACE) + 1;
-
-    return PARENTH_ONE.arg(compiled.remove(0, offset));
+    /* The nested query's where clauses are compiled without the leading "where"
+       (or "on" if this is a join clause query). */
+    sql += QLatin1Char('(');
+    compileWhereClauses(sql, *std::get<std::shared_ptr<QueryBuilder>>(where.data));
+    sql += QLatin1Char(')');
 }
 
-QString Grammar::whereColumn(const WhereConditionItem &where) const
+void Grammar::whereColumn(QString &sql, const WhereConditionItem &where) const
 {
-    /* In this where type where.column contains first column and where,value contains
+    /* In this where type where.column contains first column and where.data contains
        second column. */
-    return QStringLiteral("%1 %2 %3").arg(wrap(where.column),
-                                          where.comparison,
-                                          wrap(where.columnTwo));
+    wrapTo(sql, where.column);
+    sql += SPACE;
+    sql += where.comparison;
+    sql += SPACE;
+    wrapTo(sql, std::get<WhereColumnTwoItem>(where.data).column);
 }
 
-QString Grammar::whereIn(const WhereConditionItem &where) const
+void Grammar::whereIn(QString &sql, const WhereConditionItem &where) const
 {
-    if (where.values.isEmpty())
-        return QStringLiteral("0 = 1");
+    const auto &values = std::get<QVector<QVariant>>(where.data);
+
+    if (values.isEmpty()) {
+        sql += QStringLiteral("0 = 1");
+        return;
+    }
 
-    return QStringLiteral("%1 in (%2)").arg(wrap(where.column),
-                                            parametrize(where.values));
+    wrapTo(sql, where.column);
+    sql += QStringLiteral(" in (");
+    parametrizeTo(sql, values);
+    sql += QLatin1Char(')');
 }
 
-QString Grammar::whereNotIn(const WhereConditionItem &where) const
+void Grammar::whereNotIn(QString &sql, const WhereConditionItem &where) const
 {
-    if (where.values.isEmpty())
-        return QStringLiteral("1 = 1");
+    const auto &values = std::get<QVector<QVariant>>(where.data);
 
-    return QStringLiteral("%1 not in (%2)").arg(wrap(where.column),
-                                                parametrize(where.values));
+    if (values.isEmpty()) {
+        sql += QStringLiteral("1 = 1");
+        return;
+    }
+
+    wrapTo(sql, where.column);
+    sql += QStringLiteral(" not in (");
+    parametrizeTo(sql, values);
+    sql += QLatin1Char(')');
 }
 
-QString Grammar::whereNull(const WhereConditionItem &where) const
+void Grammar::whereNull(QString &sql, const WhereConditionItem &where) const
 {
-    return QStringLiteral("%1 is null").arg(wrap(where.column));
+    wrapTo(sql, where.column);
+    sql += QStringLiteral(" is null");
 }
 
-QString Grammar::whereNotNull(const WhereConditionItem &where) const
+void Grammar::whereNotNull(QString &sql, const WhereConditionItem &where) const
 {
-    return QStringLiteral("%1 is not null").arg(wrap(where.column));
+    wrapTo(sql, where.column);
+    sql += QStringLiteral(" is not null");
 }
 
-QString Grammar::whereRaw(const WhereConditionItem &where) const // NOLINT(readability-convert-member-functions-to-static)
+void Grammar::whereRaw(QString &sql, const WhereConditionItem &where) const // NOLINT(readability-convert-member-functions-to-static)
 {
-    return where.sql;
+    sql += std::get<WhereRawItem>(where.data).sql;
 }
 
-QString Grammar::whereExists(const WhereConditionItem &where) const
+void Grammar::whereExists(QString &sql, const WhereConditionItem &where) const
 {
-    return QStringLiteral("exists (%1)").arg(compileSelect(*where.nestedQuery));
+    sql += QStringLiteral("exists (");
+    sql += compileSelect(*std::get<std::shared_ptr<QueryBuilder>>(where.data));
+    sql += QLatin1Char(')');
 }
 
-QString Grammar::whereNotExists(const WhereConditionItem &where) const
+void Grammar::whereNotExists(QString &sql, const WhereConditionItem &where) const
 {
-    return QStringLiteral("not exists (%1)").arg(compileSelect(*where.nestedQuery));
+    sql += QStringLiteral("not exists (");
+    sql += compileSelect(*std::get<std::shared_ptr<QueryBuilder>>(where.data));
+    sql += QLatin1Char(')');
 }
 
-QString Grammar::whereRowValues(const WhereConditionItem &where) const
+void Grammar::whereRowValues(QString &sql, const WhereConditionItem &where) const
 {
-    return QStringLiteral("(%1) %2 (%3)").arg(columnize(where.columns),
-                                              where.comparison,
-                                              parametrize(where.values));
+    const auto &rowValues = std::get<WhereRowValuesItem>(where.data);
+
+    sql += QLatin1Char('(');
+    columnizeTo(sql, rowValues.columns);
+    sql += QStringLiteral(") ");
+    sql += where.comparison;
+    sql += QStringLiteral(" (");
+    parametrizeTo(sql, rowValues.values);
+    sql += QLatin1Char(')');
 }
 
-QString Grammar::whereBetween(const WhereConditionItem &where) const
+void Grammar::whereBetween(QString &sql, const WhereConditionItem &where) const
 {
-    const auto between = where.nope ? QStringLiteral("not between")
-                                    : QStringLiteral("between");
+    const auto &values = std::get<WhereBetweenItem>(where.data);
 
-    return QStringLiteral("%1 %2 %3 and %4").arg(wrap(where.column), between,
-                                                 parameter(where.between.min),
-                                                 parameter(where.between.max));
+    wrapTo(sql, where.column);
+    sql += where.nope ? QStringLiteral(" not between ")
+                      : QStringLiteral(" between ");
+    parameterTo(sql, values.min);
+    sql += QStringLiteral(" and ");
+    parameterTo(sql, values.max);
 }
 
-QString Grammar::whereBetweenColumns(const WhereConditionItem &where) const
+void Grammar::whereBetweenColumns(QString &sql, const WhereConditionItem &where) const
 {
-    auto between = where.nope ? QStringLiteral("not between")
-                              : QStringLiteral("between");
+    const auto &betweenColumns = std::get<WhereBetweenColumnsItem>(where.data);
 
-    return QStringLiteral("%1 %2 %3 and %4").arg(wrap(where.column),
-                                                 std::move(between),
-                                                 wrap(where.betweenColumns.min),
-                                                 wrap(where.betweenColumns.max));
+    wrapTo(sql, where.column);
+    sql += where.nope ? QStringLiteral(" not between ")
+                      : QStringLiteral(" between ");
+    wrapTo(sql, betweenColumns.min);
+    sql += QStringLiteral(" and ");
+    wrapTo(sql, betweenColumns.max);
 }
 
-QString Grammar::whereDate(const WhereConditionItem &where) const
+void Grammar::whereDate(QString &sql, const WhereConditionItem &where) const
 {
-    return dateBasedWhere(QStringLiteral("date"), where);
+    dateBasedWhere(sql, QStringLiteral("date"), where);
 }
 
-QString Grammar::whereTime(const WhereConditionItem &where) const
+void Grammar::whereTime(QString &sql, const WhereConditionItem &where) const
 {
-    return dateBasedWhere(QStringLiteral("time"), where);
+    dateBasedWhere(sql, QStringLiteral("time"), where);
 }
 
-QString Grammar::whereDay(const WhereConditionItem &where) const
+void Grammar::whereDay(QString &sql, const WhereConditionItem &where) const
 {
-    return dateBasedWhere(QStringLiteral("day"), where);
+    dateBasedWhere(sql, QStringLiteral("day"), where);
 }
 
-QString Grammar::whereMonth(const WhereConditionItem &where) const
+void Grammar::whereMonth(QString &sql, const WhereConditionItem &where) const
 {
-    return dateBasedWhere(QStringLiteral("month"), where);
+    dateBasedWhere(sql, QStringLiteral("month"), where);
 }
 
-QString Grammar::whereYear(const WhereConditionItem &where) const
+void Grammar::whereYear(QString &sql, const WhereConditionItem &where) const
 {
-    return dateBasedWhere(QStringLiteral("year"), where);
+    dateBasedWhere(sql, QStringLiteral("year"), where);
 }
 
-QString
-Grammar::dateBasedWhere(const QString &type, const WhereConditionItem &where) const
+void Grammar::dateBasedWhere(QString &sql, const QString &type,
+                             const WhereConditionItem &where) const
 {
-    return QStringLiteral("%1(%2) %3 %4").arg(type,
-                                              wrap(where.column),
-                                              where.comparison,
-                                              parameter(where.value));
+    sql += type;
+    sql += QLatin1Char('(');
+    wrapTo(sql, where.column);
+    sql += QStringLiteral(") ");
+    sql += where.comparison;
+    sql += SPACE;
+    parameterTo(sql, std::get<QVariant>(where.data));
 }
 
 QStringList
@@ -565,7 +939,8 @@ QString
 Grammar::compileUpdateWithJoins(const QueryBuilder &query, const QString &table,
                                 const QString &columns, const QString &wheres) const
 {
-    const auto joins = compileJoins(query);
+    QString joins;
+    compileJoins(joins, query);
 
     // The table argument is already wrapped
     return QStringLiteral("update %1 %2 set %3 %4").arg(table, joins, columns, wheres);
@@ -584,100 +959,14 @@ QString Grammar::compileDeleteWithJoins(const QueryBuilder &query, const QString
 {
     const auto alias = getAliasFromFrom(table);
 
-    const auto joins = compileJoins(query);
+    QString joins;
+    compileJoins(joins, query);
 
     /* Alias has to be after the delete keyword and aliased table definition after the
        from keyword. */
     return QStringLiteral("delete %1 from %2 %3 %4").arg(alias, table, joins, wheres);
 }
 
-QString Grammar::concatenate(QStringList &&segments)
-{
-    QString result;
-    result.reserve(ContainerUtils::countStringSizes(segments, 1) + 8);
-
-    for (auto &&segment : segments) {
-        if (segment.isEmpty())
-            continue;
-
-        result += segment;
-        result += SPACE;
-    }
-
-    return result.trimmed();
-}
-
-QString Grammar::removeLeadingBoolean(QString &&statement)
-{
-    // Skip all whitespaces after and/or, to avoid trimmed() for performance reasons
-    const auto firstChar = [&statement](const auto from)
-    {
-        for (auto i = from; i < statement.size(); ++i)
-            if (statement.at(i) != SPACE)
-                return i;
-
-        // Return initial value if space has not been found, should never happen :/
-        return from;
-    };
-
-    static const auto AndTmpl = QStringLiteral("and ");
-    static const auto OrTmpl =  QStringLiteral("or ");
-
-    // RegExp not used for performance reasons
-    /* Before and/or could not be whitespace, current implementation doesn't include
-       whitespaces before. */
-    if (statement.startsWith(AndTmpl))
-#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
-        return statement.sliced(firstChar(4));
-#else
-        return statement.mid(firstChar(4));
-#endif
-    if (statement.startsWith(OrTmpl))
-#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
-        return statement.sliced(firstChar(3));
-#else
-        return statement.mid(firstChar(3));
-#endif
-
-    return std::move(statement);
-}
-
-QVector<std::reference_wrapper<const QVariant>>
-Grammar::flatBindingsForUpdateDelete(const BindingsMap &bindings,
-                                     const QVector<BindingType> &exclude)
-{
-    QVector<std::reference_wrapper<const QVariant>> cleanBindingsFlatten;
-    cleanBindingsFlatten.reserve(computeReserveForBindingsMap(bindings, exclude));
-
-    for (auto itBindings = bindings.constBegin();
-         itBindings != bindings.constEnd(); ++itBindings
-    )
-        if (!exclude.isEmpty() && exclude.contains(itBindings.key()))
-            continue;
-        else
-            for (const auto &binding : itBindings.value())
-                cleanBindingsFlatten << std::cref(binding);
-
-    return cleanBindingsFlatten;
-}
-
-QVector<QVariant>::size_type
-Grammar::computeReserveForBindingsMap(const BindingsMap &bindings,
-                                      const QVector<BindingType> &exclude)
-{
-    QVector<QVariant>::size_type size = 0;
-
-    for (auto itBindings = bindings.constBegin();
-         itBindings != bindings.constEnd(); ++itBindings
-    )
-        if (!exclude.isEmpty() && exclude.contains(itBindings.key()))
-            continue;
-        else
-            size += itBindings.value().size();
-
-    return size;
-}
-
 } // namespace Orm::Query::Grammars
 
 TINYORM_END_COMMON_NAMESPACE
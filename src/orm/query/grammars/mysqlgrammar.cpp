@@ -27,6 +27,22 @@ QString MySqlGrammar::compileInsertOrIgnore(const QueryBuilder &query,
     return compileInsert(query, values).replace(0, 6, QStringLiteral("insert ignore"));
 }
 
+QString MySqlGrammar::compileLoadDataFile(const QString &table,
+                                          const QVector<QString> &columns,
+                                          const QString &filepath) const
+{
+    // The backslash is the escape character in the MySQL string literals
+    auto filepath_ = filepath;
+    filepath_.replace(QLatin1Char('\\'), QStringLiteral("\\\\"))
+             .replace(QLatin1Char('\''), QStringLiteral("\\'"));
+
+    return QStringLiteral("load data local infile '%1' into table %2 "
+                          "character set utf8mb4 "
+                          "fields terminated by '\\t' escaped by '\\\\' "
+                          "lines terminated by '\\n' (%3)")
+            .arg(filepath_, wrapTable(table), columnize(columns));
+}
+
 QString MySqlGrammar::compileUpsert(
         QueryBuilder &query, const QVector<QVariantMap> &values,
         const QStringList &/*unused*/, const QStringList &update) const
@@ -64,15 +80,15 @@ QString MySqlGrammar::compileUpsert(
     return NOSPACE.arg(sql, columns.join(COMMA));
 }
 
-QString MySqlGrammar::compileLock(const QueryBuilder &query) const
+void MySqlGrammar::compileLock(QString &sql, const QueryBuilder &query) const
 {
     const auto &lock = query.getLock();
 
     if (!std::holds_alternative<QString>(lock))
-        return std::get<bool>(lock) ? QStringLiteral("for update") :
+        sql += std::get<bool>(lock) ? QStringLiteral("for update") :
                                       QStringLiteral("lock in share mode");
-
-    return std::get<QString>(lock);
+    else
+        sql += std::get<QString>(lock);
 }
 
 QString MySqlGrammar::compileRandom(const QString &seed) const
@@ -89,13 +105,9 @@ const QVector<QString> &MySqlGrammar::getOperators() const
 
 /* protected */
 
-QString MySqlGrammar::wrapValue(QString value) const
+void MySqlGrammar::wrapValueTo(QString &sql, const QStringView value) const
 {
-    if (value == ASTERISK_C)
-        return value;
-
-    return QStringLiteral("`%1`").arg(value.replace(QStringLiteral("`"),
-                                                    QStringLiteral("``")));
+    wrapValueWith(sql, value, QLatin1Char('`'));
 }
 
 const QMap<Grammar::SelectComponentType, Grammar::SelectComponentValue> &
@@ -109,9 +121,9 @@ MySqlGrammar::getCompileMap() const
     {
         return [this,
                 compileMethod = std::forward<decltype (compileMethod)>(compileMethod)]
-               (const auto &query)
+               (QString &sql, const auto &query)
         {
-            return std::invoke(compileMethod, this, query);
+            std::invoke(compileMethod, this, sql, query);
         };
     };
 
@@ -148,7 +160,7 @@ MySqlGrammar::getCompileMap() const
     return cached;
 }
 
-const std::function<QString(const WhereConditionItem &)> &
+const Grammar::WhereMethod &
 MySqlGrammar::getWhereMethod(const WhereType whereType) const
 {
     /* Needed, because some compileXx() methods are overloaded, this way I will capture
@@ -159,9 +171,9 @@ MySqlGrammar::getWhereMethod(const WhereType whereType) const
     {
         return [this,
                 compileMethod = std::forward<decltype (compileMethod)>(compileMethod)]
-               (const auto &query)
+               (QString &sql, const auto &query)
         {
-            return std::invoke(compileMethod, this, query);
+            std::invoke(compileMethod, this, sql, query);
         };
     };
 
@@ -169,7 +181,7 @@ MySqlGrammar::getWhereMethod(const WhereType whereType) const
     // An order has to be the same as in enum struct WhereType
     // FUTURE QHash would has faster lookup, I should choose QHash, fix also another Grammars silverx
     T_THREAD_LOCAL
-    static const QVector<std::function<QString(const WhereConditionItem &)>> cached {
+    static const QVector<WhereMethod> cached {
         bind(&MySqlGrammar::whereBasic),
         bind(&MySqlGrammar::whereNested),
         bind(&MySqlGrammar::whereColumn),
@@ -210,11 +222,15 @@ MySqlGrammar::compileUpdateWithoutJoins(
 
     /* When using MySQL, udpate statements may contain order by statements and limits
        so we will compile both of those here. */
-    if (!query.getOrders().isEmpty())
-        sql += QStringLiteral(" %1").arg(compileOrders(query));
+    if (!query.getOrders().isEmpty()) {
+        sql += SPACE;
+        compileOrders(sql, query);
+    }
 
-    if (query.getLimit() > -1)
-        sql += QStringLiteral(" %1").arg(compileLimit(query));
+    if (query.getLimit() > -1) {
+        sql += SPACE;
+        compileLimit(sql, query);
+    }
 
     return sql;
 }
@@ -229,11 +245,15 @@ MySqlGrammar::compileDeleteWithoutJoins(const QueryBuilder &query, const QString
     /* When using MySQL, delete statements may contain order by statements and limits
        so we will compile both of those here. Once we have finished compiling this
        we will return the completed SQL statement so it will be executed for us. */
-    if (!query.getOrders().isEmpty())
-        sql += QStringLiteral(" %1").arg(compileOrders(query));
+    if (!query.getOrders().isEmpty()) {
+        sql += SPACE;
+        compileOrders(sql, query);
+    }
 
-    if (query.getLimit() > -1)
-        sql += QStringLiteral(" %1").arg(compileLimit(query));
+    if (query.getLimit() > -1) {
+        sql += SPACE;
+        compileLimit(sql, query);
+    }
 
     return sql;
 }
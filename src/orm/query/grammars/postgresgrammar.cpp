@@ -70,15 +70,15 @@ PostgresGrammar::compileTruncate(const QueryBuilder &query) const
             {}}};
 }
 
-QString PostgresGrammar::compileLock(const QueryBuilder &query) const
+void PostgresGrammar::compileLock(QString &sql, const QueryBuilder &query) const
 {
     const auto &lock = query.getLock();
 
     if (!std::holds_alternative<QString>(lock))
-        return std::get<bool>(lock) ? QStringLiteral("for update")
+        sql += std::get<bool>(lock) ? QStringLiteral("for update")
                                     : QStringLiteral("for share");
-
-    return std::get<QString>(lock);
+    else
+        sql += std::get<QString>(lock);
 }
 
 const QVector<QString> &PostgresGrammar::getOperators() const
@@ -94,14 +94,18 @@ const QVector<QString> &PostgresGrammar::getOperators() const
     return cachedOperators;
 }
 
-QString PostgresGrammar::whereBasic(const WhereConditionItem &where) const
+void PostgresGrammar::whereBasic(QString &sql, const WhereConditionItem &where) const
 {
-    if (!where.comparison.contains(LIKE, Qt::CaseInsensitive))
-        return Grammar::whereBasic(where);
-
-    return QStringLiteral("%1::text %2 %3").arg(wrap(where.column),
-                                                where.comparison,
-                                                parameter(where.value));
+    if (!where.comparison.contains(LIKE, Qt::CaseInsensitive)) {
+        Grammar::whereBasic(sql, where);
+        return;
+    }
+
+    wrapTo(sql, where.column);
+    sql += QStringLiteral("::text ");
+    sql += where.comparison;
+    sql += SPACE;
+    parameterTo(sql, std::get<QVariant>(where.data));
 }
 
 /* protected */
@@ -117,9 +121,9 @@ PostgresGrammar::getCompileMap() const
     {
         return [this,
                 compileMethod = std::forward<decltype (compileMethod)>(compileMethod)]
-               (const auto &query)
+               (QString &sql, const auto &query)
         {
-            return std::invoke(compileMethod, this, query);
+            std::invoke(compileMethod, this, sql, query);
         };
     };
 
@@ -155,7 +159,7 @@ PostgresGrammar::getCompileMap() const
     return cached;
 }
 
-const std::function<QString(const WhereConditionItem &)> &
+const Grammar::WhereMethod &
 PostgresGrammar::getWhereMethod(const WhereType whereType) const
 {
     /* Needed, because some compileXx() methods are overloaded, this way I will capture
@@ -166,9 +170,9 @@ PostgresGrammar::getWhereMethod(const WhereType whereType) const
     {
         return [this,
                 compileMethod = std::forward<decltype (compileMethod)>(compileMethod)]
-               (const auto &query)
+               (QString &sql, const auto &query)
         {
-            return std::invoke(compileMethod, this, query);
+            std::invoke(compileMethod, this, sql, query);
         };
     };
 
@@ -176,7 +180,7 @@ PostgresGrammar::getWhereMethod(const WhereType whereType) const
     // An order has to be the same as in enum struct WhereType
     // FUTURE QHash would has faster lookup, I should choose QHash, fix also another Grammars silverx
     T_THREAD_LOCAL
-    static const QVector<std::function<QString(const WhereConditionItem &)>> cached {
+    static const QVector<WhereMethod> cached {
         bind(&PostgresGrammar::whereBasic),
         bind(&PostgresGrammar::whereNested),
         bind(&PostgresGrammar::whereColumn),
@@ -207,46 +211,53 @@ PostgresGrammar::getWhereMethod(const WhereType whereType) const
     return cached.at(type);
 }
 
-QString PostgresGrammar::compileColumns(const QueryBuilder &query) const
+void PostgresGrammar::compileColumns(QString &sql, const QueryBuilder &query) const
 {
-    QString select;
-
     const auto &distinct = query.getDistinct();
 
-    if (std::holds_alternative<QStringList>(distinct))
-        select += QStringLiteral("select distinct on (%1) ")
-                  .arg(columnize(std::get<QStringList>(distinct)));
-
+    if (std::holds_alternative<QStringList>(distinct)) {
+        sql += QStringLiteral("select distinct on (");
+        columnizeTo(sql, std::get<QStringList>(distinct));
+        sql += QStringLiteral(") ");
+    }
     else if (std::holds_alternative<bool>(distinct) && std::get<bool>(distinct))
-        select += QStringLiteral("select distinct ");
+        sql += QStringLiteral("select distinct ");
 
     else
-        select += QStringLiteral("select ");
+        sql += QStringLiteral("select ");
 
-    return select += columnize(query.getColumns());
+    columnizeTo(sql, query.getColumns());
 }
 
-QString PostgresGrammar::whereDate(const WhereConditionItem &where) const
+void PostgresGrammar::whereDate(QString &sql, const WhereConditionItem &where) const
 {
-    return QStringLiteral("%1::date %3 %4").arg(wrap(where.column),
-                                                where.comparison,
-                                                parameter(where.value));
+    wrapTo(sql, where.column);
+    sql += QStringLiteral("::date ");
+    sql += where.comparison;
+    sql += SPACE;
+    parameterTo(sql, std::get<QVariant>(where.data));
 }
 
-QString PostgresGrammar::whereTime(const WhereConditionItem &where) const
+void PostgresGrammar::whereTime(QString &sql, const WhereConditionItem &where) const
 {
-    return QStringLiteral("%1::time %3 %4").arg(wrap(where.column),
-                                                where.comparison,
-                                                parameter(where.value));
+    wrapTo(sql, where.column);
+    sql += QStringLiteral("::time ");
+    sql += where.comparison;
+    sql += SPACE;
+    parameterTo(sql, std::get<QVariant>(where.data));
 }
 
-QString PostgresGrammar::dateBasedWhere(const QString &type,
-                                        const WhereConditionItem &where) const
+void PostgresGrammar::dateBasedWhere(QString &sql, const QString &type,
+                                     const WhereConditionItem &where) const
 {
-    return QStringLiteral("extract(%1 from %2) %3 %4").arg(type,
-                                                           wrap(where.column),
-                                                           where.comparison,
-                                                           parameter(where.value));
+    sql += QStringLiteral("extract(");
+    sql += type;
+    sql += QStringLiteral(" from ");
+    wrapTo(sql, where.column);
+    sql += QStringLiteral(") ");
+    sql += where.comparison;
+    sql += SPACE;
+    parameterTo(sql, std::get<QVariant>(where.data));
 }
 
 QString PostgresGrammar::compileUpdateColumns(const QVector<UpdateItem> &values) const
@@ -67,9 +67,10 @@ SQLiteGrammar::compileTruncate(const QueryBuilder &query) const
     };
 }
 
-QString SQLiteGrammar::compileLock(const QueryBuilder &/*unused*/) const
+void SQLiteGrammar::compileLock(QString &/*unused*/,
+                                const QueryBuilder &/*unused*/) const
 {
-    return EMPTY;
+    // SQLite doesn't support locking
 }
 
 const QVector<QString> &SQLiteGrammar::getOperators() const
@@ -96,9 +97,9 @@ SQLiteGrammar::getCompileMap() const
     {
         return [this,
                 compileMethod = std::forward<decltype (compileMethod)>(compileMethod)]
-               (const auto &query)
+               (QString &sql, const auto &query)
         {
-            return std::invoke(compileMethod, this, query);
+            std::invoke(compileMethod, this, sql, query);
         };
     };
 
@@ -134,7 +135,7 @@ SQLiteGrammar::getCompileMap() const
     return cached;
 }
 
-const std::function<QString(const WhereConditionItem &)> &
+const Grammar::WhereMethod &
 SQLiteGrammar::getWhereMethod(const WhereType whereType) const
 {
     /* Needed, because some compileXx() methods are overloaded, this way I will capture
@@ -145,16 +146,16 @@ SQLiteGrammar::getWhereMethod(const WhereType whereType) const
     {
         return [this,
                 compileMethod = std::forward<decltype (compileMethod)>(compileMethod)]
-               (const auto &query)
+               (QString &sql, const auto &query)
         {
-            return std::invoke(compileMethod, this, query);
+            std::invoke(compileMethod, this, sql, query);
         };
     };
 
     // Pointers to a where member methods by whereType, yes yes c++ 😂
     // An order has to be the same as in enum struct WhereType
     T_THREAD_LOCAL
-    static const QVector<std::function<QString(const WhereConditionItem &)>> cached {
+    static const QVector<WhereMethod> cached {
         bind(&SQLiteGrammar::whereBasic),
         bind(&SQLiteGrammar::whereNested),
         bind(&SQLiteGrammar::whereColumn),
@@ -185,58 +186,71 @@ SQLiteGrammar::getWhereMethod(const WhereType whereType) const
     return cached.at(type);
 }
 
-QString SQLiteGrammar::whereDate(const WhereConditionItem &where) const
+void SQLiteGrammar::whereDate(QString &sql, const WhereConditionItem &where) const
 {
-    return dateBasedWhere(QStringLiteral("%Y-%m-%d"), where);
+    dateBasedWhere(sql, QStringLiteral("%Y-%m-%d"), where);
 }
 
-QString SQLiteGrammar::whereTime(const WhereConditionItem &where) const
+void SQLiteGrammar::whereTime(QString &sql, const WhereConditionItem &where) const
 {
-    return dateBasedWhere(QStringLiteral("%H:%M:%S"), where);
+    dateBasedWhere(sql, QStringLiteral("%H:%M:%S"), where);
 }
 
-QString SQLiteGrammar::whereDay(const WhereConditionItem &where) const
+void SQLiteGrammar::whereDay(QString &sql, const WhereConditionItem &where) const
 {
-    return dateBasedWhere(QStringLiteral("%d"), where);
+    dateBasedWhere(sql, QStringLiteral("%d"), where);
 }
 
-QString SQLiteGrammar::whereMonth(const WhereConditionItem &where) const
+void SQLiteGrammar::whereMonth(QString &sql, const WhereConditionItem &where) const
 {
-    return dateBasedWhere(QStringLiteral("%m"), where);
+    dateBasedWhere(sql, QStringLiteral("%m"), where);
 }
 
-QString SQLiteGrammar::whereYear(const WhereConditionItem &where) const
+void SQLiteGrammar::whereYear(QString &sql, const WhereConditionItem &where) const
 {
-    return dateBasedWhere(QStringLiteral("%Y"), where);
+    dateBasedWhere(sql, QStringLiteral("%Y"), where);
 }
 
-QString SQLiteGrammar::dateBasedWhere(const QString &type,
-                                      const WhereConditionItem &where) const
+void SQLiteGrammar::dateBasedWhere(QString &sql, const QString &type,
+                                   const WhereConditionItem &where) const
 {
-    return QStringLiteral("%1 %2 %3")
-            .arg(dateBasedWhereColumn(type, where), where.comparison,
-                 parameter(where.value));
+    dateBasedWhereColumn(sql, type, where);
+    sql += SPACE;
+    sql += where.comparison;
+    sql += SPACE;
+    parameterTo(sql, std::get<QVariant>(where.data));
 }
 
-QString SQLiteGrammar::dateBasedWhereColumn(const QString &type,
-                                            const WhereConditionItem &where) const
+void SQLiteGrammar::dateBasedWhereColumn(QString &sql, const QString &type,
+                                         const WhereConditionItem &where) const
 {
     switch (where.type) {
     // Compare as text types
     case WhereType::DATE:
     case WhereType::TIME:
-        Q_ASSERT(Helpers::qVariantTypeId(where.value) == QMetaType::QString);
+        Q_ASSERT(Helpers::qVariantTypeId(std::get<QVariant>(where.data)) ==
+                 QMetaType::QString);
 
-        return QStringLiteral("strftime('%1', %2)").arg(type, wrap(where.column));
+        sql += QStringLiteral("strftime('");
+        sql += type;
+        sql += QStringLiteral("', ");
+        wrapTo(sql, where.column);
+        sql += QLatin1Char(')');
+        break;
 
     // Compare as integral types
     case WhereType::DAY:
     case WhereType::MONTH:
     case WhereType::YEAR:
-        Q_ASSERT(Helpers::qVariantTypeId(where.value) == QMetaType::Int);
-
-        return QStringLiteral("cast(strftime('%1', %2) as integer)")
-                .arg(type, wrap(where.column));
+        Q_ASSERT(Helpers::qVariantTypeId(std::get<QVariant>(where.data)) ==
+                 QMetaType::Int);
+
+        sql += QStringLiteral("cast(strftime('");
+        sql += type;
+        sql += QStringLiteral("', ");
+        wrapTo(sql, where.column);
+        sql += QStringLiteral(") as integer)");
+        break;
 
     default:
         Q_UNREACHABLE();
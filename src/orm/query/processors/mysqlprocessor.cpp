@@ -14,7 +14,8 @@ namespace Orm::Query::Processors
 QStringList MySqlProcessor::processColumnListing(SqlQuery &query) const
 {
     QStringList columns;
-    columns.reserve(QueryUtils::queryResultSize(query));
+    if (const auto sizeHint = QueryUtils::queryResultSizeHint(query); sizeHint > 0)
+        columns.reserve(sizeHint);
 
     while (query.next())
         columns << query.value("column_name").value<QString>();
@@ -13,7 +13,8 @@ namespace Orm::Query::Processors
 QStringList SQLiteProcessor::processColumnListing(SqlQuery &query) const
 {
     QStringList columns;
-    columns.reserve(QueryUtils::queryResultSize(query));
+    if (const auto sizeHint = QueryUtils::queryResultSizeHint(query); sizeHint > 0)
+        columns.reserve(sizeHint);
 
     while (query.next())
         columns << query.value(NAME).value<QString>();
@@ -33,6 +33,29 @@ SqlQuery Builder::get(const QVector<Column> &columns)
     });
 }
 
+Cursor<> Builder::cursor(const QVector<Column> &columns)
+{
+    // Save original columns
+    auto original = m_columns;
+
+    if (original.isEmpty())
+        m_columns = columns;
+
+    auto result = m_connection.cursor(toSql(), getBindings(), !m_useWriteConnection);
+
+    // After running the query, the columns are reset to the original value
+    m_columns = std::move(original);
+
+    return result;
+}
+
+QFuture<QVector<QSqlRecord>> Builder::getAsync(const QVector<Column> &columns)
+{
+    // The query is compiled in this thread, only the query runs in the worker thread
+    return m_connection.selectAsync(toSqlWithColumns(columns), getBindings(),
+                                    !m_useWriteConnection);
+}
+
 SqlQuery Builder::find(const QVariant &id, const QVector<Column> &columns)
 {
     return where(ID, EQ, id).first(columns);
@@ -77,12 +100,17 @@ QVariant Builder::value(const Column &column)
     else
         column_ = std::get<QString>(column);
 
-    const auto query = first({column});
+    auto query = first({column});
 
     if (m_connection.pretending())
         return {};
 
-    return query.value(column_);
+    auto value_ = query.value(column_);
+
+    // The result set is consumed, re-use the prepared query by the next query
+    query.releaseStatement();
+
+    return value_;
 }
 
 QVariant Builder::soleValue(const Column &column)
@@ -95,12 +123,17 @@ QVariant Builder::soleValue(const Column &column)
     else
         column_ = std::get<QString>(column);
 
-    const auto query = sole({column});
+    auto query = sole({column});
 
     if (m_connection.pretending())
         return {};
 
-    return query.value(column_);
+    auto value_ = query.value(column_);
+
+    // The result set is consumed, re-use the prepared query by the next query
+    query.releaseStatement();
+
+    return value_;
 }
 
 QVector<QVariant> Builder::pluck(const QString &column)
@@ -110,10 +143,10 @@ QVector<QVariant> Builder::pluck(const QString &column)
        and get the exact data that was requested for the query. */
     auto query = get({column});
 
-    const auto size = QueryUtils::queryResultSize(query);
+    const auto sizeHint = QueryUtils::queryResultSizeHint(query);
 
     // Empty result
-    if (size == 0)
+    if (sizeHint == 0)
         return {};
 
     /* If the column is qualified with a table or have an alias, we cannot use
@@ -122,11 +155,15 @@ QVector<QVariant> Builder::pluck(const QString &column)
     const auto unqualifiedColumn = stripTableForPluck(column);
 
     QVector<QVariant> result;
-    result.reserve(size);
+    if (sizeHint > 0)
+        result.reserve(sizeHint);
 
     while (query.next())
         result << query.value(unqualifiedColumn);
 
+    // The result set is consumed, re-use the prepared query by the next query
+    query.releaseStatement();
+
     return result;
 }
 
@@ -236,6 +273,37 @@ Builder::insertOrIgnore(const QVector<QString> &columns,
     return insertOrIgnore(QueryUtils::zipForInsert(columns, values));
 }
 
+quint64 Builder::bulkLoad(const QVector<QString> &columns,
+                          const BulkLoadRowSource &rowSource)
+{
+    if (!std::holds_alternative<QString>(m_from))
+        throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The bulk load needs the table name set by the from() "
+                               "or table() method in %1().")
+                .arg(__tiny_func__));
+
+    /* Rows are streamed directly to the connection, they are never collected
+       to the vector of maps like the insert() does. */
+    return m_connection.bulkLoad(std::get<QString>(m_from), columns, rowSource);
+}
+
+quint64 Builder::insertBatch(const QVector<QString> &columns,
+                             const QVector<QVariantList> &values,
+                             const std::size_t batchSize)
+{
+    throwIfBatchColumnsMismatch(columns, values);
+
+    if (!std::holds_alternative<QString>(m_from))
+        throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The batch insert needs the table name set by the "
+                               "from() or table() method in %1().")
+                .arg(__tiny_func__));
+
+    return m_connection.execBatch(
+                m_grammar.compileBulkInsert(std::get<QString>(m_from), columns, 1),
+                values, batchSize);
+}
+
 std::tuple<int, QSqlQuery>
 Builder::update(const QVector<UpdateItem> &values)
 {
@@ -245,6 +313,79 @@ Builder::update(const QVector<UpdateItem> &values)
                                                                  values)));
 }
 
+quint64 Builder::updateBatch(const QVector<QString> &columns,
+                             const QVector<QVariantList> &values,
+                             const QString &uniqueBy, const std::size_t batchSize)
+{
+    throwIfBatchColumnsMismatch(columns, values);
+
+    const auto uniqueByIndex = columns.indexOf(uniqueBy);
+
+    if (uniqueByIndex == -1)
+        throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The '%1' unique column must be one of the updated "
+                               "columns in %2().")
+                .arg(uniqueBy, __tiny_func__));
+
+    if (columns.size() < 2)
+        throw Exceptions::InvalidArgumentError(
+                QStringLiteral("There are no columns to update in %1().")
+                .arg(__tiny_func__));
+
+    // Values are bound by the execBatch(), so only placeholders are compiled
+    QVector<UpdateItem> updateItems;
+    updateItems.reserve(columns.size() - 1);
+
+    for (QVector<QString>::size_type index = 0; index < columns.size(); ++index)
+        if (index != uniqueByIndex)
+            updateItems.append({columns.at(index), QVariant()});
+
+    auto query = clone();
+    query.whereEq(uniqueBy, QVariant());
+
+    const auto &rawBindings = query.getRawBindings();
+
+    /* Join bindings, update values, from bindings, and where bindings go first,
+       the unique column's where binding is the last where binding. */
+    const auto uniqueByBinding = rawBindings.size(BindingType::JOIN) +
+                                 updateItems.size() +
+                                 rawBindings.size(BindingType::FROM) +
+                                 rawBindings.size(BindingType::WHERE) - 1;
+
+    const auto bindings = m_grammar.prepareBindingsForUpdate(rawBindings, updateItems);
+    const auto updateValuesBinding = rawBindings.size(BindingType::JOIN);
+
+    /* Map the bindings to the lists of values, other bindings are bound to every row.
+       Indexes are computed for the raw bindings, the expression bindings have no
+       placeholders so they are skipped the same way as the cleanBindings() does. */
+    QVector<QVariantList> batchValues;
+    batchValues.reserve(bindings.size());
+
+    for (QVector<QVariant>::size_type index = 0; index < bindings.size(); ++index) {
+        if (bindings.at(index).canConvert<Expression>())
+            continue;
+
+        if (index == uniqueByBinding) {
+            batchValues << values.at(uniqueByIndex);
+            continue;
+        }
+
+        const auto updateItemIndex = index - updateValuesBinding;
+
+        if (updateItemIndex < 0 || updateItemIndex >= updateItems.size()) {
+            batchValues << QVariantList {bindings.at(index)};
+            continue;
+        }
+
+        // The unique column's values were skipped in the update items
+        batchValues << values.at(updateItemIndex < uniqueByIndex ? updateItemIndex
+                                                                 : updateItemIndex + 1);
+    }
+
+    return m_connection.execBatch(m_grammar.compileUpdate(query, updateItems),
+                                  batchValues, batchSize);
+}
+
 namespace
 {
     /*! Merge attributes and values for the updateOrInsert() method. */
@@ -349,29 +490,47 @@ void Builder::truncate()
 QVariant Builder::aggregate(const QString &function,
                             const QVector<Column> &columns) const
 {
-    auto resultsQuery = cloneWithout({PropertyType::COLUMNS})
-                        .cloneWithoutBindings({BindingType::SELECT})
-                        .setAggregate(function, columns)
-                        .get(columns);
+    /* The same as cloneWithout({PropertyType::COLUMNS}) and
+       cloneWithoutBindings({BindingType::SELECT}) but the query is copied only once. */
+    auto query = clone();
+    query.m_columns = {};
+    query.m_bindings.clear(BindingType::SELECT);
+
+    auto resultsQuery = query.setAggregate(function, columns).get(columns);
 
     // Empty result
-    if (!resultsQuery.first())
+    if (!resultsQuery.first()) {
+        resultsQuery.releaseStatement();
         return {};
+    }
+
+    auto aggregate_ = resultsQuery.value(QStringLiteral("aggregate"));
+
+    // The result set is consumed, re-use the prepared query by the next query
+    resultsQuery.releaseStatement();
 
-    return resultsQuery.value(QStringLiteral("aggregate"));
+    return aggregate_;
 }
 
 bool Builder::exists()
 {
-    auto results = m_connection.select(m_grammar.compileExists(*this), getBindings());
+    auto results = m_connection.select(m_grammar.compileExists(*this), getBindings(),
+                                       !m_useWriteConnection);
 
     /* If the results have rows, we will get the row and see if the exists column is a
        boolean true. If there are no results for this query we will return false as
        there are no rows for this query at all, and we can return that info here. */
-    if (!results.first())
+    if (!results.first()) {
+        results.releaseStatement();
         return false;
+    }
+
+    const auto exists_ = results.value(QStringLiteral("exists")).value<bool>();
 
-    return results.value(QStringLiteral("exists")).template value<bool>();
+    // The result set is consumed, re-use the prepared query by the next query
+    results.releaseStatement();
+
+    return exists_;
 }
 
 bool Builder::existsOr(const std::function<void()> &callback)
@@ -602,7 +761,7 @@ Builder &Builder::whereColumn(const Column &first, const QString &comparison,
 #endif
 
     m_wheres.append({.column = first, .comparison = comparison, .condition = condition,
-                     .type = WhereType::COLUMN, .columnTwo = second});
+                     .type = WhereType::COLUMN, .data = WhereColumnTwoItem {second}});
 
     return *this;
 }
@@ -632,7 +791,7 @@ Builder &Builder::whereIn(const Column &column, const QVector<QVariant> &values,
     const auto type = nope ? WhereType::NOT_IN : WhereType::IN_;
 
     m_wheres.append({.column = column, .condition = condition, .type = type,
-                     .values = values});
+                     .data = values});
 
     /* Finally we'll add a binding for each values unless that value is an expression
        in which case we will just skip over it since it will be the query as a raw
@@ -658,6 +817,75 @@ Builder &Builder::orWhereNotIn(const Column &column, const QVector<QVariant> &va
     return whereNotIn(column, values, OR);
 }
 
+namespace
+{
+    /*! Convert values to the PostgreSQL array literal, eg. {"1","2"}. */
+    QString toArrayLiteral(const QVector<QVariant> &values)
+    {
+        QStringList elements;
+        elements.reserve(values.size());
+
+        for (const auto &value : values) {
+            if (value.isNull()) {
+                elements << QStringLiteral("NULL");
+                continue;
+            }
+
+            // Quote all elements, the quoted element is valid also for numeric arrays
+            auto element = value.value<QString>();
+            element.replace(QLatin1Char('\\'), QStringLiteral("\\\\"))
+                   .replace(QLatin1Char('"'), QStringLiteral("\\\""));
+
+            elements << QStringLiteral("\"%1\"").arg(element);
+        }
+
+        return QStringLiteral("{%1}").arg(elements.join(COMMA_C));
+    }
+} // namespace
+
+Builder &Builder::whereInArray(const Column &column, const QVector<QVariant> &values,
+                               const QString &condition)
+{
+    /* The array type of the placeholder is inferred by the database from the column
+       type, so the array literal is bound as the one string binding. */
+    return whereRaw(QStringLiteral("%1 = any(?)").arg(m_grammar.wrap(column)),
+                    {toArrayLiteral(values)}, condition);
+}
+
+Builder &Builder::replaceWhereInValues(
+        const QVector<QVariant>::size_type whereIndex,
+        const QVector<QVariant>::size_type bindingsOffset, QVector<QVariant> &&values)
+{
+    if (whereIndex < 0 || whereIndex >= m_wheres.size())
+        throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The where clause index '%1' is out of range in %2().")
+                .arg(whereIndex).arg(__tiny_func__));
+
+    auto &where = m_wheres[whereIndex]; // clazy:exclude=detaching-member
+
+    if (where.type != WhereType::IN_ && where.type != WhereType::NOT_IN)
+        throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The where clause at the index '%1' is not the \"where "
+                               "in\" clause in %2().")
+                .arg(whereIndex).arg(__tiny_func__));
+
+    // Expressions are not bound so only the remaining values have bindings
+    auto &whereValues = std::get<QVector<QVariant>>(where.data);
+
+    const auto oldBindingsSize = cleanBindings(whereValues).size();
+    const auto oldBindings = m_bindings.value(BindingType::WHERE);
+
+    auto bindings = oldBindings.mid(0, bindingsOffset);
+    bindings << cleanBindings(values)
+             << oldBindings.mid(bindingsOffset + oldBindingsSize);
+
+    setBindings(std::move(bindings), BindingType::WHERE);
+
+    whereValues = std::move(values);
+
+    return *this;
+}
+
 /* where null */
 
 Builder &Builder::whereNull(const QVector<Column> &columns, const QString &condition,
@@ -713,8 +941,7 @@ Builder &Builder::whereBetween(const Column &column, const WhereBetweenItem &val
                                const QString &condition, const bool nope)
 {
     m_wheres.append({.column = column, .condition = condition,
-                     .type = WhereType::BETWEEN, .nope = nope,
-                     .between = values});
+                     .type = WhereType::BETWEEN, .nope = nope, .data = values});
 
     addBinding(cleanBindings(values), BindingType::WHERE);
 
@@ -745,7 +972,7 @@ Builder &Builder::whereBetweenColumns(
 {
     m_wheres.append({.column = column, .condition = condition,
                      .type = WhereType::BETWEEN_COLUMNS, .nope = nope,
-                     .betweenColumns = betweenColumns});
+                     .data = betweenColumns});
 
     return *this;
 }
@@ -817,7 +1044,7 @@ Builder::whereRowValues(const QVector<Column> &columns, const QString &compariso
 
     m_wheres.append({.comparison = comparison, .condition = condition,
                      .type = WhereType::ROW_VALUES,
-                     .columns = columns, .values = values});
+                     .data = WhereRowValuesItem {columns, values}});
 
     addBinding(cleanBindings(values), BindingType::WHERE);
 
@@ -941,7 +1168,8 @@ Builder &Builder::whereYear(const Column &column, const QString &comparison,
 Builder &Builder::whereRaw(const QString &sql, const QVector<QVariant> &bindings,
                            const QString &condition)
 {
-    m_wheres.append({.condition = condition, .type = WhereType::RAW, .sql = sql});
+    m_wheres.append({.condition = condition, .type = WhereType::RAW,
+                     .data = WhereRawItem {sql}});
 
     addBinding(bindings, BindingType::WHERE);
 
@@ -1068,9 +1296,9 @@ Builder &Builder::oldest(const Column &column)
 
 Builder &Builder::reorder()
 {
-    m_orders.clear();
+    m_orders = {};
 
-    m_bindings[BindingType::ORDER].clear();
+    m_bindings.clear(BindingType::ORDER);
 
     return *this;
 }
@@ -1170,9 +1398,8 @@ Builder &Builder::lock(const bool value)
 {
     m_lock = value;
 
-    // FEATURE read/write connection silverqx
-//    if (! is_null($this->lock))
-//        useWritePdo();
+    // The locked rows must be selected from the write connection
+    useWriteConnection();
 
     return *this;
 }
@@ -1184,6 +1411,8 @@ Builder &Builder::lock(const char *value)
        https://stackoverflow.com/questions/14770252/string-literal-matches-bool-overload-instead-of-stdstring */
     m_lock = QString(value);
 
+    useWriteConnection();
+
     return *this;
 }
 
@@ -1191,6 +1420,8 @@ Builder &Builder::lock(const QString &value)
 {
     m_lock = value;
 
+    useWriteConnection();
+
     return *this;
 }
 
@@ -1198,6 +1429,8 @@ Builder &Builder::lock(QString &&value)
 {
     m_lock = std::move(value);
 
+    useWriteConnection();
+
     return *this;
 }
 
@@ -1241,13 +1474,8 @@ const QString &Builder::defaultKeyName() const noexcept // NOLINT(readability-co
 
 QVector<QVariant> Builder::getBindings() const
 {
-    QVector<QVariant> flattenBindings;
-
-    for (const auto &bindings : std::as_const(m_bindings))
-        for (const auto &binding : bindings)
-            flattenBindings << binding;
-
-    return flattenBindings;
+    // Already ordered by the binding type, nothing to flatten (implicitly shared)
+    return m_bindings.all();
 }
 
 Builder &Builder::addBinding(const QVariant &binding, const BindingType type)
@@ -1257,7 +1485,7 @@ Builder &Builder::addBinding(const QVariant &binding, const BindingType type)
     checkBindingType(type);
 #endif
 
-    m_bindings[type] << binding;
+    m_bindings.append(type, binding);
 
     return *this;
 }
@@ -1269,7 +1497,7 @@ Builder &Builder::addBinding(QVariant &&binding, const BindingType type)
     checkBindingType(type);
 #endif
 
-    m_bindings[type] << std::move(binding);
+    m_bindings.append(type, std::move(binding));
 
     return *this;
 }
@@ -1281,8 +1509,7 @@ Builder &Builder::addBinding(const QVector<QVariant> &bindings, const BindingTyp
     checkBindingType(type);
 #endif
 
-    if (!bindings.isEmpty())
-        std::ranges::copy(bindings, std::back_inserter(m_bindings[type]));
+    m_bindings.append(type, bindings);
 
     return *this;
 }
@@ -1294,8 +1521,7 @@ Builder &Builder::addBinding(QVector<QVariant> &&bindings, const BindingType typ
     checkBindingType(type);
 #endif
 
-    if (!bindings.isEmpty())
-        std::ranges::move(bindings, std::back_inserter(m_bindings[type]));
+    m_bindings.append(type, std::move(bindings));
 
     return *this;
 }
@@ -1307,10 +1533,7 @@ Builder &Builder::setBindings(QVector<QVariant> &&bindings, const BindingType ty
     checkBindingType(type);
 #endif
 
-    auto &bindingsRef = m_bindings[type]; // clazy:exclude=detaching-member
-
-    bindingsRef.reserve(bindings.size());
-    bindingsRef = std::move(bindings);
+    m_bindings.replace(type, std::move(bindings));
 
     return *this;
 }
@@ -1351,12 +1574,9 @@ Builder &Builder::addNestedWhereQuery(const std::shared_ptr<Builder> &query,
         return *this;
 
     m_wheres.append({.column = {}, .condition = condition, .type = WhereType::NESTED,
-                     .nestedQuery = query});
+                     .data = query});
 
-    const auto &whereBindings =
-            query->getRawBindings().find(BindingType::WHERE).value();
-
-    addBinding(whereBindings, BindingType::WHERE);
+    addBinding(query->getRawBindings().value(BindingType::WHERE), BindingType::WHERE);
 
     return *this;
 }
@@ -1366,7 +1586,7 @@ Builder &Builder::addWhereExistsQuery(const std::shared_ptr<Builder> &query,
 {
     const auto type = nope ? WhereType::NOT_EXISTS : WhereType::EXISTS;
 
-    m_wheres.append({.condition = condition, .type = type, .nestedQuery = query});
+    m_wheres.append({.condition = condition, .type = type, .data = query});
 
     addBinding(query->getBindings(), BindingType::WHERE);
 
@@ -1378,7 +1598,7 @@ Builder &Builder::mergeWheres(const QVector<WhereConditionItem> &wheres,
 {
     m_wheres += wheres;
 
-    m_bindings[BindingType::WHERE] += bindings;
+    m_bindings.append(BindingType::WHERE, bindings);
 
     return *this;
 }
@@ -1388,7 +1608,7 @@ Builder &Builder::mergeWheres(QVector<WhereConditionItem> &&wheres,
 {
     std::ranges::move(wheres, std::back_inserter(m_wheres));
 
-    std::ranges::move(bindings, std::back_inserter(m_bindings[BindingType::WHERE]));
+    m_bindings.append(BindingType::WHERE, std::move(bindings));
 
     return *this;
 }
@@ -1400,7 +1620,8 @@ Builder Builder::cloneWithout(const std::unordered_set<PropertyType> &properties
     for (const auto property : properties)
         switch (property) {
         case PropertyType::COLUMNS:
-            copy.m_columns.clear();
+            // Don't use the clear(), it would detach the shared columns
+            copy.m_columns = {};
             break;
 
         default:
@@ -1418,7 +1639,7 @@ Builder Builder::cloneWithoutBindings(
     for (const auto bindingType : except)
         switch (bindingType) {
         case BindingType::SELECT:
-            copy.m_bindings[BindingType::SELECT].clear();
+            copy.m_bindings.clear(BindingType::SELECT);
             break;
 
         default:
@@ -1445,6 +1666,19 @@ void Builder::throwIfInvalidOperator(const QString &comparison) const
                 .arg(comparison_, getConnection().driverNamePrintable(), __tiny_func__));
 }
 
+void Builder::throwIfBatchColumnsMismatch(const QVector<QString> &columns,
+                                          const QVector<QVariantList> &values)
+{
+    if (!columns.isEmpty() && columns.size() == values.size())
+        return;
+
+    throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The number of columns (%1) and lists of values (%2) "
+                               "for the batch execution must be the same and can't "
+                               "be zero in %3().")
+                .arg(columns.size()).arg(values.size()).arg(__tiny_func__));
+}
+
 QVector<QVariant> Builder::cleanBindings(const QVector<QVariant> &bindings)
 {
     QVector<QVariant> cleanedBindings;
@@ -1533,9 +1767,9 @@ Builder::newJoinClause(const Builder &query, const QString &type, Expression &&t
 
 Builder &Builder::clearColumns()
 {
-    m_columns.clear();
+    m_columns = {};
 
-    m_bindings[BindingType::SELECT].clear();
+    m_bindings.clear(BindingType::SELECT);
 
     return *this;
 }
@@ -1544,7 +1778,7 @@ SqlQuery
 Builder::onceWithColumns(const QVector<Column> &columns,
                          const std::function<SqlQuery()> &callback)
 {
-    // Save orignal columns
+    // Save original columns
     auto original = m_columns;
 
     if (original.isEmpty())
@@ -1558,6 +1792,22 @@ Builder::onceWithColumns(const QVector<Column> &columns,
     return result;
 }
 
+QString Builder::toSqlWithColumns(const QVector<Column> &columns)
+{
+    // Save original columns
+    auto original = m_columns;
+
+    if (original.isEmpty())
+        m_columns = columns;
+
+    auto queryString = toSql();
+
+    // After compiling the query, the columns are reset to the original value
+    m_columns = std::move(original);
+
+    return queryString;
+}
+
 std::pair<QString, QVector<QVariant>>
 Builder::createSub(const std::function<void(Builder &)> &callback) const
 {
@@ -1616,14 +1866,20 @@ void Builder::enforceOrderBy() const
 
 QVector<OrderByItem> Builder::removeExistingOrdersFor(const QString &column) const
 {
-    return m_orders
-            | ranges::views::remove_if([&column](const OrderByItem &order)
+    const auto isOrderFor = [&column](const OrderByItem &order)
     {
         if (std::holds_alternative<Expression>(order.column))
             return false;
 
         return std::get<QString>(order.column) == column;
-    })
+    };
+
+    // Nothing to remove, return the implicitly shared orders (no copy)
+    if (std::ranges::none_of(m_orders, isOrderFor))
+        return m_orders;
+
+    return m_orders
+            | ranges::views::remove_if(isOrderFor)
             | ranges::to<QVector<OrderByItem>>();
 }
 
@@ -1650,9 +1906,10 @@ Builder &Builder::setAggregate(const QString &function, const QVector<Column> &c
 #endif
 
     if (m_groups.isEmpty()) {
-        m_orders.clear();
+        // Don't use the clear(), it would detach the orders shared with the cloned query
+        m_orders = {};
 
-        m_bindings[BindingType::ORDER].clear();
+        m_bindings.clear(BindingType::ORDER);
     }
 
     return *this;
@@ -1662,7 +1919,7 @@ Builder &Builder::setAggregate(const QString &function, const QVector<Column> &c
 
 SqlQuery Builder::runSelect()
 {
-    return m_connection.select(toSql(), getBindings());
+    return m_connection.select(toSql(), getBindings(), !m_useWriteConnection);
 }
 
 Builder &Builder::joinInternal(
@@ -1736,8 +1993,8 @@ Builder &Builder::whereInternal(
     throwIfInvalidOperator(comparison);
 #endif
 
-    m_wheres.append({.column = column, .value = value, .comparison = comparison,
-                     .condition = condition, .type = type});
+    m_wheres.append({.column = column, .comparison = comparison,
+                     .condition = condition, .type = type, .data = value});
 
     if (!value.canConvert<Expression>())
         addBinding(std::move(value), BindingType::WHERE);
@@ -1747,7 +2004,7 @@ Builder &Builder::whereInternal(
 
 void Builder::checkBindingType(const BindingType type) const
 {
-    if (m_bindings.contains(type))
+    if (Bindings::isValidType(type))
         return;
 
     // TODO add hash which maps BindingType to the QString silverqx
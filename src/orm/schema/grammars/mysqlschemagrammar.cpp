@@ -426,13 +426,9 @@ MySqlSchemaGrammar::compileKey(const Blueprint &blueprint, const IndexCommand &c
 }
 
 // Duplicate in the MysqlGrammar is OK
-QString MySqlSchemaGrammar::wrapValue(QString value) const
+void MySqlSchemaGrammar::wrapValueTo(QString &sql, const QStringView value) const
 {
-    if (value == ASTERISK_C)
-        return value;
-
-    return QStringLiteral("`%1`").arg(value.replace(QStringLiteral("`"),
-                                                    QStringLiteral("``")));
+    wrapValueWith(sql, value, QLatin1Char('`'));
 }
 
 QString MySqlSchemaGrammar::escapeString(QString value) const
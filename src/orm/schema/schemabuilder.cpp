@@ -7,12 +7,9 @@
 
 #include "orm/databaseconnection.hpp"
 #include "orm/exceptions/logicerror.hpp"
-#include "orm/utils/query.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
-using QueryUtils = Orm::Utils::Query;
-
 namespace Orm::SchemaNs
 {
 
@@ -168,7 +165,8 @@ bool SchemaBuilder::hasTable(const QString &table) const
     auto query = m_connection.selectFromWriteConnection(
                      m_grammar.compileTableExists(), {table_});
 
-    return QueryUtils::queryResultSize(query) > 0;
+    // Don't count rows, it's enough to know whether the first row exists
+    return query.first();
 }
 
 // TEST schema, test in functional tests silverqx
@@ -0,0 +1,167 @@
+#include "orm/support/asyncqueryworker.hpp"
+
+#include <QtSql/QSqlDatabase>
+
+#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
+#  include <QException>
+#endif
+
+#include "orm/databaseconnection.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Support
+{
+
+/* public */
+
+AsyncQueryWorker::AsyncQueryWorker(QString qtConnectionName, FactoryType factory)
+    : m_qtConnectionName(std::move(qtConnectionName))
+    , m_factory(std::move(factory))
+    , m_thread(&AsyncQueryWorker::run, this)
+{}
+
+AsyncQueryWorker::~AsyncQueryWorker()
+{
+    {
+        const QMutexLocker locker(&m_mutex);
+
+        m_stop = true;
+    }
+
+    m_ready.wakeOne();
+
+    // Remaining tasks are finished before the worker thread finishes
+    m_thread.join();
+}
+
+void AsyncQueryWorker::enqueue(TaskType &&task)
+{
+    {
+        const QMutexLocker locker(&m_mutex);
+
+        m_queue.push_back(std::move(task));
+    }
+
+    m_ready.wakeOne();
+}
+
+std::size_t AsyncQueryWorker::pending() const
+{
+    const QMutexLocker locker(&m_mutex);
+
+    return m_queue.size() + (m_running ? 1 : 0);
+}
+
+void AsyncQueryWorker::waitForDone()
+{
+    QMutexLocker locker(&m_mutex);
+
+    while (!m_queue.empty() || m_running)
+        m_drained.wait(&m_mutex);
+}
+
+DatabaseConnection &AsyncQueryWorker::connection()
+{
+    Q_ASSERT(std::this_thread::get_id() == m_thread.get_id());
+
+    if (m_connection)
+        return *m_connection;
+
+    m_connection = std::invoke(m_factory, m_qtConnectionName);
+
+    /* The reconnector must reconnect the worker's connection, the DatabaseManager's
+       reconnector would reconnect the thread-local connection. */
+    m_connection->setReconnector([this](const DatabaseConnection &/*unused*/)
+    {
+        reconnect();
+    });
+
+    return *m_connection;
+}
+
+void AsyncQueryWorker::reportException(QFutureInterfaceBase &future)
+{
+    // Qt5 can only propagate the QException, the original exception is lost
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+    future.reportException(std::current_exception());
+#else
+    future.reportException(QUnhandledException());
+#endif
+}
+
+/* private */
+
+void AsyncQueryWorker::run()
+{
+    while (true) {
+        TaskType task;
+
+        {
+            QMutexLocker locker(&m_mutex);
+
+            while (m_queue.empty() && !m_stop)
+                m_ready.wait(&m_mutex);
+
+            // Stop requested and all tasks were finished
+            if (m_queue.empty())
+                break;
+
+            task = std::move(m_queue.front());
+            m_queue.pop_front();
+
+            m_running = true;
+        }
+
+        try {
+            std::invoke(task, *this);
+        } catch (...) {
+            /* Nothing to do, tasks report exceptions to their futures, this only
+               guarantees that nothing can escape the worker thread. */
+        }
+
+        {
+            const QMutexLocker locker(&m_mutex);
+
+            m_running = false;
+
+            if (m_queue.empty())
+                m_drained.wakeAll();
+        }
+    }
+
+    destroyConnection();
+}
+
+void AsyncQueryWorker::reconnect()
+{
+    m_connection->disconnect();
+
+    /* Make a new connection and copy the connection resolver from this new
+       connection to the worker's connection, this ensures that the connection
+       will be again resolved/connected lazily. */
+    m_connection->setQtConnectionResolver(
+                std::invoke(m_factory, m_qtConnectionName)->getQtConnectionResolver());
+}
+
+void AsyncQueryWorker::destroyConnection()
+{
+    // Nothing to do, no task was executed
+    if (!m_connection)
+        return;
+
+    auto qtConnectionNames = m_connection->getReadQtConnectionNames();
+    qtConnectionNames.prepend(m_qtConnectionName);
+
+    // Destroy cached prepared statements first
+    m_connection.reset();
+
+    // ~QSqlDatabase() internally also calls close()
+    for (const auto &qtConnectionName : std::as_const(qtConnectionNames))
+        if (QSqlDatabase::contains(qtConnectionName))
+            QSqlDatabase::removeDatabase(qtConnectionName);
+}
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
@@ -0,0 +1,631 @@
+#include "orm/support/connectionpool.hpp"
+
+#include <QDeadlineTimer>
+#include <QtSql/QSqlDatabase>
+
+#include <atomic>
+#include <unordered_map>
+
+#include "orm/databaseconnection.hpp"
+#include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/exceptions/logicerror.hpp"
+#include "orm/exceptions/runtimeerror.hpp"
+#include "orm/macros/threadlocal.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Support
+{
+
+namespace
+{
+    /*! Last used thread ID. */
+    std::atomic<quint64> lastThreadId = 0; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+    /*! Unique ID of the current thread, the QThread address can be reused by a new
+        thread after the thread finishes. It's trivially destructible so it can be
+        used also while the ThreadCheckouts below is being destroyed. */
+    T_THREAD_LOCAL
+    const quint64 currentThreadId_ = ++lastThreadId;
+
+    /*! Connection that must be closed in the thread that opened it. */
+    struct RetiredConnection
+    {
+        /*! The connection instance. */
+        std::unique_ptr<DatabaseConnection> connection;
+        /*! Qt connection names of the write and read connections. */
+        QStringList qtConnectionNames;
+        /*! Called after the connection is closed (the pool stops counting it). */
+        std::function<void()> closed {};
+    };
+
+    /*! Connections waiting to be closed by the threads that opened them. */
+    struct RetiredConnections
+    {
+        /*! Protects the retired connections. */
+        QMutex mutex {};
+        /*! Retired connections for every running thread (keyed by the thread ID). */
+        std::unordered_map<quint64, std::vector<RetiredConnection>> connections {};
+        /*! Number of retired connections (to avoid locking if there is nothing
+            to close). */
+        std::atomic<std::size_t> size = 0;
+    };
+
+    /*! Get the connections waiting to be closed by the threads that opened them. */
+    RetiredConnections &retiredConnections()
+    {
+        static RetiredConnections cached;
+
+        return cached;
+    }
+
+    /*! Close the retired connection in the current thread. */
+    void closeConnection(RetiredConnection &&retired)
+    {
+        // Destroy cached prepared statements first
+        retired.connection.reset();
+
+        // ~QSqlDatabase() internally also calls close()
+        for (const auto &qtConnectionName : std::as_const(retired.qtConnectionNames))
+            if (QSqlDatabase::contains(qtConnectionName))
+                QSqlDatabase::removeDatabase(qtConnectionName);
+
+        if (retired.closed)
+            std::invoke(retired.closed);
+    }
+
+    /*! Close connections retired by other threads that were opened by the given
+        thread, the finished thread also stops accepting retired connections. */
+    void closeRetiredConnections(const quint64 threadId, const bool finished = false)
+    {
+        auto &retired = retiredConnections();
+
+        // Nothing to close
+        if (!finished && retired.size.load(std::memory_order_acquire) == 0)
+            return;
+
+        std::vector<RetiredConnection> connections;
+
+        {
+            const QMutexLocker locker(&retired.mutex);
+
+            const auto itConnections = retired.connections.find(threadId);
+
+            if (itConnections == retired.connections.end())
+                return;
+
+            connections = std::exchange(itConnections->second, {});
+            retired.size -= connections.size();
+
+            if (finished)
+                retired.connections.erase(itConnections);
+        }
+
+        for (auto &connection : connections)
+            closeConnection(std::move(connection));
+    }
+
+    /*! Connections checked out by the current thread. */
+    struct ThreadCheckouts
+    {
+        Q_DISABLE_COPY(ThreadCheckouts)
+
+        /*! Connections checked out from one pool. */
+        struct PoolCheckouts
+        {
+            /*! The pool is kept alive until all its connections are returned. */
+            std::shared_ptr<ConnectionPool> pool;
+            /*! Stack of checked out connections, the last one is active. */
+            std::vector<DatabaseConnection *> connections;
+        };
+
+        /*! Default constructor, the current thread starts accepting its retired
+            connections. */
+        ThreadCheckouts()
+        {
+            auto &retired = retiredConnections();
+
+            const QMutexLocker locker(&retired.mutex);
+
+            retired.connections.try_emplace(threadId);
+        }
+
+        /*! Destructor, closes connections retired by other threads when the thread
+            finishes, it must not use the threadCheckouts() (it's being destroyed). */
+        ~ThreadCheckouts()
+        {
+            /* Release pools of the connections that were never returned, the pool
+               destructor uses the currentThreadId_ only. */
+            connections.clear();
+
+            /* Nobody else can close connections opened by the current thread after
+               the thread finishes. */
+            closeRetiredConnections(threadId, true);
+        }
+
+        /*! Unique ID of the current thread. */
+        quint64 threadId = currentThreadId_;
+        /*! Checked out connections for every pool (the key is never dangling,
+            the pool is kept alive by the value). */
+        std::unordered_map<const ConnectionPool *, PoolCheckouts> connections;
+    };
+
+    /*! Connections checked out by the current thread, the current thread is
+        registered to accept its retired connections on the first access. */
+    T_THREAD_LOCAL
+    ThreadCheckouts threadCheckouts_; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+    /*! Get the connections checked out by the current thread. */
+    ThreadCheckouts &threadCheckouts() noexcept
+    {
+        return threadCheckouts_;
+    }
+
+    /*! Close the given connection in the thread that opened it, right away if it's
+        the current thread or if this thread already finished, returns true if
+        the connection was queued to be closed by the thread that opened it. */
+    bool retireConnection(std::unique_ptr<DatabaseConnection> &&connection,
+                          const QString &qtConnectionName, const quint64 threadId,
+                          std::function<void()> &&closed)
+    {
+        RetiredConnection retired {std::move(connection), {qtConnectionName}};
+        retired.qtConnectionNames << retired.connection->getReadQtConnectionNames();
+
+        if (threadId != currentThreadId_) {
+            auto &retiredConnections_ = retiredConnections();
+
+            const QMutexLocker locker(&retiredConnections_.mutex);
+
+            if (const auto itConnections = retiredConnections_.connections.find(threadId);
+                itConnections != retiredConnections_.connections.end()
+            ) {
+                retired.closed = std::move(closed);
+
+                itConnections->second.push_back(std::move(retired));
+                ++retiredConnections_.size;
+
+                return true;
+            }
+        }
+
+        closeConnection(std::move(retired));
+
+        return false;
+    }
+} // namespace
+
+/* public */
+
+ConnectionPool::ConnectionPool(QString name, const ConnectionPoolConfig &config,
+                               FactoryType &&factory)
+    : m_name(std::move(name))
+    , m_config(config)
+    , m_factory(std::move(factory))
+{
+    m_items.reserve(m_config.maxSize);
+}
+
+ConnectionPool::~ConnectionPool()
+{
+    const QMutexLocker locker(&m_mutex);
+
+    // Checked out connections keep the pool alive
+    Q_ASSERT(m_inUse == 0);
+
+    while (!m_items.empty())
+        destroyItem(m_items.cend() - 1);
+}
+
+void ConnectionPool::openMinConnections()
+{
+    const auto threadId = threadCheckouts().threadId;
+
+    const QMutexLocker locker(&m_mutex);
+
+    while (m_items.size() < m_config.minSize) {
+        auto &item = createItem();
+
+        item.threadId = threadId;
+        item.idleTimer.start();
+
+        // Connect eagerly, the QSqlDatabase connection is opened by the resolver
+        item.connection->getQtConnection();
+    }
+}
+
+DatabaseConnection &ConnectionPool::checkout()
+{
+    const auto threadId = threadCheckouts().threadId;
+
+    // Close connections that were replaced by other threads
+    closeRetiredConnections(threadId);
+
+    QElapsedTimer waitTimer;
+    waitTimer.start();
+
+    while (true) {
+        QMutexLocker locker(&m_mutex);
+
+        removeExpiredItems();
+
+        auto *item = acquireItem(threadId);
+
+        // The pool is saturated, wait until some connection is returned
+        if (item == nullptr)
+            ++m_stats.waits;
+
+        while (item == nullptr) {
+            const auto remaining = m_config.waitTimeout.count() - waitTimer.elapsed();
+
+            const auto signaled = remaining > 0 &&
+                                  m_available.wait(&m_mutex, QDeadlineTimer(remaining));
+
+            // Check also after the timeout, the connection could be returned just now
+            if (item = acquireItem(threadId); item == nullptr && !signaled) {
+                ++m_stats.timeouts;
+                throwWaitTimeout();
+            }
+        }
+
+        item->inUse = true;
+        item->threadId = threadId;
+        ++m_inUse;
+
+        auto *const connection = item->connection.get();
+
+        locker.unlock();
+
+        /* Validate only already opened connections, a new connection will be
+           connected lazily. A validated connection is used by the current thread
+           only so it doesn't need to be locked. */
+        auto valid = true;
+        if (m_config.validate && connection->isOpen())
+            try {
+                valid = validateConnection(*connection);
+
+            } catch (...) {
+                // Return the connection back, eg. the ping isn't supported
+                locker.relock();
+
+                item->inUse = false;
+                --m_inUse;
+                m_available.wakeOne();
+
+                throw;
+            }
+
+        if (!valid) {
+            locker.relock();
+
+            ++m_stats.validationFailures;
+            --m_inUse;
+            destroyItem(findItem(*connection));
+
+            m_available.wakeOne();
+
+            continue;
+        }
+
+        locker.relock();
+
+        const auto waitTime = waitTimer.elapsed();
+
+        ++m_stats.checkouts;
+        m_stats.totalWaitTime += waitTime;
+        m_stats.maxWaitTime = std::max(m_stats.maxWaitTime, waitTime);
+        m_stats.peakInUse = std::max(m_stats.peakInUse, m_inUse);
+
+        locker.unlock();
+
+        auto &checkouts = threadCheckouts().connections[this];
+
+        if (!checkouts.pool)
+            checkouts.pool = shared_from_this();
+
+        checkouts.connections.push_back(connection);
+
+        return *connection;
+    }
+}
+
+void ConnectionPool::checkin(DatabaseConnection &connection)
+{
+    // The thread checkouts can hold the last reference to this pool
+    std::shared_ptr<ConnectionPool> pool;
+
+    // Remove from the stack of the connections checked out by the current thread
+    auto &checkouts = threadCheckouts().connections;
+    if (const auto itCheckouts = checkouts.find(this);
+        itCheckouts != checkouts.end()
+    ) {
+        auto &stack = itCheckouts->second.connections;
+
+        if (const auto itConnection = std::ranges::find(stack, &connection);
+            itConnection != stack.end()
+        )
+            stack.erase(itConnection);
+
+        if (stack.empty()) {
+            pool = std::move(itCheckouts->second.pool);
+            checkouts.erase(itCheckouts);
+        }
+    }
+
+    // Close connections that were replaced by other threads
+    closeRetiredConnections(currentThreadId_);
+
+    /* The next borrower must obtain a connection without an active transaction,
+       if the rollback fails the connection is closed. */
+    auto healthy = true;
+    if (connection.inTransaction())
+        try {
+            connection.rollBack();
+        } catch (const std::exception &) {
+            healthy = false;
+        }
+
+    const QMutexLocker locker(&m_mutex);
+
+    const auto itItem = findItem(connection);
+
+    if (itItem == m_items.end() || !(*itItem)->inUse)
+        throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The connection was not checked out from the '%1' "
+                               "connection pool in %2().")
+                .arg(m_name, __tiny_func__));
+
+    --m_inUse;
+
+    if (healthy) {
+        (*itItem)->inUse = false;
+        (*itItem)->idleTimer.start();
+    }
+    else
+        destroyItem(itItem);
+
+    removeExpiredItems();
+
+    m_available.wakeOne();
+}
+
+DatabaseConnection *ConnectionPool::current() const
+{
+    const auto &checkouts = threadCheckouts().connections;
+
+    const auto itCheckouts = checkouts.find(this);
+
+    if (itCheckouts == checkouts.cend() || itCheckouts->second.connections.empty())
+        return nullptr;
+
+    return itCheckouts->second.connections.back();
+}
+
+DatabaseConnection &ConnectionPool::currentOrFail() const
+{
+    if (auto *const connection = current(); connection != nullptr)
+        return *connection;
+
+    throw Exceptions::LogicError(
+                QStringLiteral("The current thread doesn't hold any connection from "
+                               "the '%1' connection pool, the pooled connection must "
+                               "be borrowed for the current task using "
+                               "the DB::checkout() first, in %2().")
+                .arg(m_name, __tiny_func__));
+}
+
+std::size_t ConnectionPool::removeExpiredConnections()
+{
+    const QMutexLocker locker(&m_mutex);
+
+    return removeExpiredItems();
+}
+
+ConnectionPoolStats ConnectionPool::stats() const
+{
+    const QMutexLocker locker(&m_mutex);
+
+    auto stats = m_stats;
+
+    stats.maxSize = m_config.maxSize;
+    stats.size    = m_items.size();
+    stats.inUse   = m_inUse;
+    stats.idle    = stats.size - m_inUse;
+    stats.retired = m_retired;
+
+    return stats;
+}
+
+void ConnectionPool::resetStats()
+{
+    const QMutexLocker locker(&m_mutex);
+
+    m_stats = {};
+    m_stats.peakInUse = m_inUse;
+}
+
+/* private */
+
+ConnectionPool::PoolItem *ConnectionPool::acquireItem(const quint64 threadId)
+{
+    PoolItem *foreignItem = nullptr;
+
+    // Prefer the most recently returned connection opened by the same thread
+    PoolItem *sameThreadItem = nullptr;
+    for (const auto &item : m_items) {
+        if (item->inUse)
+            continue;
+
+        if (item->threadId == threadId) {
+            if (sameThreadItem == nullptr ||
+                item->idleTimer.elapsed() < sameThreadItem->idleTimer.elapsed()
+            )
+                sameThreadItem = item.get();
+        }
+        else if (foreignItem == nullptr)
+            foreignItem = item.get();
+    }
+
+    if (sameThreadItem != nullptr)
+        return sameThreadItem;
+
+    // Retired connections are still opened so they count against the limit
+    if (m_items.size() + m_retired < m_config.maxSize)
+        return &createItem();
+
+    /* The pool is full, retire an idle connection that was opened in another
+       thread, the QSqlDatabase can't be used nor closed from another thread so it's
+       closed by the thread that opened it. A new connection is created after it's
+       closed (right away if that thread already finished), retire only one
+       connection at once so waiting threads don't close all idle connections. */
+    if (foreignItem == nullptr || m_retired > 0)
+        return nullptr;
+
+    destroyItem(findItem(*foreignItem->connection));
+
+    if (m_items.size() + m_retired < m_config.maxSize)
+        return &createItem();
+
+    return nullptr;
+}
+
+ConnectionPool::PoolItem &ConnectionPool::createItem()
+{
+    auto item = std::make_unique<PoolItem>();
+
+    makeConnection(*item);
+
+    ++m_stats.created;
+
+    return *m_items.emplace_back(std::move(item));
+}
+
+void ConnectionPool::makeConnection(PoolItem &item)
+{
+    item.qtConnectionName = QStringLiteral("%1-pool-%2").arg(m_name).arg(++m_lastId);
+    item.connection = std::invoke(m_factory, item.qtConnectionName);
+
+    /* The reconnector must reconnect this pooled connection, the DatabaseManager's
+       reconnector would reconnect the thread-local connection. */
+    item.connection->setReconnector(
+                [pool = weak_from_this()](const DatabaseConnection &connection)
+    {
+        if (const auto pool_ = pool.lock(); pool_)
+            pool_->reconnect(connection);
+    });
+}
+
+void ConnectionPool::destroyItem(const PoolItemsType::const_iterator itItem)
+{
+    auto &item = **itItem;
+
+    if (retireConnection(std::move(item.connection), item.qtConnectionName,
+                         item.threadId,
+                         [pool = weak_from_this()]
+    {
+        if (const auto pool_ = pool.lock(); pool_)
+            pool_->retiredConnectionClosed();
+    }))
+        ++m_retired;
+
+    m_items.erase(itItem);
+
+    ++m_stats.destroyed;
+}
+
+void ConnectionPool::retiredConnectionClosed()
+{
+    const QMutexLocker locker(&m_mutex);
+
+    --m_retired;
+
+    m_available.wakeOne();
+}
+
+ConnectionPool::PoolItemsType::iterator
+ConnectionPool::findItem(const DatabaseConnection &connection)
+{
+    return std::ranges::find_if(m_items, [&connection](const auto &item)
+    {
+        return item->connection.get() == &connection;
+    });
+}
+
+std::size_t ConnectionPool::removeExpiredItems()
+{
+    // Nothing to do, idle connections never expire
+    if (m_config.idleTimeout.count() <= 0)
+        return 0;
+
+    std::size_t removed = 0;
+
+    for (auto itItem = m_items.begin();
+         itItem != m_items.end() && m_items.size() > m_config.minSize;
+    ) {
+        const auto &item = **itItem;
+
+        if (item.inUse || item.idleTimer.elapsed() < m_config.idleTimeout.count()) {
+            ++itItem;
+            continue;
+        }
+
+        const auto index = std::distance(m_items.begin(), itItem);
+        destroyItem(itItem);
+        itItem = m_items.begin() + index;
+
+        ++removed;
+    }
+
+    return removed;
+}
+
+bool ConnectionPool::validateConnection(DatabaseConnection &connection) const // NOLINT(readability-convert-member-functions-to-static)
+{
+    /* The pingDatabase() closes the connection if the ping fails, it throws if
+       the driver doesn't support the ping command. */
+    return connection.pingDatabase();
+}
+
+void ConnectionPool::reconnect(const DatabaseConnection &connection)
+{
+    DatabaseConnection *connection_ = nullptr;
+    QString qtConnectionName;
+
+    {
+        const QMutexLocker locker(&m_mutex);
+
+        const auto itItem = findItem(connection);
+        Q_ASSERT(itItem != m_items.end());
+
+        connection_ = (*itItem)->connection.get();
+        qtConnectionName = (*itItem)->qtConnectionName;
+    }
+
+    connection_->disconnect();
+
+    refreshQtConnection(*connection_, qtConnectionName);
+}
+
+void ConnectionPool::refreshQtConnection(DatabaseConnection &connection,
+                                         const QString &qtConnectionName) const
+{
+    /* Make a new connection and copy the connection resolver from this new
+       connection to the pooled connection, this ensures that the connection
+       will be again resolved/connected lazily. */
+    connection.setQtConnectionResolver(
+                std::invoke(m_factory, qtConnectionName)->getQtConnectionResolver());
+}
+
+void ConnectionPool::throwWaitTimeout() const
+{
+    throw Exceptions::RuntimeError(
+                QStringLiteral("Timed out after %1ms waiting for a connection from "
+                               "the '%2' connection pool, all %3 connections are "
+                               "in use or wait to be closed by the threads that "
+                               "opened them, in %4().")
+                .arg(m_config.waitTimeout.count()).arg(m_name)
+                .arg(m_config.maxSize).arg(__tiny_func__));
+}
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
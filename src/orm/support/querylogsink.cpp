@@ -0,0 +1,200 @@
+#include "orm/support/querylogsink.hpp"
+
+#include <QDeadlineTimer>
+#include <QFile>
+
+#include <algorithm>
+
+#include "orm/exceptions/runtimeerror.hpp"
+#include "orm/utils/query.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+using QueryUtils = Orm::Utils::Query;
+
+namespace Orm::Support
+{
+
+namespace
+{
+    /*! Create the callback that appends formatted records to the given file. */
+    QueryLogSink::CallbackType fileCallback(const QString &filepath)
+    {
+        auto file = std::make_shared<QFile>(filepath);
+
+        if (!file->open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text))
+            throw Exceptions::RuntimeError(
+                    QStringLiteral("Can't open the query log file '%1', %2 in %3().")
+                    .arg(filepath, file->errorString(), __tiny_func__));
+
+        return [file = std::move(file)](const QVector<QueryLogSink::Record> &records)
+        {
+            QByteArray batch;
+
+            for (const auto &record : records)
+                batch.append(QueryLogSink::format(record).toUtf8()).append('\n');
+
+            file->write(batch);
+            file->flush();
+        };
+    }
+} // namespace
+
+/* public */
+
+QueryLogSink::QueryLogSink(
+        const QString &filepath, const std::size_t batchSize,
+        const std::size_t maxQueueSize, const std::chrono::milliseconds flushInterval
+)
+    : QueryLogSink(fileCallback(filepath), batchSize, maxQueueSize, flushInterval)
+{}
+
+QueryLogSink::QueryLogSink(
+        CallbackType &&callback, const std::size_t batchSize,
+        const std::size_t maxQueueSize, const std::chrono::milliseconds flushInterval
+)
+    : m_callback(std::move(callback))
+    , m_batchSize(std::max<std::size_t>(1, batchSize))
+    , m_maxQueueSize(std::max(m_batchSize, maxQueueSize))
+    , m_flushInterval(flushInterval)
+    , m_thread(&QueryLogSink::run, this)
+{}
+
+QueryLogSink::~QueryLogSink()
+{
+    {
+        const QMutexLocker locker(&m_mutex);
+
+        m_stop = true;
+    }
+
+    m_ready.wakeOne();
+
+    // Remaining records are drained before the sink thread finishes
+    m_thread.join();
+}
+
+void QueryLogSink::push(const QString &connection, const Log &log)
+{
+    const QMutexLocker locker(&m_mutex);
+
+    if (static_cast<std::size_t>(m_queue.size()) >= m_maxQueueSize) {
+        ++m_dropped;
+        return;
+    }
+
+    m_queue.append({connection, log});
+
+    // Wake the sink thread only if the batch is full
+    if (static_cast<std::size_t>(m_queue.size()) >= m_batchSize)
+        m_ready.wakeOne();
+}
+
+void QueryLogSink::flush()
+{
+    QMutexLocker locker(&m_mutex);
+
+    // Nothing to do, all records were already drained
+    if (m_queue.isEmpty() && !m_writing)
+        return;
+
+    // The flush request is cleared by the sink thread after the queue is drained
+    m_flushRequested = true;
+    m_ready.wakeOne();
+
+    while (!m_queue.isEmpty() || m_writing)
+        m_drained.wait(&m_mutex);
+}
+
+qint64 QueryLogSink::written() const
+{
+    const QMutexLocker locker(&m_mutex);
+
+    return m_written;
+}
+
+qint64 QueryLogSink::dropped() const
+{
+    const QMutexLocker locker(&m_mutex);
+
+    return m_dropped;
+}
+
+QString QueryLogSink::format(const Record &record)
+{
+    const auto &log = record.log;
+
+    return QStringLiteral("%1 %2%3 query (%4ms, %5 results, %6 affected) : %7")
+            .arg(log.order)
+            .arg(record.connection.isEmpty() ? QString()
+                                             : QStringLiteral("[%1] ")
+                                               .arg(record.connection),
+                 log.type == Log::Type::TRANSACTION ? QStringLiteral("Transaction")
+                                                    : QStringLiteral("Executed"))
+            .arg(log.elapsed)
+            .arg(log.results)
+            .arg(log.affected)
+            .arg(QueryUtils::parseExecutedQueryForPretend(log.query, log.boundValues));
+}
+
+/* private */
+
+void QueryLogSink::run()
+{
+    QVector<Record> batch;
+
+    while (true) {
+        {
+            QMutexLocker locker(&m_mutex);
+
+            // Wait for the full batch, flush request, stop request, or flush interval
+            if (!m_stop && !m_flushRequested &&
+                static_cast<std::size_t>(m_queue.size()) < m_batchSize
+            )
+                m_ready.wait(&m_mutex, QDeadlineTimer(m_flushInterval));
+
+            if (m_queue.isEmpty()) {
+                /* The flush request is fulfilled, clear it here, otherwise this thread
+                   would spin without waiting until the flushing thread wakes up. */
+                m_flushRequested = false;
+                m_drained.wakeAll();
+
+                if (m_stop)
+                    return;
+
+                continue;
+            }
+
+            batch.swap(m_queue);
+            m_writing = true;
+        }
+
+        // Format and write records outside of the lock
+        auto written = true;
+        try {
+            std::invoke(m_callback, batch);
+        } catch (...) {
+            written = false;
+        }
+
+        {
+            const QMutexLocker locker(&m_mutex);
+
+            if (written)
+                m_written += batch.size();
+            else
+                m_dropped += batch.size();
+
+            m_writing = false;
+
+            if (m_queue.isEmpty())
+                m_drained.wakeAll();
+        }
+
+        batch.clear();
+    }
+}
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
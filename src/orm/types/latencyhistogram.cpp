@@ -0,0 +1,144 @@
+#include "orm/types/latencyhistogram.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Types
+{
+
+/* public */
+
+void LatencyHistogram::record(const qint64 value)
+{
+    // Nothing to record
+    if (value < 0)
+        return;
+
+    // Allocate buckets lazily, so the unused histograms don't occupy any memory
+    if (m_counts.empty())
+        m_counts.resize(BucketsCount);
+
+    ++m_counts[bucketIndex(static_cast<quint64>(value))];
+
+    if (m_count == 0 || value < m_min)
+        m_min = value;
+    if (value > m_max)
+        m_max = value;
+
+    ++m_count;
+    m_total += value;
+}
+
+LatencyHistogram &LatencyHistogram::merge(const LatencyHistogram &other)
+{
+    // Nothing to merge
+    if (other.m_count == 0)
+        return *this;
+
+    if (m_counts.empty())
+        m_counts.resize(BucketsCount);
+
+    for (std::size_t index = 0; index < BucketsCount; ++index)
+        m_counts[index] += other.m_counts[index];
+
+    m_min = m_count == 0 ? other.m_min : std::min(m_min, other.m_min);
+    m_max = std::max(m_max, other.m_max);
+
+    m_count += other.m_count;
+    m_total += other.m_total;
+
+    return *this;
+}
+
+void LatencyHistogram::reset()
+{
+    // Keep the allocated buckets, the histogram will be most likely re-used
+    std::fill(m_counts.begin(), m_counts.end(), 0);
+
+    m_count = 0;
+    m_min   = 0;
+    m_max   = 0;
+    m_total = 0;
+}
+
+qint64 LatencyHistogram::valueAtPercentile(const double percentile) const
+{
+    // Nothing to compute
+    if (m_count == 0)
+        return 0;
+
+    const auto percentile_ = std::clamp(percentile, 0.0, 100.0);
+
+    // Number of values that must be less than or equal to the returned value
+    const auto countAtPercentile = std::max<qint64>(
+            1, static_cast<qint64>(
+                   std::ceil(percentile_ / 100.0 * static_cast<double>(m_count))));
+
+    qint64 totalCount = 0;
+
+    for (std::size_t index = 0; index < BucketsCount; ++index) {
+        totalCount += m_counts[index];
+
+        if (totalCount < countAtPercentile)
+            continue;
+
+        // The last bucket also contains values above the highest trackable value
+        if (index == BucketsCount - 1)
+            return m_max;
+
+        return std::min(highestEquivalentValue(index), m_max);
+    }
+
+    return m_max;
+}
+
+LatencyPercentiles LatencyHistogram::percentiles() const
+{
+    return {m_count,
+            valueAtPercentile(50.0),
+            valueAtPercentile(90.0),
+            valueAtPercentile(99.0),
+            m_max};
+}
+
+/* private */
+
+std::size_t LatencyHistogram::bucketIndex(const quint64 value) noexcept
+{
+    const auto bitWidth = static_cast<int>(std::bit_width(value));
+
+    // The first range is linear, every value has its own bucket
+    if (bitWidth <= SubBucketBits)
+        return static_cast<std::size_t>(value);
+
+    // Values above the highest trackable value are recorded into the last bucket
+    if (bitWidth > HighestTrackableBits)
+        return BucketsCount - 1;
+
+    /* Every next power of two range is divided into the SubBucketHalfCount linear
+       sub-buckets, the sub-bucket is the value with the lowest bits shifted out. */
+    const auto shift = static_cast<std::size_t>(bitWidth - SubBucketBits);
+    const auto subBucket = static_cast<std::size_t>(value >> shift);
+
+    return SubBucketCount + ((shift - 1) * SubBucketHalfCount) +
+           (subBucket - SubBucketHalfCount);
+}
+
+qint64 LatencyHistogram::highestEquivalentValue(const std::size_t index) noexcept
+{
+    if (index < SubBucketCount)
+        return static_cast<qint64>(index);
+
+    const auto index_ = index - SubBucketCount;
+    const auto shift = (index_ / SubBucketHalfCount) + 1;
+    const auto subBucket = SubBucketHalfCount + (index_ % SubBucketHalfCount);
+
+    return static_cast<qint64>(((subBucket + 1) << shift) - 1);
+}
+
+} // namespace Orm::Types
+
+TINYORM_END_COMMON_NAMESPACE
@@ -0,0 +1,279 @@
+#include "orm/types/querystatistics.hpp"
+
+#include <vector>
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Types
+{
+
+namespace
+{
+    /*! Get the value of the given statistic used for sorting. */
+    qint64 sortValue(const QueryStatistic &statistic, const QueryStatisticsSort sortBy)
+    {
+        switch (sortBy) {
+        case QueryStatisticsSort::TotalTime:
+            return statistic.totalTime;
+
+        case QueryStatisticsSort::MeanTime:
+            return statistic.meanTime();
+
+        case QueryStatisticsSort::MaxTime:
+            return statistic.maxTime;
+
+        case QueryStatisticsSort::Calls:
+            return statistic.calls;
+
+        case QueryStatisticsSort::Rows:
+            return statistic.rows;
+
+        default:
+            Q_UNREACHABLE();
+        }
+    }
+
+    /*! Determine whether the given character can be a part of an identifier. */
+    inline bool isIdentifierChar(const QChar character)
+    {
+        return character.isLetterOrNumber() || character == QLatin1Char('_') ||
+               character == QLatin1Char('$');
+    }
+
+    /*! Append the ? placeholder, lists of placeholders are collapsed to ?... */
+    void appendPlaceholder(QString &fingerprint)
+    {
+        // The list was already collapsed, drop the separator
+        if (fingerprint.endsWith(QStringLiteral("?..., "))) {
+            fingerprint.chop(2);
+            return;
+        }
+        if (fingerprint.endsWith(QStringLiteral("?...,"))) {
+            fingerprint.chop(1);
+            return;
+        }
+
+        // Second placeholder in the list, collapse it
+        if (fingerprint.endsWith(QStringLiteral("?, "))) {
+            fingerprint.chop(2);
+            fingerprint.append(QStringLiteral("..."));
+            return;
+        }
+        if (fingerprint.endsWith(QStringLiteral("?,"))) {
+            fingerprint.chop(1);
+            fingerprint.append(QStringLiteral("..."));
+            return;
+        }
+
+        fingerprint.append(QLatin1Char('?'));
+    }
+} // namespace
+
+/* public */
+
+void QueryStatistics::record(const QString &query, const qint64 elapsed,
+                             const qint64 rows)
+{
+    auto fingerprint_ = fingerprint(query);
+
+    auto itStatistic = m_statistics.find(fingerprint_);
+
+    if (itStatistic == m_statistics.end()) {
+        // Make space for a new fingerprint
+        evictLeastExecuted(1);
+
+        itStatistic = m_statistics.insert(fingerprint_, {fingerprint_, 0, 0, elapsed,
+                                                         elapsed, 0});
+    }
+
+    auto &statistic = *itStatistic;
+
+    ++statistic.calls;
+    statistic.totalTime += elapsed;
+    statistic.minTime = std::min(statistic.minTime, elapsed);
+    statistic.maxTime = std::max(statistic.maxTime, elapsed);
+
+    // Rows are not reported by some drivers
+    if (rows > 0)
+        statistic.rows += rows;
+}
+
+void QueryStatistics::clear()
+{
+    m_statistics.clear();
+
+    m_evictions = 0;
+}
+
+QVector<QueryStatistic>
+QueryStatistics::top(const std::size_t count, const QueryStatisticsSort sortBy) const
+{
+    QVector<QueryStatistic> statistics;
+    statistics.reserve(m_statistics.size());
+
+    for (const auto &statistic : m_statistics)
+        statistics << statistic;
+
+    const auto topCount = static_cast<QVector<QueryStatistic>::size_type>(
+                              std::min(count, size()));
+
+    // Sort only the top N statistics (descending)
+    std::partial_sort(statistics.begin(), statistics.begin() + topCount,
+                      statistics.end(),
+                      [sortBy](const QueryStatistic &left, const QueryStatistic &right)
+    {
+        return sortValue(left, sortBy) > sortValue(right, sortBy);
+    });
+
+    statistics.resize(topCount);
+
+    return statistics;
+}
+
+std::optional<QueryStatistic> QueryStatistics::statistic(const QString &query) const
+{
+    const auto itStatistic = m_statistics.constFind(fingerprint(query));
+
+    if (itStatistic == m_statistics.constEnd())
+        return std::nullopt;
+
+    return *itStatistic;
+}
+
+void QueryStatistics::setMaxSize(const std::size_t maxSize)
+{
+    m_maxSize = std::max<std::size_t>(1, maxSize);
+
+    evictLeastExecuted(0);
+}
+
+QString QueryStatistics::fingerprint(const QString &query)
+{
+    using SizeType = QString::size_type;
+
+    QString normalized;
+    normalized.reserve(query.size());
+
+    const auto size = query.size();
+    auto pendingSpace = false;
+
+    for (SizeType index = 0; index < size;) {
+        const auto character = query.at(index);
+
+        // Collapse whitespaces
+        if (character.isSpace()) {
+            pendingSpace = !normalized.isEmpty();
+            ++index;
+            continue;
+        }
+
+        if (pendingSpace) {
+            normalized.append(QLatin1Char(' '));
+            pendingSpace = false;
+        }
+
+        // String literal, also handles the '' and \' escapes
+        if (character == QLatin1Char('\'')) {
+            for (++index; index < size; ++index) {
+                const auto literalCharacter = query.at(index);
+
+                if (literalCharacter == QLatin1Char('\\')) {
+                    ++index;
+                    continue;
+                }
+
+                if (literalCharacter != QLatin1Char('\''))
+                    continue;
+
+                if (index + 1 < size && query.at(index + 1) == QLatin1Char('\'')) {
+                    ++index;
+                    continue;
+                }
+
+                break;
+            }
+
+            ++index;
+            appendPlaceholder(normalized);
+            continue;
+        }
+
+        // Quoted identifier, copy it as it is
+        if (character == QLatin1Char('"') || character == QLatin1Char('`')) {
+            const auto end = query.indexOf(character, index + 1);
+            const auto length = end == -1 ? size - index : end - index + 1;
+
+            normalized.append(QStringView(query).mid(index, length));
+            index += length;
+            continue;
+        }
+
+        // Placeholder
+        if (character == QLatin1Char('?')) {
+            ++index;
+            appendPlaceholder(normalized);
+            continue;
+        }
+
+        // Numeric literal, it can't be a part of an identifier like table1
+        if (character.isDigit() &&
+            (index == 0 || !isIdentifierChar(query.at(index - 1)))
+        ) {
+            while (index < size && (query.at(index).isLetterOrNumber() ||
+                                    query.at(index) == QLatin1Char('.'))
+            )
+                ++index;
+
+            appendPlaceholder(normalized);
+            continue;
+        }
+
+        normalized.append(character);
+        ++index;
+    }
+
+    return normalized;
+}
+
+/* private */
+
+void QueryStatistics::evictLeastExecuted(const std::size_t freeSpace)
+{
+    const auto size = this->size();
+
+    // Nothing to do
+    if (size + freeSpace <= m_maxSize)
+        return;
+
+    /* Evict at least 5% of fingerprints at once (like the pg_stat_statements does),
+       so the eviction cost is amortized over the following inserts. */
+    const auto count = std::min(size, std::max({size + freeSpace - m_maxSize,
+                                                size / 20,
+                                                static_cast<std::size_t>(1)}));
+
+    std::vector<std::pair<qint64, QString>> calls;
+    calls.reserve(size);
+
+    for (auto itStatistic = m_statistics.constBegin();
+         itStatistic != m_statistics.constEnd(); ++itStatistic
+    )
+        calls.emplace_back(itStatistic->calls, itStatistic.key());
+
+    // Move the least executed fingerprints to the front
+    const auto nth = calls.begin() + static_cast<std::ptrdiff_t>(count - 1);
+
+    std::nth_element(calls.begin(), nth, calls.end(),
+                     [](const auto &left, const auto &right)
+    {
+        return left.first < right.first;
+    });
+
+    for (auto itCall = calls.cbegin(); itCall != nth + 1; ++itCall)
+        m_statistics.remove(itCall->second);
+
+    m_evictions += static_cast<qint64>(count);
+}
+
+} // namespace Orm::Types
+
+TINYORM_END_COMMON_NAMESPACE
@@ -2,7 +2,10 @@
 
 #include <QtSql/QSqlDriver>
 
+#include <utility>
+
 #include "orm/query/grammars/grammar.hpp"
+#include "orm/support/preparedstatementscache.hpp"
 #include "orm/utils/helpers.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
@@ -26,6 +29,21 @@ SqlQuery::SqlQuery(QSqlQuery &&other, const QtTimeZoneConfig &qtTimeZone, // NOL
     , m_returnQDateTime(std::move(returnQDateTime))
 {}
 
+void SqlQuery::releaseStatement()
+{
+    /* The moved-from query has an empty weak pointer, the expired cache means that
+       it was flushed or the connection was destroyed in the meantime. */
+    const auto statementsCache = std::exchange(m_statementsCache, {}).lock();
+
+    if (!statementsCache)
+        return;
+
+    // Hand over the prepared query to the cache and leave the empty query here
+    QSqlQuery &query = *this;
+
+    statementsCache->insert(m_statementsCacheKey, std::exchange(query, QSqlQuery()));
+}
+
 /* private */
 
 QVariant SqlQuery::valueInternal(QVariant &&value) const
@@ -84,6 +84,127 @@ Configuration::prepareQtTimeZone(const QVariant &qtTimeZone, const QString &conn
     }
 }
 
+namespace
+{
+    /*! Get the non-negative integer configuration option value (nullopt if not
+        defined), throws if the value is invalid. */
+    std::optional<qint64>
+    nonNegativeIntegerOption(const QVariantHash &config, const QString &option,
+                             const QString &connection, const QString &functionName)
+    {
+        if (!config.contains(option))
+            return std::nullopt;
+
+        const auto &value = config[option];
+
+        if (!value.isValid() || value.isNull())
+            return std::nullopt;
+
+        auto ok = false;
+        const auto integerValue = value.toLongLong(&ok);
+
+        if (ok && integerValue >= 0)
+            return integerValue;
+
+        throw Exceptions::InvalidArgumentError(
+                    QStringLiteral("The '%1' configuration option for the '%2' "
+                                   "connection must be a non-negative integer, "
+                                   "passed '%3' in %4().")
+                    .arg(option, connection, value.value<QString>(),
+                         functionName));
+    }
+} // namespace
+
+std::size_t
+Configuration::prepareStatementsCacheSize(const QVariantHash &config,
+                                          const QString &connection)
+{
+    // The prepared statements cache is disabled by default
+    return static_cast<std::size_t>(
+                nonNegativeIntegerOption(config, statements_cache_size, connection,
+                                         __tiny_func__)
+                .value_or(0));
+}
+
+std::size_t
+Configuration::prepareCompiledSqlCacheSize(const QVariantHash &config,
+                                           const QString &connection)
+{
+    // The compiled SQL cache is disabled by default
+    return static_cast<std::size_t>(
+                nonNegativeIntegerOption(config, compiled_sql_cache_size, connection,
+                                         __tiny_func__)
+                .value_or(0));
+}
+
+std::optional<ConnectionPoolConfig>
+Configuration::preparePoolConfig(const QVariantHash &config, const QString &connection)
+{
+    const auto functionName = __tiny_func__;
+
+    const auto maxSize = nonNegativeIntegerOption(config, pool_max_size, connection,
+                                                  functionName)
+                         .value_or(0);
+
+    // Nothing to do, the connection pool is disabled by default
+    if (maxSize == 0)
+        return std::nullopt;
+
+    ConnectionPoolConfig poolConfig;
+    poolConfig.maxSize = static_cast<std::size_t>(maxSize);
+
+    if (const auto minSize = nonNegativeIntegerOption(
+                                 config, pool_min_size, connection,
+                                 functionName);
+        minSize
+    )
+        poolConfig.minSize = static_cast<std::size_t>(*minSize);
+
+    if (const auto idleTimeout = nonNegativeIntegerOption(
+                                     config, pool_idle_timeout, connection,
+                                     functionName);
+        idleTimeout
+    )
+        poolConfig.idleTimeout = std::chrono::milliseconds(*idleTimeout);
+
+    if (const auto waitTimeout = nonNegativeIntegerOption(
+                                     config, pool_wait_timeout, connection,
+                                     functionName);
+        waitTimeout
+    )
+        poolConfig.waitTimeout = std::chrono::milliseconds(*waitTimeout);
+
+    poolConfig.validate = config.value(pool_validate, false).value<bool>();
+
+    if (poolConfig.minSize <= poolConfig.maxSize)
+        return poolConfig;
+
+    throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The '%1' configuration option for the '%2' connection "
+                               "can't be greater than the '%3' option in %4().")
+                .arg(pool_min_size, connection, pool_max_size, __tiny_func__));
+}
+
+ReadStrategy
+Configuration::prepareReadStrategy(const QVariantHash &config,
+                                   const QString &connection)
+{
+    const auto readStrategy = config.value(read_strategy).value<QString>();
+
+    // The random read connection is selected by default
+    if (readStrategy.isEmpty() || readStrategy == random_)
+        return ReadStrategy::Random;
+
+    if (readStrategy == round_robin)
+        return ReadStrategy::RoundRobin;
+
+    throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The '%1' configuration option for the '%2' connection "
+                               "must be '%3' or '%4', passed '%5' in %6().")
+                .arg(read_strategy, connection, random_, round_robin, readStrategy,
+                     __tiny_func__));
+}
+
 /* MySQL section */
 
 namespace
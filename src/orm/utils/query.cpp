@@ -82,6 +82,29 @@ int Query::queryResultSize(QSqlQuery &query)
     return size;
 }
 
+namespace
+{
+    /*! Maximum size hint obtained from the LIMIT clause, bigger results grow. */
+    constexpr auto MaxLimitSizeHint = 10000;
+} // namespace
+
+int Query::queryResultSizeHint(const QSqlQuery &query, const int limit)
+{
+    if (const auto *const driver = query.driver();
+        driver != nullptr && driver->hasFeature(QSqlDriver::QuerySize)
+    )
+        if (const auto size = query.size(); size >= 0)
+            return size;
+
+    /* Don't count rows manually (SQLite), it would walk the whole result set twice
+       and it's impossible for forward-only results, the LIMIT clause is the best
+       guess we have, it's capped because it can be much bigger than the result. */
+    if (limit < 0)
+        return -1;
+
+    return std::min(limit, MaxLimitSizeHint);
+}
+
 } // namespace Orm::Utils
 
 TINYORM_END_COMMON_NAMESPACE
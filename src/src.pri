@@ -56,6 +56,11 @@ sourcesList += \
     $$PWD/orm/schema/schemabuilder.cpp \
     $$PWD/orm/schema/sqliteschemabuilder.cpp \
     $$PWD/orm/sqliteconnection.cpp \
+    $$PWD/orm/support/asyncqueryworker.cpp \
+    $$PWD/orm/support/connectionpool.cpp \
+    $$PWD/orm/support/querylogsink.cpp \
+    $$PWD/orm/types/latencyhistogram.cpp \
+    $$PWD/orm/types/querystatistics.cpp \
     $$PWD/orm/types/sqlquery.cpp \
     $$PWD/orm/utils/configuration.cpp \
     $$PWD/orm/utils/fs.cpp \
@@ -0,0 +1,57 @@
+#include "benchmarks.hpp"
+
+#include "orm/db.hpp"
+
+#include "databases.hpp"
+
+using Orm::DB;
+
+namespace TestUtils
+{
+
+QString Benchmarks::createConnection(const QVector<Table> &tables)
+{
+    auto connection = Databases::createConnection(Databases::SQLITE);
+
+    // Nothing to seed, the benchmark will be skipped
+    if (connection.isEmpty())
+        return connection;
+
+    // Tables from the previous (interrupted) run
+    dropTables(connection, tables);
+
+    for (const auto &table : tables) {
+        DB::unprepared(QStringLiteral(R"(create table "%1" (%2))")
+                       .arg(table.name, table.columns),
+                       connection);
+
+        auto bindings = table.bindings;
+        bindings.prepend(table.rowsCount);
+
+        // Generate all rows using the single query
+        DB::statement(QStringLiteral(
+                          R"(insert into "%1" (%2) )"
+                          R"(with recursive "seq"("x") as )"
+                          R"((select 1 union all select "x" + 1 from "seq" )"
+                          R"(where "x" < ?) )"
+                          R"(select %3 from "seq")")
+                      .arg(table.name, table.insertColumns, table.values),
+                      bindings, connection);
+    }
+
+    return connection;
+}
+
+void Benchmarks::dropTables(const QString &connection, const QVector<Table> &tables)
+{
+    // Nothing to drop, the benchmark was skipped
+    if (connection.isEmpty())
+        return;
+
+    for (auto itTable = tables.crbegin(); itTable != tables.crend(); ++itTable)
+        DB::unprepared(QStringLiteral(R"(drop table if exists "%1")")
+                       .arg(itTable->name),
+                       connection);
+}
+
+} // namespace TestUtils
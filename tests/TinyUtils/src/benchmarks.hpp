@@ -0,0 +1,51 @@
+#pragma once
+#ifndef TINYUTILS_BENCHMARKS_HPP
+#define TINYUTILS_BENCHMARKS_HPP
+
+#include <QVariant>
+#include <QVector>
+
+#include "export.hpp"
+
+namespace TestUtils
+{
+
+    /*! Fixture shared by the benchmarks, creates the benchmark connection and its
+        seeded tables. */
+    class TINYUTILS_EXPORT Benchmarks final
+    {
+        Q_DISABLE_COPY(Benchmarks)
+
+    public:
+        /*! Deleted default constructor, this is a pure library class. */
+        Benchmarks() = delete;
+        /*! Deleted destructor. */
+        ~Benchmarks() = delete;
+
+        /*! Benchmark table, all its rows are generated using the single query. */
+        struct Table
+        {
+            /*! Table name. */
+            QString name;
+            /*! Column definitions of the create table statement. */
+            QString columns;
+            /*! Columns filled by the insert statement. */
+            QString insertColumns;
+            /*! Values selected for every row, the "x" column is the row number. */
+            QString values;
+            /*! Number of generated rows. */
+            qint64 rowsCount;
+            /*! Bindings of the selected values. */
+            QVector<QVariant> bindings {};
+        };
+
+        /*! Create the SQLite connection for benchmarks and create and seed the given
+            tables, returns an empty string if the connection is not available. */
+        static QString createConnection(const QVector<Table> &tables = {});
+        /*! Drop the given tables (in the reverse order). */
+        static void dropTables(const QString &connection, const QVector<Table> &tables);
+    };
+
+} // namespace TestUtils
+
+#endif // TINYUTILS_BENCHMARKS_HPP
@@ -101,6 +101,32 @@ QString Databases::createConnection(const QString &connection)
     return {};
 }
 
+QString Databases::createConnectionTempFrom(const QString &fromConnection,
+                                           const QString &connection,
+                                           const QVariantHash &optionsToUpdate)
+{
+    const auto &manager_ = manager();
+
+    // The environment variables for the given connection have not been defined
+    if (!manager_->connectionNames().contains(fromConnection))
+        return {};
+
+    auto configuration = manager_->originalConfig(fromConnection);
+
+    auto options = configuration.value(options_).value<QVariantHash>();
+
+    for (auto itOption = optionsToUpdate.constBegin();
+         itOption != optionsToUpdate.constEnd(); ++itOption
+    )
+        options.insert(itOption.key(), itOption.value());
+
+    configuration.insert(options_, options);
+
+    manager_->addConnection(configuration, connection);
+
+    return connection;
+}
+
 bool Databases::allEnvVariablesEmpty(const std::vector<const char *> &envVariables)
 {
     return std::all_of(envVariables.cbegin(), envVariables.cend(),
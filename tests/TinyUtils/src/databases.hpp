@@ -46,6 +46,13 @@ namespace TestUtils
         createConnections(const QStringList &connections = {});
         /*! Create database connection. */
         static QString createConnection(const QString &connection);
+        /*! Create a new database connection from the configuration of the given
+            connection with the updated connection options, returns an empty string
+            if the given connection is not available. */
+        static QString
+        createConnectionTempFrom(const QString &fromConnection,
+                                 const QString &connection,
+                                 const QVariantHash &optionsToUpdate);
 
         /*! Check whether all env. variables are empty. */
         static bool allEnvVariablesEmpty(const std::vector<const char *> &envVariables);
@@ -1,11 +1,13 @@
 INCLUDEPATH += $$PWD
 
 HEADERS += \
+    $$PWD/benchmarks.hpp \
     $$PWD/databases.hpp \
     $$PWD/export.hpp \
     $$PWD/fs.hpp \
     $$PWD/version.hpp \
 
 SOURCES += \
+    $$PWD/benchmarks.cpp \
     $$PWD/databases.cpp \
     $$PWD/fs.cpp \
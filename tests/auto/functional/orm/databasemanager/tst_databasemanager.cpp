@@ -1,8 +1,13 @@
 #include <QCoreApplication>
 #include <QtTest>
 
+#include <future>
+#include <thread>
+
 #include "orm/constants.hpp"
 #include "orm/databasemanager.hpp"
+#include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/exceptions/logicerror.hpp"
 #include "orm/exceptions/sqlitedatabasedoesnotexisterror.hpp"
 
 #include "databases.hpp"
@@ -29,10 +34,15 @@ using Orm::Constants::driver_;
 using Orm::Constants::host_;
 using Orm::Constants::options_;
 using Orm::Constants::password_;
+using Orm::Constants::pool_max_size;
+using Orm::Constants::pool_min_size;
+using Orm::Constants::pool_wait_timeout;
 using Orm::Constants::port_;
 using Orm::Constants::prefix_;
 using Orm::Constants::prefix_indexes;
 using Orm::Constants::qt_timezone;
+using Orm::Constants::read_;
+using Orm::Constants::read_strategy;
 using Orm::Constants::return_qdatetime;
 using Orm::Constants::schema_;
 using Orm::Constants::spatial_ref_sys;
@@ -41,10 +51,14 @@ using Orm::Constants::sslcert;
 using Orm::Constants::sslkey;
 using Orm::Constants::sslmode_;
 using Orm::Constants::sslrootcert;
+using Orm::Constants::sticky_;
 using Orm::Constants::username_;
 using Orm::Constants::verify_full;
 
+using Orm::DatabaseConnection;
 using Orm::DatabaseManager;
+using Orm::Exceptions::InvalidArgumentError;
+using Orm::Exceptions::LogicError;
 using Orm::Exceptions::RuntimeError;
 using Orm::Exceptions::SQLiteDatabaseDoesNotExistError;
 using Orm::QtTimeZoneConfig;
@@ -73,6 +87,19 @@ private Q_SLOTS:
     void sqlite_CheckDatabaseExists_True() const;
     void sqlite_CheckDatabaseExists_False() const;
 
+    void pool_CheckoutCheckin() const;
+    void pool_WaitTimeout() const;
+    void pool_MultipleThreads() const;
+    void pool_ConnectionWithoutCheckout_Throws() const;
+    void pool_RetiredConnection_CountsAgainstMaxSize() const;
+    void pool_MinSize_Prewarmed() const;
+    void pool_RemoveConnection_WhileCheckedOut() const;
+    void pool_NotPooled() const;
+    void pool_InvalidConfiguration() const;
+
+    void readWrite_SQLite_Sticky() const;
+    void readWrite_InvalidReadStrategy() const;
+
 // NOLINTNEXTLINE(readability-redundant-access-specifiers)
 private:
     /*! Path to the SQLite database file, for testing the 'check_database_exists'
@@ -621,6 +648,506 @@ void tst_DatabaseManager::sqlite_CheckDatabaseExists_False() const
     QVERIFY(QFile::remove(checkDatabaseExistsFile()));
     QVERIFY(!QFile::exists(checkDatabaseExistsFile()));
 }
+
+void tst_DatabaseManager::pool_CheckoutCheckin() const
+{
+    const auto connectionName =
+            QStringLiteral(
+                "tinyorm_sqlite_tests-tst_DatabaseMannager-pool_CheckoutCheckin");
+
+    // Create database connection
+    m_dm->addConnections({
+        {connectionName, {
+            {driver_,       QSQLITE},
+            {database_,     QStringLiteral(":memory:")},
+            {pool_max_size, 2},
+        }},
+    // Don't setup any default connection
+    }, EMPTY);
+
+    QVERIFY(m_dm->isPooled(connectionName));
+
+    DatabaseConnection *firstConnection = nullptr;
+
+    {
+        auto pooled = m_dm->checkout(connectionName);
+        firstConnection = &pooled.get();
+
+        // The connection() returns the connection borrowed by the current task
+        QCOMPARE(&m_dm->connection(connectionName), firstConnection);
+        // The pooled connection has the same name as the connection
+        QCOMPARE(pooled->getName(), connectionName);
+
+        auto query = pooled->selectOne("select 1 as one");
+        QCOMPARE(query.value("one").value<int>(), 1);
+
+        const auto stats = m_dm->poolStats(connectionName);
+        QCOMPARE(stats.maxSize, static_cast<std::size_t>(2));
+        QCOMPARE(stats.size, static_cast<std::size_t>(1));
+        QCOMPARE(stats.inUse, static_cast<std::size_t>(1));
+        QCOMPARE(stats.idle, static_cast<std::size_t>(0));
+        QCOMPARE(stats.saturation(), 0.5);
+    }
+
+    // Returned to the pool
+    auto stats = m_dm->poolStats(connectionName);
+    QCOMPARE(stats.size, static_cast<std::size_t>(1));
+    QCOMPARE(stats.inUse, static_cast<std::size_t>(0));
+    QCOMPARE(stats.idle, static_cast<std::size_t>(1));
+    QCOMPARE(stats.checkouts, static_cast<qint64>(1));
+
+    // The idle connection is reused by the same thread
+    {
+        auto pooled = m_dm->checkout(connectionName);
+        QCOMPARE(&pooled.get(), firstConnection);
+    }
+
+    // Nested checkout, the connection() returns the last borrowed connection
+    {
+        const auto pooled = m_dm->checkout(connectionName);
+
+        {
+            const auto nested = m_dm->checkout(connectionName);
+            QVERIFY(&nested.get() != &pooled.get());
+            QCOMPARE(&m_dm->connection(connectionName), &nested.get());
+        }
+
+        QCOMPARE(&m_dm->connection(connectionName), &pooled.get());
+    }
+
+    stats = m_dm->poolStats(connectionName);
+    QCOMPARE(stats.inUse, static_cast<std::size_t>(0));
+    QCOMPARE(stats.checkouts, static_cast<qint64>(4));
+    QCOMPARE(stats.created, static_cast<qint64>(2));
+    QCOMPARE(stats.peakInUse, static_cast<std::size_t>(2));
+
+    // Reset metrics
+    m_dm->resetPoolStats(connectionName);
+    stats = m_dm->poolStats(connectionName);
+    QCOMPARE(stats.checkouts, static_cast<qint64>(0));
+    QCOMPARE(stats.size, static_cast<std::size_t>(1));
+
+    // Restore
+    QVERIFY(m_dm->removeConnection(connectionName));
+    QVERIFY(!m_dm->isPooled(connectionName));
+}
+
+void tst_DatabaseManager::pool_WaitTimeout() const
+{
+    const auto connectionName =
+            QStringLiteral(
+                "tinyorm_sqlite_tests-tst_DatabaseMannager-pool_WaitTimeout");
+
+    // Create database connection
+    m_dm->addConnections({
+        {connectionName, {
+            {driver_,           QSQLITE},
+            {database_,         QStringLiteral(":memory:")},
+            {pool_max_size,     1},
+            {pool_wait_timeout, 50},
+        }},
+    // Don't setup any default connection
+    }, EMPTY);
+
+    {
+        const auto pooled = m_dm->checkout(connectionName);
+
+        // The pool is saturated
+        QCOMPARE(m_dm->poolStats(connectionName).saturation(), 1.0);
+
+        QVERIFY_EXCEPTION_THROWN(m_dm->checkout(connectionName), RuntimeError);
+    }
+
+    const auto stats = m_dm->poolStats(connectionName);
+    QCOMPARE(stats.checkouts, static_cast<qint64>(1));
+    QCOMPARE(stats.waits, static_cast<qint64>(1));
+    QCOMPARE(stats.timeouts, static_cast<qint64>(1));
+    QCOMPARE(stats.inUse, static_cast<std::size_t>(0));
+
+    // Restore
+    QVERIFY(m_dm->removeConnection(connectionName));
+}
+
+void tst_DatabaseManager::pool_MultipleThreads() const
+{
+    const auto connectionName =
+            QStringLiteral(
+                "tinyorm_sqlite_tests-tst_DatabaseMannager-pool_MultipleThreads");
+
+    // Create database connection
+    m_dm->addConnections({
+        {connectionName, {
+            {driver_,       QSQLITE},
+            {database_,     QStringLiteral(":memory:")},
+            {pool_max_size, 2},
+        }},
+    // Don't setup any default connection
+    }, EMPTY);
+
+    constexpr auto threadsCount = 8;
+
+    std::atomic_int succeeded = 0;
+    std::vector<std::thread> threads;
+    threads.reserve(threadsCount);
+
+    for (auto i = 0; i < threadsCount; ++i)
+        threads.emplace_back([this, &connectionName, &succeeded]
+        {
+            // The connection is borrowed for this task only
+            const auto pooled = m_dm->checkout(connectionName);
+
+            auto query = m_dm->connection(connectionName).selectOne("select 1 as one");
+
+            if (query.value("one").value<int>() == 1)
+                ++succeeded;
+        });
+
+    for (auto &thread : threads)
+        thread.join();
+
+    QCOMPARE(succeeded.load(), threadsCount);
+
+    // All threads shared at most two connections
+    const auto stats = m_dm->poolStats(connectionName);
+    QVERIFY(stats.size <= static_cast<std::size_t>(2));
+    QVERIFY(stats.peakInUse <= static_cast<std::size_t>(2));
+    QCOMPARE(stats.inUse, static_cast<std::size_t>(0));
+    QCOMPARE(stats.checkouts, static_cast<qint64>(threadsCount));
+    QVERIFY(stats.maxWaitTime >= 0);
+
+    // Restore
+    QVERIFY(m_dm->removeConnection(connectionName));
+}
+
+void tst_DatabaseManager::pool_ConnectionWithoutCheckout_Throws() const
+{
+    const auto connectionName =
+            QStringLiteral(
+                "tinyorm_sqlite_tests-tst_DatabaseMannager-"
+                "pool_ConnectionWithoutCheckout_Throws");
+
+    // Create database connection
+    m_dm->addConnections({
+        {connectionName, {
+            {driver_,       QSQLITE},
+            {database_,     QStringLiteral(":memory:")},
+            {pool_max_size, 1},
+        }},
+    // Don't setup any default connection
+    }, EMPTY);
+
+    // The pooled connection is never pinned to the current thread
+    QVERIFY_EXCEPTION_THROWN(m_dm->connection(connectionName), LogicError);
+    QVERIFY_EXCEPTION_THROWN(m_dm->reconnect(connectionName), LogicError);
+
+    const auto stats = m_dm->poolStats(connectionName);
+    QCOMPARE(stats.checkouts, static_cast<qint64>(0));
+    QCOMPARE(stats.inUse, static_cast<std::size_t>(0));
+
+    // Restore
+    QVERIFY(m_dm->removeConnection(connectionName));
+}
+
+void tst_DatabaseManager::pool_RetiredConnection_CountsAgainstMaxSize() const
+{
+    const auto connectionName =
+            QStringLiteral(
+                "tinyorm_sqlite_tests-tst_DatabaseMannager-"
+                "pool_RetiredConnection_CountsAgainstMaxSize");
+
+    // Create database connection
+    m_dm->addConnections({
+        {connectionName, {
+            {driver_,           QSQLITE},
+            {database_,         QStringLiteral(":memory:")},
+            {pool_max_size,     1},
+            {pool_wait_timeout, 50},
+        }},
+    // Don't setup any default connection
+    }, EMPTY);
+
+    std::promise<void> returned;
+    std::promise<void> finish;
+
+    // The idle connection is opened by another thread that is still running
+    std::thread thread([this, &connectionName, &returned,
+                        finished = finish.get_future()]
+    {
+        {
+            const auto pooled = m_dm->checkout(connectionName);
+            pooled->selectOne("select 1 as one");
+        }
+
+        returned.set_value();
+        finished.wait();
+    });
+
+    returned.get_future().wait();
+
+    /* The idle connection is retired but it can only be closed by the thread that
+       opened it, so no new connection can be created until it's closed. */
+    QVERIFY_EXCEPTION_THROWN(m_dm->checkout(connectionName), RuntimeError);
+
+    auto stats = m_dm->poolStats(connectionName);
+    QCOMPARE(stats.size, static_cast<std::size_t>(0));
+    QCOMPARE(stats.retired, static_cast<std::size_t>(1));
+    QCOMPARE(stats.timeouts, static_cast<qint64>(1));
+
+    // The retired connection is closed when the thread finishes
+    finish.set_value();
+    thread.join();
+
+    QCOMPARE(m_dm->poolStats(connectionName).retired, static_cast<std::size_t>(0));
+
+    {
+        const auto pooled = m_dm->checkout(connectionName);
+        QVERIFY(pooled->selectOne("select 1 as one").isValid());
+    }
+
+    stats = m_dm->poolStats(connectionName);
+    QCOMPARE(stats.size, static_cast<std::size_t>(1));
+    QCOMPARE(stats.created, static_cast<qint64>(2));
+    QCOMPARE(stats.peakInUse, static_cast<std::size_t>(1));
+
+    // Restore
+    QVERIFY(m_dm->removeConnection(connectionName));
+}
+
+void tst_DatabaseManager::pool_MinSize_Prewarmed() const
+{
+    const auto connectionName =
+            QStringLiteral(
+                "tinyorm_sqlite_tests-tst_DatabaseMannager-pool_MinSize_Prewarmed");
+
+    // Create database connection
+    m_dm->addConnections({
+        {connectionName, {
+            {driver_,       QSQLITE},
+            {database_,     QStringLiteral(":memory:")},
+            {pool_min_size, 2},
+            {pool_max_size, 3},
+        }},
+    // Don't setup any default connection
+    }, EMPTY);
+
+    // The pool_min_size connections are opened when the pool is created
+    auto stats = m_dm->poolStats(connectionName);
+    QCOMPARE(stats.size, static_cast<std::size_t>(2));
+    QCOMPARE(stats.idle, static_cast<std::size_t>(2));
+    QCOMPARE(stats.created, static_cast<qint64>(2));
+
+    // The pre-warmed connection is already opened and reused by this thread
+    {
+        const auto pooled = m_dm->checkout(connectionName);
+        QVERIFY(pooled->isOpen());
+    }
+
+    stats = m_dm->poolStats(connectionName);
+    QCOMPARE(stats.size, static_cast<std::size_t>(2));
+    QCOMPARE(stats.created, static_cast<qint64>(2));
+
+    // Restore
+    QVERIFY(m_dm->removeConnection(connectionName));
+}
+
+void tst_DatabaseManager::pool_RemoveConnection_WhileCheckedOut() const
+{
+    const auto connectionName =
+            QStringLiteral(
+                "tinyorm_sqlite_tests-tst_DatabaseMannager-"
+                "pool_RemoveConnection_WhileCheckedOut");
+
+    // Create database connection
+    m_dm->addConnections({
+        {connectionName, {
+            {driver_,       QSQLITE},
+            {database_,     QStringLiteral(":memory:")},
+            {pool_max_size, 2},
+        }},
+    // Don't setup any default connection
+    }, EMPTY);
+
+    auto pooled = m_dm->checkout(connectionName);
+
+    QVERIFY(m_dm->removeConnection(connectionName));
+    QVERIFY(!m_dm->isPooled(connectionName));
+
+    // The checked out connection keeps the pool alive
+    auto query = pooled->selectOne("select 1 as one");
+    QCOMPARE(query.value("one").value<int>(), 1);
+
+    // The pool and its connections are destroyed after the connection is returned
+    pooled.release();
+}
+
+void tst_DatabaseManager::pool_NotPooled() const
+{
+    const auto connectionName =
+            QStringLiteral(
+                "tinyorm_sqlite_tests-tst_DatabaseMannager-pool_NotPooled");
+
+    // Create database connection
+    m_dm->addConnections({
+        {connectionName, {
+            {driver_,   QSQLITE},
+            {database_, QStringLiteral(":memory:")},
+        }},
+    // Don't setup any default connection
+    }, EMPTY);
+
+    QVERIFY(!m_dm->isPooled(connectionName));
+    QVERIFY_EXCEPTION_THROWN(m_dm->checkout(connectionName), InvalidArgumentError);
+    QVERIFY_EXCEPTION_THROWN(m_dm->poolStats(connectionName), InvalidArgumentError);
+
+    // Restore
+    QVERIFY(m_dm->removeConnection(connectionName));
+}
+
+void tst_DatabaseManager::pool_InvalidConfiguration() const
+{
+    const auto connectionName =
+            QStringLiteral(
+                "tinyorm_sqlite_tests-tst_DatabaseMannager-pool_InvalidConfiguration");
+
+    // pool_min_size > pool_max_size
+    QVERIFY_EXCEPTION_THROWN(
+                m_dm->addConnection({
+                    {driver_,       QSQLITE},
+                    {database_,     QStringLiteral(":memory:")},
+                    {pool_min_size, 3},
+                    {pool_max_size, 2},
+                }, connectionName),
+                InvalidArgumentError);
+
+    // Negative value
+    QVERIFY_EXCEPTION_THROWN(
+                m_dm->addConnection({
+                    {driver_,       QSQLITE},
+                    {database_,     QStringLiteral(":memory:")},
+                    {pool_max_size, -1},
+                }, connectionName),
+                InvalidArgumentError);
+
+    QVERIFY(!m_dm->connectionNames().contains(connectionName));
+}
+
+void tst_DatabaseManager::readWrite_SQLite_Sticky() const
+{
+    const QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+
+    const auto writeDatabase = tempDir.filePath(QStringLiteral("write.sqlite3"));
+    const auto readDatabase  = tempDir.filePath(QStringLiteral("read.sqlite3"));
+
+    const auto connectionName =
+            QStringLiteral(
+                "tinyorm_sqlite_tests-tst_DatabaseMannager-readWrite_SQLite_Sticky");
+    const auto replicaName =
+            QStringLiteral(
+                "tinyorm_sqlite_tests-tst_DatabaseMannager-readWrite_SQLite_Replica");
+
+    // Create database connections, the read connection has its own database file
+    m_dm->addConnections({
+        {connectionName, {
+            {driver_,               QSQLITE},
+            {database_,             writeDatabase},
+            {check_database_exists, false},
+            {read_,                 QVariantHash {{database_, readDatabase}}},
+            {sticky_,               true},
+        }},
+        {replicaName, {
+            {driver_,               QSQLITE},
+            {database_,             readDatabase},
+            {check_database_exists, false},
+        }},
+    // Don't setup any default connection
+    }, EMPTY);
+
+    // The replica contains the same table with different records
+    auto &replica = m_dm->connection(replicaName);
+    replica.statement("create table tbl1 (name varchar(10))");
+    replica.insert("insert into tbl1 values(?)", {"replica"});
+
+    auto &conn = m_dm->connection(connectionName);
+    QVERIFY(conn.hasReadConnections());
+    QCOMPARE(conn.readConnectionsCount(), static_cast<std::size_t>(1));
+    QVERIFY(conn.isSticky());
+
+    conn.statement("create table tbl1 (name varchar(10))");
+    conn.forgetRecordModificationState();
+
+    const auto selectName = [&conn](const bool useReadConnection = true)
+    {
+        return conn.scalar("select name from tbl1", {}, useReadConnection)
+                .value<QString>();
+    };
+
+    const auto primary = QStringLiteral("primary");
+    const auto replica_ = QStringLiteral("replica");
+
+    // Nothing was modified yet, select from the replica
+    QCOMPARE(selectName(), replica_);
+    QCOMPARE(selectName(false), QString());
+
+    // Sticky, read your own writes
+    conn.insert("insert into tbl1 values(?)", {primary});
+    QCOMPARE(selectName(), primary);
+
+    // The update that doesn't affect any rows doesn't reset the sticky state
+    conn.update("update tbl1 set name = ? where name = ?", {"none", "none"});
+    QCOMPARE(selectName(), primary);
+
+    // Reset the sticky state (eg. at the end of a request)
+    conn.forgetRecordModificationState();
+    QCOMPARE(selectName(), replica_);
+    auto writeQuery = conn.selectFromWriteConnection("select name from tbl1");
+    QVERIFY(writeQuery.first());
+    QCOMPARE(writeQuery.value(0).value<QString>(), primary);
+
+    // The query builder
+    QCOMPARE(conn.table("tbl1")->value(NAME).value<QString>(), replica_);
+    QCOMPARE(conn.table("tbl1")->useWriteConnection().value(NAME).value<QString>(),
+             primary);
+    QCOMPARE(conn.table("tbl1")->lockForUpdate().value(NAME).value<QString>(),
+             primary);
+
+    // Transactions are always started on the write connection
+    QVERIFY(conn.beginTransaction());
+    QVERIFY(!conn.shouldUseReadConnection());
+    QCOMPARE(selectName(), primary);
+    QVERIFY(conn.rollBack());
+
+    QVERIFY(conn.shouldUseReadConnection());
+
+    // Restore
+    QVERIFY(m_dm->removeConnection(connectionName));
+    QVERIFY(m_dm->removeConnection(replicaName));
+}
+
+void tst_DatabaseManager::readWrite_InvalidReadStrategy() const
+{
+    const auto connectionName =
+            QStringLiteral(
+                "tinyorm_sqlite_tests-tst_DatabaseMannager-"
+                "readWrite_InvalidReadStrategy");
+
+    // Create database connection
+    m_dm->addConnections({
+        {connectionName, {
+            {driver_,        QSQLITE},
+            {database_,      QStringLiteral(":memory:")},
+            {read_,          QVariantHash {{database_, QStringLiteral(":memory:")}}},
+            {read_strategy,  QStringLiteral("fastest")},
+        }},
+    // Don't setup any default connection
+    }, EMPTY);
+
+    // The configuration is parsed lazily
+    QVERIFY_EXCEPTION_THROWN(m_dm->connection(connectionName), InvalidArgumentError);
+
+    // Restore
+    QVERIFY(m_dm->removeConnection(connectionName));
+}
 // NOLINTEND(readability-convert-member-functions-to-static)
 
 /* private */
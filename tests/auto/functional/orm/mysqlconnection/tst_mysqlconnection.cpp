@@ -0,0 +1,495 @@
+#include <QCoreApplication>
+#include <QtTest>
+
+#include "orm/db.hpp"
+#include "orm/exceptions/queryerror.hpp"
+#include "orm/query/querybuilder.hpp"
+#include "orm/utils/type.hpp"
+
+#include "databases.hpp"
+
+using Orm::Constants::ID;
+using Orm::Constants::NAME;
+
+using Orm::DB;
+using Orm::Exceptions::QueryError;
+
+using QueryBuilder = Orm::Query::Builder;
+using TypeUtils = Orm::Utils::Type;
+
+using TestUtils::Databases;
+
+class tst_MySqlConnection : public QObject // clazy:exclude=ctor-missing-parent-argument
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+    void cleanupTestCase() const;
+
+    void init() const;
+
+    /* Multi-statement batches (CLIENT_MULTI_STATEMENTS) */
+    void batch_MultiStatements_SingleQuery() const;
+    void batch_MultiStatements_QuotesAndBackslashes() const;
+    void batch_MultiStatements_Null() const;
+    void batch_MultiStatements_PlaceholderInLiteral() const;
+    void batch_MultiStatements_MultipleResultSets() const;
+    void batch_MultiStatements_RollBackOnError() const;
+
+    /* Bulk load (MYSQL_OPT_LOCAL_INFILE) */
+    void bulkLoad_LocalInfile_SingleQuery() const;
+    void bulkLoad_LocalInfile_Null() const;
+    void bulkLoad_LocalInfile_TabsAndNewlines() const;
+    void bulkLoad_LocalInfile_Binary() const;
+    void bulkLoad_LocalInfile_Dates() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Create QueryBuilder instance for the given connection. */
+    [[nodiscard]] std::shared_ptr<QueryBuilder> createQuery() const;
+
+    /*! Get the names stored in the test table ordered by the ID. */
+    QVector<QVariant> names() const;
+    /*! Get the given column values stored in the bulk load table ordered by the ID. */
+    QVector<QVariant> bulkLoaded(const QString &column) const;
+
+    /*! Connection name used in this test case. */
+    QString m_connection {};
+    /*! Connection with the CLIENT_MULTI_STATEMENTS option. */
+    QString m_multiStatementsConnection {};
+    /*! Connection with the MYSQL_OPT_LOCAL_INFILE option. */
+    QString m_localInfileConnection {};
+    /*! Determines whether the local_infile server variable is enabled. */
+    bool m_localInfileEnabled = false;
+};
+
+/*! Test table name. */
+static const auto BatchTable = QStringLiteral("tst_mysqlconnection_batch");
+/*! Insert query for the test table. */
+static const auto InsertName =
+        QStringLiteral("insert into tst_mysqlconnection_batch (name) values (?)");
+/*! Bulk load test table name. */
+static const auto BulkLoadTable = QStringLiteral("tst_mysqlconnection_bulkload");
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+void tst_MySqlConnection::initTestCase()
+{
+    m_connection = Databases::createConnection(Databases::MYSQL);
+
+    if (m_connection.isEmpty())
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::MYSQL)
+              .toUtf8().constData(), );
+
+    m_multiStatementsConnection =
+            Databases::createConnectionTempFrom(
+                m_connection,
+                QStringLiteral("tinyorm_mysql_tests-tst_MySqlConnection-"
+                               "multi_statements"),
+                {{QStringLiteral("CLIENT_MULTI_STATEMENTS"), QStringLiteral("TRUE")}});
+
+    DB::connection(m_multiStatementsConnection).statement(
+                QStringLiteral("create table if not exists %1 ("
+                               "id bigint unsigned not null auto_increment primary key, "
+                               "name varchar(255) null)")
+                .arg(BatchTable));
+
+    m_localInfileConnection =
+            Databases::createConnectionTempFrom(
+                m_connection,
+                QStringLiteral("tinyorm_mysql_tests-tst_MySqlConnection-"
+                               "local_infile"),
+                {{QStringLiteral("MYSQL_OPT_LOCAL_INFILE"), QStringLiteral("1")}});
+
+    auto &localInfileConnection = DB::connection(m_localInfileConnection);
+
+    localInfileConnection.statement(
+                QStringLiteral("create table if not exists %1 ("
+                               "id bigint unsigned not null auto_increment primary key, "
+                               "name varchar(255) null, "
+                               "note text null, "
+                               "data blob null, "
+                               "added_on date null, "
+                               "created_at datetime null)")
+                .arg(BulkLoadTable));
+
+    // The load data local infile must also be enabled on the server side
+    auto localInfile = localInfileConnection.select(
+                           QStringLiteral("select @@global.local_infile"));
+
+    m_localInfileEnabled = localInfile.first() && localInfile.value(0).toBool();
+}
+
+void tst_MySqlConnection::cleanupTestCase() const
+{
+    // Nothing to clean up, the test was skipped
+    if (m_multiStatementsConnection.isEmpty())
+        return;
+
+    DB::connection(m_multiStatementsConnection).statement(
+                QStringLiteral("drop table if exists %1").arg(BatchTable));
+
+    DB::removeConnection(m_multiStatementsConnection);
+
+    DB::connection(m_localInfileConnection).statement(
+                QStringLiteral("drop table if exists %1").arg(BulkLoadTable));
+
+    DB::removeConnection(m_localInfileConnection);
+}
+
+void tst_MySqlConnection::init() const
+{
+    DB::connection(m_multiStatementsConnection).statement(
+                QStringLiteral("truncate table %1").arg(BatchTable));
+
+    DB::connection(m_localInfileConnection).statement(
+                QStringLiteral("truncate table %1").arg(BulkLoadTable));
+}
+
+/* Multi-statement batches (CLIENT_MULTI_STATEMENTS) */
+
+void tst_MySqlConnection::batch_MultiStatements_SingleQuery() const
+{
+    auto &connection = DB::connection(m_multiStatementsConnection);
+
+    connection.enableQueryLog();
+
+    const auto results = connection.batch({
+        {InsertName, {"batch1"}},
+        {InsertName, {"batch2"}},
+    });
+
+    const auto queryLog = connection.getQueryLog();
+
+    connection.disableQueryLog();
+    connection.flushQueryLog();
+
+    // Both statements were sent to the server in one query
+    const auto inserts = std::ranges::count_if(*queryLog, [](const auto &log)
+    {
+        return log.query.startsWith(QStringLiteral("insert into"));
+    });
+    QCOMPARE(inserts, 1);
+
+    QCOMPARE(results.size(), 2);
+    QCOMPARE(results.at(0).affected, 1);
+    QCOMPARE(results.at(1).affected, 1);
+    QVERIFY(results.at(0).lastInsertId.value<quint64>() <
+            results.at(1).lastInsertId.value<quint64>());
+
+    QCOMPARE(names(), QVector<QVariant>({QString("batch1"), QString("batch2")}));
+}
+
+void tst_MySqlConnection::batch_MultiStatements_QuotesAndBackslashes() const
+{
+    const QVector<QVariant> expected {
+        QStringLiteral("O'Reilly"),
+        QStringLiteral("double \"quotes\""),
+        QStringLiteral("back\\slash\\"),
+        QStringLiteral("\\'; drop table tst_mysqlconnection_batch; -- "),
+        QStringLiteral("back`tick ?"),
+    };
+
+    QVector<Orm::BatchStatement> statements;
+    statements.reserve(expected.size());
+
+    for (const auto &name : expected)
+        statements.append({InsertName, {name}});
+
+    const auto results = DB::connection(m_multiStatementsConnection)
+                         .batch(statements);
+
+    QCOMPARE(results.size(), expected.size());
+    QCOMPARE(names(), expected);
+}
+
+void tst_MySqlConnection::batch_MultiStatements_Null() const
+{
+    DB::connection(m_multiStatementsConnection).batch({
+        {InsertName, {QVariant()}},
+        {InsertName, {"notnull"}},
+    });
+
+    const auto names_ = names();
+
+    QCOMPARE(names_.size(), 2);
+    QVERIFY(names_.at(0).isNull());
+    QCOMPARE(names_.at(1), QVariant(QString("notnull")));
+}
+
+void tst_MySqlConnection::batch_MultiStatements_PlaceholderInLiteral() const
+{
+    // Placeholders in string literals and quoted identifiers are not replaced
+    DB::connection(m_multiStatementsConnection).batch({
+        {QStringLiteral("insert into tst_mysqlconnection_batch (`name`) "
+                        "values (concat('why?', ?))"),
+         {" because"}},
+        {QStringLiteral("insert into tst_mysqlconnection_batch (name) "
+                        "values (concat('it''s \\'?\\'', ?))"),
+         {"!"}},
+    });
+
+    QCOMPARE(names(), QVector<QVariant>({QString("why? because"),
+                                         QString("it's '?'!")}));
+}
+
+void tst_MySqlConnection::batch_MultiStatements_MultipleResultSets() const
+{
+    auto &connection = DB::connection(m_multiStatementsConnection);
+
+    connection.batch({
+        {InsertName, {"first"}},
+        {InsertName, {"second"}},
+    });
+
+    // Every statement has its own result set, also the select in the middle
+    const auto results = connection.batch({
+        {QStringLiteral("update tst_mysqlconnection_batch set name = ? where name = ?"),
+         {"updated", "first"}},
+        {QStringLiteral("select name from tst_mysqlconnection_batch where id > ?"),
+         {0}},
+        {QStringLiteral("update tst_mysqlconnection_batch set name = ? where name = ?"),
+         {"nothing", "doesnt-exist"}},
+        {InsertName, {"third"}},
+    });
+
+    QCOMPARE(results.size(), 4);
+    QCOMPARE(results.at(0).affected, 1);
+    QCOMPARE(results.at(2).affected, 0);
+    QCOMPARE(results.at(3).affected, 1);
+    QVERIFY(results.at(3).lastInsertId.isValid());
+
+    QCOMPARE(names(), QVector<QVariant>({QString("updated"), QString("second"),
+                                         QString("third")}));
+}
+
+void tst_MySqlConnection::batch_MultiStatements_RollBackOnError() const
+{
+    auto &connection = DB::connection(m_multiStatementsConnection);
+
+    // The error in the subsequent statement is reported by the nextResult()
+    QVERIFY_EXCEPTION_THROWN(
+                connection.batch({
+                    {InsertName, {"rolled back"}},
+                    {QStringLiteral("insert into table_not_exists (name) values (?)"),
+                     {"failed"}},
+                }),
+                QueryError);
+
+    QVERIFY(!connection.inTransaction());
+    QVERIFY(names().isEmpty());
+
+    // The connection is usable after the failed multi-statement query
+    connection.batch({
+        {InsertName, {"after1"}},
+        {InsertName, {"after2"}},
+    });
+
+    QCOMPARE(names(), QVector<QVariant>({QString("after1"), QString("after2")}));
+}
+
+/* Bulk load (MYSQL_OPT_LOCAL_INFILE) */
+
+void tst_MySqlConnection::bulkLoad_LocalInfile_SingleQuery() const
+{
+    if (!m_localInfileEnabled)
+        QSKIP("The local_infile server variable is disabled.", );
+
+    auto &connection = DB::connection(m_localInfileConnection);
+
+    connection.enableQueryLog();
+
+    const auto loaded = connection.table(BulkLoadTable)->bulkLoad(
+                            {NAME, "note"},
+                            QVector<QVector<QVariant>> {{"load1", "note1"},
+                                                        {"load2", "note2"},
+                                                        {"load3", "note3"}});
+
+    const auto queryLog = connection.getQueryLog();
+
+    connection.disableQueryLog();
+    connection.flushQueryLog();
+
+    // All rows were loaded by one load data statement
+    const auto loadQueries = std::ranges::count_if(*queryLog, [](const auto &log)
+    {
+        return log.query.startsWith(QStringLiteral("load data local infile"));
+    });
+    QCOMPARE(loadQueries, 1);
+
+    QCOMPARE(loaded, static_cast<quint64>(3));
+    QCOMPARE(bulkLoaded(NAME), QVector<QVariant>({QString("load1"), QString("load2"),
+                                                  QString("load3")}));
+    QCOMPARE(bulkLoaded("note"), QVector<QVariant>({QString("note1"),
+                                                    QString("note2"),
+                                                    QString("note3")}));
+}
+
+void tst_MySqlConnection::bulkLoad_LocalInfile_Null() const
+{
+    if (!m_localInfileEnabled)
+        QSKIP("The local_infile server variable is disabled.", );
+
+    // The NULL is written as the \N and the string "\N" must stay a string
+    DB::connection(m_localInfileConnection).table(BulkLoadTable)->bulkLoad(
+                {NAME, "note"},
+                QVector<QVector<QVariant>> {{QVariant(), "null"},
+                                            {QStringLiteral("\\N"), QVariant()},
+                                            {QString(""), QString("NULL")}});
+
+    const auto names_ = bulkLoaded(NAME);
+    const auto notes = bulkLoaded("note");
+
+    QCOMPARE(names_.size(), 3);
+    QVERIFY(names_.at(0).isNull());
+    QCOMPARE(names_.at(1), QVariant(QStringLiteral("\\N")));
+    QVERIFY(!names_.at(2).isNull());
+    QCOMPARE(names_.at(2), QVariant(QString("")));
+
+    QCOMPARE(notes.at(0), QVariant(QString("null")));
+    QVERIFY(notes.at(1).isNull());
+    QCOMPARE(notes.at(2), QVariant(QString("NULL")));
+}
+
+void tst_MySqlConnection::bulkLoad_LocalInfile_TabsAndNewlines() const
+{
+    if (!m_localInfileEnabled)
+        QSKIP("The local_infile server variable is disabled.", );
+
+    const QVector<QVariant> expected {
+        QStringLiteral("tab\there"),
+        QStringLiteral("new\nline\r\n"),
+        QStringLiteral("back\\slash\\"),
+        QStringLiteral("\t\n\\N"),
+        QStringLiteral("O'Reilly \"quoted\"; -- comment"),
+    };
+
+    QVector<QVector<QVariant>> rows;
+    rows.reserve(expected.size());
+
+    for (const auto &name : expected)
+        rows.append({name, name});
+
+    const auto loaded = DB::connection(m_localInfileConnection).table(BulkLoadTable)
+                        ->bulkLoad({NAME, "note"}, rows);
+
+    QCOMPARE(loaded, static_cast<quint64>(expected.size()));
+    QCOMPARE(bulkLoaded(NAME), expected);
+    QCOMPARE(bulkLoaded("note"), expected);
+}
+
+void tst_MySqlConnection::bulkLoad_LocalInfile_Binary() const
+{
+    if (!m_localInfileEnabled)
+        QSKIP("The local_infile server variable is disabled.", );
+
+    QByteArray allBytes;
+    allBytes.reserve(256);
+
+    for (auto byte = 0; byte < 256; ++byte)
+        allBytes.append(static_cast<char>(byte));
+
+    const QVector<QByteArray> expected {
+        allBytes,
+        QByteArray("\0\t\n\r\\N", 6),
+        QByteArray("\x00\x00", 2),
+    };
+
+    QVector<QVector<QVariant>> rows;
+    rows.reserve(expected.size());
+
+    for (const auto &data : expected)
+        rows.append({data});
+
+    DB::connection(m_localInfileConnection).table(BulkLoadTable)
+            ->bulkLoad({"data"}, rows);
+
+    const auto loaded = bulkLoaded("data");
+
+    QCOMPARE(loaded.size(), expected.size());
+    for (QVector<QVariant>::size_type index = 0; index < expected.size(); ++index)
+        QCOMPARE(loaded.at(index).value<QByteArray>(), expected.at(index));
+}
+
+void tst_MySqlConnection::bulkLoad_LocalInfile_Dates() const
+{
+    if (!m_localInfileEnabled)
+        QSKIP("The local_infile server variable is disabled.", );
+
+    auto &connection = DB::connection(m_localInfileConnection);
+
+    connection.table(BulkLoadTable)->bulkLoad(
+                {"added_on", "created_at"},
+                QVector<QVector<QVariant>> {
+                    {QDate(2022, 8, 29),
+                     QDateTime({2022, 8, 29}, {13, 14, 15}, Qt::UTC)},
+                    {QDate(1999, 12, 31),
+                     QDateTime({2000, 1, 1}, {0, 0, 1}, Qt::UTC)},
+                    {QVariant(), QVariant()},
+                });
+
+    // Compare the stored values, the QDateTime returned by the driver is the local time
+    auto query = connection.select(
+                     QStringLiteral("select cast(added_on as char), "
+                                    "cast(created_at as char) "
+                                    "from %1 order by id")
+                     .arg(BulkLoadTable));
+
+    QVector<QVariant> addedOn;
+    QVector<QVariant> createdAt;
+
+    while (query.next()) {
+        addedOn << query.value(0);
+        createdAt << query.value(1);
+    }
+
+    QCOMPARE(addedOn.size(), 3);
+    QCOMPARE(addedOn.at(0), QVariant(QString("2022-08-29")));
+    QCOMPARE(addedOn.at(1), QVariant(QString("1999-12-31")));
+    QVERIFY(addedOn.at(2).isNull());
+
+    QCOMPARE(createdAt.at(0), QVariant(QString("2022-08-29 13:14:15")));
+    QCOMPARE(createdAt.at(1), QVariant(QString("2000-01-01 00:00:01")));
+    QVERIFY(createdAt.at(2).isNull());
+}
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+/* private */
+
+std::shared_ptr<QueryBuilder>
+tst_MySqlConnection::createQuery() const
+{
+    return DB::connection(m_multiStatementsConnection).query();
+}
+
+QVector<QVariant> tst_MySqlConnection::names() const
+{
+    auto query = createQuery()->from(BatchTable).orderBy(ID).get({NAME});
+
+    QVector<QVariant> names_;
+    names_.reserve(query.size());
+
+    while (query.next())
+        names_ << query.value(NAME);
+
+    return names_;
+}
+
+QVector<QVariant> tst_MySqlConnection::bulkLoaded(const QString &column) const
+{
+    auto query = DB::connection(m_localInfileConnection).table(BulkLoadTable)
+                 ->orderBy(ID).get({column});
+
+    QVector<QVariant> values;
+    values.reserve(query.size());
+
+    while (query.next())
+        values << query.value(column);
+
+    return values;
+}
+
+QTEST_MAIN(tst_MySqlConnection)
+
+#include "tst_mysqlconnection.moc"
@@ -2,6 +2,7 @@ TEMPLATE = subdirs
 
 subdirsList = \
     databasemanager \
+    mysqlconnection \
     query \
 
 !disable_orm: \
@@ -53,6 +53,9 @@ private Q_SLOTS:
 
     void first() const;
 
+    void cursor() const;
+    void cursor_EmptyResult() const;
+
     void pluck() const;
     void pluck_EmptyResult() const;
     void pluck_QualifiedColumnOrKey() const;
@@ -110,6 +113,7 @@ private Q_SLOTS:
     void doesntExistOr_WithReturnType() const;
 
     void limit() const;
+    void limit_QueryResultSizeHint() const;
 
     /* Builds Queries */
     void sole() const;
@@ -288,6 +292,41 @@ void tst_QueryBuilder::first() const
     QCOMPARE(query.value(NAME), QVariant("test2"));
 }
 
+void tst_QueryBuilder::cursor() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto builder = createQuery(connection);
+
+    auto cursor = builder->from("torrents").where(ID, LT, 4).orderBy(ID).cursor();
+
+    QVERIFY(cursor.query().isForwardOnly());
+
+    QVector<QVariant> ids;
+    QVector<QVariant> names;
+    for (auto &row : cursor) {
+        ids << row.value(ID);
+        names << row.value(NAME);
+    }
+
+    QCOMPARE(ids, QVector<QVariant>({1, 2, 3}));
+    QCOMPARE(names, QVector<QVariant>({"test1", "test2", "test3"}));
+
+    // The cursor is the input range, it can be iterated only once
+    QVERIFY(cursor.begin() == cursor.end());
+}
+
+void tst_QueryBuilder::cursor_EmptyResult() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto builder = createQuery(connection);
+
+    auto cursor = builder->from("torrents").whereEq(ID, 999999).cursor();
+
+    QVERIFY(cursor.begin() == cursor.end());
+}
+
 void tst_QueryBuilder::pluck() const
 {
     QFETCH_GLOBAL(QString, connection);
@@ -1566,6 +1605,30 @@ void tst_QueryBuilder::limit() const
     }
 }
 
+void tst_QueryBuilder::limit_QueryResultSizeHint() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    // Number of the seeded rows in the limited result
+    const auto resultSize = std::min(
+                                static_cast<int>(
+                                    createQuery(connection)->from("torrents").count()),
+                                10);
+
+    auto query = createQuery(connection)->from("torrents").limit(10).get({ID});
+
+    // The SQLite driver can't report the result size, the LIMIT is used instead
+    const auto hasQuerySize = query.driver()->hasFeature(QSqlDriver::QuerySize);
+
+    QCOMPARE(QueryUtils::queryResultSizeHint(query, 10),
+             hasQuerySize ? resultSize : 10);
+    QCOMPARE(QueryUtils::queryResultSizeHint(query, 1'000'000),
+             hasQuerySize ? resultSize : 10000);
+
+    // The result set wasn't walked
+    QVERIFY(query.at() == QSql::BeforeFirstRow);
+}
+
 /* Builds Queries */
 
 void tst_QueryBuilder::sole() const
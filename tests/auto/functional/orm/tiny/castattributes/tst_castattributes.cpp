@@ -107,8 +107,10 @@ private Q_SLOTS:
     void mergeCasts_const_lvalue() const;
     void mergeCasts_lvalue() const;
     void mergeCasts_rvalue() const;
+    void mergeCasts_NewInstance_CopyOnWrite() const;
 
     void withCasts_OnTinyBuilder() const;
+    void withCasts_OnTinyBuilder_MergeCastsAfterHydration() const;
     void withCasts_OnModel() const;
     /* The withCasts_OnRelation() test moved to the tst_Model_Relations to avoid
        increasing compilation times, after #include "models/torrent.hpp" added and
@@ -428,6 +430,31 @@ void tst_CastAttributes::mergeCasts_rvalue() const
     QVERIFY(toMerge.empty()); // NOLINT(bugprone-use-after-move)
 }
 
+void tst_CastAttributes::mergeCasts_NewInstance_CopyOnWrite() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto type = Type::instance();
+    type.setConnection(connection);
+
+    type.mergeCasts({{"decimal", CastType::Decimal}});
+
+    // Merged casts are shared with new instances
+    auto newType = type.newInstance();
+    QVERIFY(newType.hasCast("decimal"));
+
+    // Merging on the new instance doesn't affect the original instance
+    newType.mergeCasts({{"binary", CastType::QDateTime}});
+
+    QVERIFY(newType.hasCast("binary"));
+    QVERIFY(newType.hasCast("decimal"));
+    QVERIFY(!type.hasCast("binary"));
+    QVERIFY(type.hasCast("decimal"));
+
+    // The model type casts are untouched
+    QVERIFY(!Type::instance().hasCast("decimal"));
+}
+
 void tst_CastAttributes::withCasts_OnTinyBuilder() const
 {
     QFETCH_GLOBAL(QString, connection);
@@ -456,6 +483,34 @@ void tst_CastAttributes::withCasts_OnTinyBuilder() const
     QCOMPARE(attribute.value<uint>(), 32760);
 }
 
+void tst_CastAttributes::withCasts_OnTinyBuilder_MergeCastsAfterHydration() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto type = Type::on(connection)->withCasts({{"smallint", CastType::UInteger}})
+                .find(1);
+
+    QVERIFY(type);
+    QVERIFY(type->exists);
+
+    // Casts resolved during the hydration
+    QCOMPARE(Helpers::qVariantTypeId(type->getAttribute("smallint")), QMetaType::UInt);
+
+    // Setting an existing attribute keeps the resolved casts
+    type->setAttribute("smallint", 10);
+
+    auto attribute = type->getAttribute("smallint");
+    QCOMPARE(Helpers::qVariantTypeId(attribute), QMetaType::UInt);
+    QCOMPARE(attribute.value<uint>(), 10);
+
+    // Merged casts have priority over the casts resolved during the hydration
+    type->mergeCasts({{"smallint", CastType::LongLong}});
+
+    attribute = type->getAttribute("smallint");
+    QCOMPARE(Helpers::qVariantTypeId(attribute), QMetaType::LongLong);
+    QCOMPARE(attribute.value<qint64>(), 10);
+}
+
 void tst_CastAttributes::withCasts_OnModel() const
 {
     QFETCH_GLOBAL(QString, connection);
@@ -63,6 +63,7 @@ private Q_SLOTS:
 
     void all() const;
     void all_Columns() const;
+    void all_SharedAttributesHash() const;
 
     void latest() const;
     void oldest() const;
@@ -526,6 +527,38 @@ void tst_Model::all_Columns() const
     }
 }
 
+void tst_Model::all_SharedAttributesHash() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    ConnectionOverride::connection = connection;
+
+    auto torrents = Torrent::all({ID, NAME});
+
+    QVERIFY(torrents.size() > 1);
+
+    auto &torrent1 = torrents[0];
+    const auto &torrent2 = torrents.at(1);
+
+    // Models hydrated from the same result set share the attributes hash
+    QCOMPARE(std::addressof(torrent1.getAttributesHash()),
+             std::addressof(torrent2.getAttributesHash()));
+    QCOMPARE(torrent1.getAttributesHash().size(), static_cast<std::size_t>(2));
+    QCOMPARE(torrent1.getAttributesHash().at(ID), 0);
+    QCOMPARE(torrent1.getAttributesHash().at(NAME), 1);
+
+    // The modified model detaches, the other model is untouched
+    torrent1.setAttribute(SIZE, 100);
+
+    QVERIFY(std::addressof(torrent1.getAttributesHash()) !=
+            std::addressof(torrent2.getAttributesHash()));
+    QCOMPARE(torrent1.getAttributesHash().size(), static_cast<std::size_t>(3));
+    QCOMPARE(torrent2.getAttributesHash().size(), static_cast<std::size_t>(2));
+    QVERIFY(!torrent2.getAttributesHash().contains(SIZE));
+    QVERIFY(torrent1.isDirty(SIZE));
+    QVERIFY(!torrent2.isDirty());
+}
+
 void tst_Model::latest() const
 {
     QFETCH_GLOBAL(QString, connection);
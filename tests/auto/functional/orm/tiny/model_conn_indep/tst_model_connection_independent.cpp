@@ -81,6 +81,7 @@ private Q_SLOTS:
     void subscriptOperator_OnLhs_AssignAttributeReference() const;
 
     void isCleanAndIsDirty() const;
+    void isDirty_SameValue_UnsetAttribute() const;
 
     /* Models comparison */
     void is() const;
@@ -705,6 +706,29 @@ void tst_Model_Connection_Independent::isCleanAndIsDirty() const
     torrent->save();
 }
 
+void tst_Model_Connection_Independent::isDirty_SameValue_UnsetAttribute() const
+{
+    auto torrent = Torrent::find(3);
+    QVERIFY(torrent);
+
+    // Setting the original value doesn't make the attribute dirty
+    torrent->setAttribute(NAME, torrent->getAttribute(NAME));
+
+    QVERIFY(torrent->isClean(NAME));
+    QVERIFY(torrent->getDirty().isEmpty());
+
+    // Unsetting an attribute shifts positions of all following attributes
+    torrent->setAttribute(SIZE, torrent->getAttribute(SIZE).value<qint64>() + 1);
+    torrent->unsetAttribute(ID);
+
+    QVERIFY(torrent->isDirty(SIZE));
+    QVERIFY(torrent->isClean(NAME));
+
+    const auto dirty = torrent->getDirty();
+    QCOMPARE(dirty.size(), static_cast<decltype (dirty)::size_type>(1));
+    QCOMPARE(dirty.constFirst().key, QString(SIZE));
+}
+
 /* Models comparison */
 
 void tst_Model_Connection_Independent::is() const
@@ -19,14 +19,17 @@
 using Orm::Constants::AND;
 using Orm::Constants::ASTERISK;
 using Orm::Constants::CREATED_AT;
+using Orm::Constants::DESC;
 using Orm::Constants::ID;
 using Orm::Constants::NAME;
 using Orm::Constants::LIKE;
 using Orm::Constants::QMYSQL;
+using Orm::Constants::QSQLITE;
 using Orm::Constants::SIZE;
 using Orm::Constants::UPDATED_AT;
 
 using Orm::DB;
+using Orm::Exceptions::LogicError;
 using Orm::Exceptions::RuntimeError;
 using Orm::One;
 using Orm::QtTimeZoneConfig;
@@ -102,6 +105,11 @@ private Q_SLOTS:
     void with_WithLambdaConstraint() const;
     void with_WithLambdaConstraint_BelongsToMany() const;
 
+    void with_EagerKeysChunks_HasMany() const;
+    void with_EagerKeysChunks_WithLimit_NotSplit() const;
+    void with_EagerKeysChunks_WithOrWhere_NotSplit() const;
+    void with_EagerKeysChunks_WithOrWhereNot_NotSplit() const;
+
     void without() const;
     void without_NestedRelations() const;
     void without_Vector_MoreRelations() const;
@@ -238,6 +246,14 @@ private Q_SLOTS:
     /* QtTimeZoneType::DontConvert */
     /* Server timezone UTC */
     void timezone_TimestampAttribute_UtcOnServer_DontConvert_OnCustomPivot_MtM() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Get all torrents followed by torrents that don't exist in the database, their
+        eager load keys exceed the SQLite bindings limit. */
+    static QVector<Torrent> torrentsExceedingBindingsLimit();
+    /*! Get the number of logged queries that select the torrent files. */
+    static qint64 torrentFilesQueriesCount(const QString &connection);
 };
 
 /* private slots */
@@ -1165,6 +1181,177 @@ void tst_Model_Relations::with_WithLambdaConstraint_BelongsToMany() const
     }
 }
 
+void tst_Model_Relations::with_EagerKeysChunks_HasMany() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    ConnectionOverride::connection = connection;
+
+    const auto constraint = [](auto &query)
+    {
+        query.orderBy(ID, DESC);
+    };
+
+    // Expected file IDs, eager loaded using a single query
+    std::unordered_map<quint64, QVector<QVariant>> expectedFileIds;
+
+    for (auto &torrent : Torrent::with({{"torrentFiles", constraint}})->get()) {
+        auto &fileIds = expectedFileIds[torrent.getKey().value<quint64>()];
+
+        for (auto *const file :
+             torrent.getRelation<TorrentPreviewableFile>("torrentFiles")
+        )
+            fileIds << file->getKey();
+    }
+
+    auto torrents = torrentsExceedingBindingsLimit();
+
+    DB::connection(connection).enableQueryLog();
+
+    Torrent::with({{"torrentFiles", constraint}})->eagerLoadRelations(torrents);
+
+    // The SQLite bindings limit is 999, 2406 eager load keys need 3 queries
+    const auto queriesCount = torrentFilesQueriesCount(connection);
+
+    DB::connection(connection).disableQueryLog();
+    DB::connection(connection).flushQueryLog();
+
+    QCOMPARE(queriesCount, DB::driverName(connection) == QSQLITE ? 3 : 1);
+
+    // Chunks were merged and the order of the torrent files was preserved
+    for (auto &torrent : torrents) {
+        const auto files = torrent.getRelation<TorrentPreviewableFile>("torrentFiles");
+
+        QVector<QVariant> fileIds;
+        fileIds.reserve(files.size());
+
+        for (auto *const file : files)
+            fileIds << file->getKey();
+
+        const auto itExpected =
+                expectedFileIds.find(torrent.getKey().value<quint64>());
+
+        // Non-existent torrent
+        if (itExpected == expectedFileIds.end())
+            QVERIFY(fileIds.isEmpty());
+        else
+            QCOMPARE(fileIds, itExpected->second);
+    }
+}
+
+void tst_Model_Relations::with_EagerKeysChunks_WithLimit_NotSplit() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    ConnectionOverride::connection = connection;
+
+    auto torrents = torrentsExceedingBindingsLimit();
+
+    // The limit would be applied to every chunk, so all the keys are sent at once
+    const auto constraint = [](auto &query)
+    {
+        query.orderBy(ID).limit(3);
+    };
+
+    // All the keys exceed the SQLite bindings limit
+    if (DB::driverName(connection) == QSQLITE) {
+        QVERIFY_EXCEPTION_THROWN(
+                    Torrent::with({{"torrentFiles", constraint}})
+                        ->eagerLoadRelations(torrents),
+                    LogicError);
+        return;
+    }
+
+    DB::connection(connection).enableQueryLog();
+
+    Torrent::with({{"torrentFiles", constraint}})->eagerLoadRelations(torrents);
+
+    const auto queriesCount = torrentFilesQueriesCount(connection);
+
+    DB::connection(connection).disableQueryLog();
+    DB::connection(connection).flushQueryLog();
+
+    QCOMPARE(queriesCount, 1);
+
+    quint64 filesCount = 0;
+    for (auto &torrent : torrents)
+        filesCount += static_cast<quint64>(
+                          torrent.getRelation<TorrentPreviewableFile>("torrentFiles")
+                          .size());
+
+    QCOMPARE(filesCount, static_cast<quint64>(3));
+}
+
+void tst_Model_Relations::with_EagerKeysChunks_WithOrWhere_NotSplit() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    ConnectionOverride::connection = connection;
+
+    auto torrents = torrentsExceedingBindingsLimit();
+
+    /* The top-level "or where" clause would select the same torrent file for every
+       chunk, so all the keys are sent at once. */
+    const auto constraint = [](auto &query)
+    {
+        query.orWhere(ID, 1);
+    };
+
+    // All the keys exceed the SQLite bindings limit
+    if (DB::driverName(connection) == QSQLITE) {
+        QVERIFY_EXCEPTION_THROWN(
+                    Torrent::with({{"torrentFiles", constraint}})
+                        ->eagerLoadRelations(torrents),
+                    LogicError);
+        return;
+    }
+
+    DB::connection(connection).enableQueryLog();
+
+    Torrent::with({{"torrentFiles", constraint}})->eagerLoadRelations(torrents);
+
+    const auto queriesCount = torrentFilesQueriesCount(connection);
+
+    DB::connection(connection).disableQueryLog();
+    DB::connection(connection).flushQueryLog();
+
+    QCOMPARE(queriesCount, 1);
+
+    // The torrent file with the ID 1 was loaded only once
+    auto firstFileCount = 0;
+    for (auto &torrent : torrents)
+        for (auto *const file :
+             torrent.getRelation<TorrentPreviewableFile>("torrentFiles")
+        )
+            if (file->getKey().value<quint64>() == 1)
+                ++firstFileCount;
+
+    QCOMPARE(firstFileCount, 1);
+}
+
+void tst_Model_Relations::with_EagerKeysChunks_WithOrWhereNot_NotSplit() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    // Only the SQLite splits the eager load keys
+    if (DB::driverName(connection) != QSQLITE)
+        QSKIP("The eager load keys are split into chunks only for the SQLite "
+              "connection.", );
+
+    ConnectionOverride::connection = connection;
+
+    auto torrents = torrentsExceedingBindingsLimit();
+
+    /* The top-level "or not" clause is also the "or where" clause, the keys can't be
+       split and all the keys exceed the bindings limit. */
+    QVERIFY_EXCEPTION_THROWN(
+                Torrent::with({{"torrentFiles", [](auto &query)
+                                {
+                                    query.orWhereNotEq(ID, 1);
+                                }}})->eagerLoadRelations(torrents),
+                LogicError);
+}
+
 void tst_Model_Relations::without() const
 {
     QFETCH_GLOBAL(QString, connection);
@@ -4113,6 +4300,39 @@ timezone_TimestampAttribute_UtcOnServer_DontConvert_OnCustomPivot_MtM() const
 }
 // NOLINTEND(readability-convert-member-functions-to-static)
 
+/* private */
+
+QVector<Torrent> tst_Model_Relations::torrentsExceedingBindingsLimit()
+{
+    // Torrents that don't exist in the database
+    constexpr static quint64 NonExistentTorrents = 2400;
+    constexpr static quint64 NonExistentFirstId = 100001;
+
+    auto torrents = Torrent::orderBy(ID)->get();
+    torrents.reserve(torrents.size() + static_cast<int>(NonExistentTorrents));
+
+    for (auto id = NonExistentFirstId; id < NonExistentFirstId + NonExistentTorrents;
+         ++id
+    ) {
+        Torrent torrent;
+        torrent.setAttribute(ID, id);
+
+        torrents << std::move(torrent);
+    }
+
+    return torrents;
+}
+
+qint64 tst_Model_Relations::torrentFilesQueriesCount(const QString &connection)
+{
+    const auto queryLog = DB::connection(connection).getQueryLog();
+
+    return std::ranges::count_if(*queryLog, [](const auto &log)
+    {
+        return log.query.contains(QStringLiteral("torrent_previewable_files"));
+    });
+}
+
 QTEST_MAIN(tst_Model_Relations)
 
 #include "tst_model_relations.moc"
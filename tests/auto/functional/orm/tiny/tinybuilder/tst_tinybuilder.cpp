@@ -1,6 +1,9 @@
 #include <QCoreApplication>
 #include <QtTest>
 
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/view/transform.hpp>
+
 #include "orm/db.hpp"
 
 #include "databases.hpp"
@@ -8,9 +11,11 @@
 #include "models/torrent.hpp"
 
 using Orm::Constants::ID;
+using Orm::Constants::LT;
 using Orm::Constants::NAME;
 using Orm::Constants::SIZE;
 
+using Orm::Exceptions::LogicError;
 using Orm::Exceptions::QueryError;
 using Orm::Tiny::ConnectionOverride;
 using Orm::Tiny::Exceptions::ModelNotFoundError;
@@ -33,6 +38,13 @@ private Q_SLOTS:
     void get() const;
     void get_Columns() const;
 
+    void cursor() const;
+    void cursor_Columns() const;
+    void cursor_RangeV3() const;
+
+    void getAsync() const;
+    void getAsync_EagerLoading() const;
+
     void value() const;
     void value_ModelNotFound() const;
 
@@ -109,6 +121,93 @@ void tst_TinyBuilder::get_Columns() const
     QCOMPARE(torrent.getAttributes().at(2).key, QString(SIZE));
 }
 
+void tst_TinyBuilder::cursor() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    ConnectionOverride::connection = connection;
+
+    auto cursor = createQuery<Torrent>()->orderBy(ID).cursor();
+
+    QVector<quint64> ids;
+    for (const auto &torrent : cursor) {
+        QVERIFY(torrent.exists);
+        QCOMPARE(torrent[NAME].value<QString>(),
+                 QStringLiteral("test%1").arg(torrent[ID].value<quint64>()));
+
+        ids << torrent[ID].value<quint64>();
+    }
+
+    QCOMPARE(ids, QVector<quint64>({1, 2, 3, 4, 5, 6}));
+}
+
+void tst_TinyBuilder::cursor_Columns() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    ConnectionOverride::connection = connection;
+
+    auto cursor = Torrent::whereEq(ID, 2)->cursor({ID, NAME});
+
+    auto it = cursor.begin();
+    QVERIFY(it != cursor.end());
+
+    const auto &attributes = it->getAttributes();
+    QCOMPARE(attributes.size(), 2);
+    QCOMPARE(attributes.at(0).key, QString(ID));
+    QCOMPARE(attributes.at(1).key, QString(NAME));
+
+    QVERIFY(++it == cursor.end());
+}
+
+void tst_TinyBuilder::cursor_RangeV3() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    ConnectionOverride::connection = connection;
+
+    auto cursor = Torrent::where(ID, LT, 4)->orderBy(ID).cursor();
+
+    const auto names = cursor
+                       | ranges::views::transform([](const Torrent &torrent)
+    {
+        return torrent[NAME].value<QString>();
+    })
+                       | ranges::to<QVector<QString>>();
+
+    QCOMPARE(names, QVector<QString>({"test1", "test2", "test3"}));
+}
+
+void tst_TinyBuilder::getAsync() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    ConnectionOverride::connection = connection;
+
+    auto future = Torrent::where(ID, LT, 4)->orderBy(ID).getAsync({ID, NAME});
+
+    const auto torrents = future.result();
+
+    QCOMPARE(torrents.size(), 3);
+
+    for (const auto &torrent : torrents) {
+        QVERIFY(torrent.exists);
+        QCOMPARE(torrent.getAttributes().size(), 2);
+        QCOMPARE(torrent[NAME].value<QString>(),
+                 QStringLiteral("test%1").arg(torrent[ID].value<quint64>()));
+    }
+}
+
+void tst_TinyBuilder::getAsync_EagerLoading() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    ConnectionOverride::connection = connection;
+
+    QVERIFY_EXCEPTION_THROWN(createQuery<Torrent>()->with("torrentFiles").getAsync(),
+                             LogicError);
+}
+
 void tst_TinyBuilder::value() const
 {
     QFETCH_GLOBAL(QString, connection);
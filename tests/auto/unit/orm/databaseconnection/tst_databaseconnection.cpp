@@ -3,9 +3,12 @@
 #include <QtTest>
 
 #include "orm/db.hpp"
+#include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/exceptions/logicerror.hpp"
 #include "orm/exceptions/multiplecolumnsselectederror.hpp"
 #include "orm/mysqlconnection.hpp"
 #include "orm/query/querybuilder.hpp"
+#include "orm/support/querylogsink.hpp"
 #include "orm/utils/type.hpp"
 
 #include "databases.hpp"
@@ -21,10 +24,16 @@ using Orm::Constants::qt_timezone;
 using Orm::Constants::timezone_;
 
 using Orm::DB;
+using Orm::Exceptions::InvalidArgumentError;
+using Orm::Exceptions::LogicError;
 using Orm::Exceptions::MultipleColumnsSelectedError;
+using Orm::Exceptions::QueryError;
 using Orm::MySqlConnection;
 using Orm::QtTimeZoneConfig;
 using Orm::QtTimeZoneType;
+using Orm::QueryStatistics;
+using Orm::QueryStatisticsSort;
+using Orm::Support::QueryLogSink;
 
 using QueryBuilder = Orm::Query::Builder;
 using TypeUtils = Orm::Utils::Type;
@@ -59,6 +68,41 @@ private Q_SLOTS:
     void scalar_EmptyResult() const;
     void scalar_MultipleColumnsSelectedError() const;
 
+    void statementsCache_HitsAndMisses() const;
+    void statementsCache_LeastRecentlyUsedEviction() const;
+    void statementsCache_LiveResultsAreNotShared() const;
+    void statementsCache_AffectingStatement() const;
+
+    void latencyHistograms() const;
+
+    void queryStatistics() const;
+    void queryStatistics_Fingerprint() const;
+    void queryStatistics_MaxSize() const;
+
+    void queryLog_RingBuffer() const;
+    void queryLog_Sink() const;
+
+    void batch() const;
+    void batch_RollBackOnError() const;
+
+    void insertBatch() const;
+    void updateBatch() const;
+    void updateBatch_WithExpressionBinding() const;
+    void execBatch_ValuesMismatch() const;
+
+    void bulkLoad() const;
+    void bulkLoad_Range() const;
+    void bulkLoad_RollBackOnError() const;
+    void bulkLoad_WithoutTable_Throws() const;
+
+    void selectAsync() const;
+    void selectAsync_QueryError() const;
+    void selectAsync_InTransaction_Throws() const;
+    void statementAsync() const;
+    void statementAsync_InTransaction_Throws() const;
+    void getAsync() const;
+    void getAsync_InTransaction_Throws() const;
+
 // NOLINTNEXTLINE(readability-redundant-access-specifiers)
 private:
     /*! Create QueryBuilder instance for the given connection. */
@@ -862,6 +906,825 @@ void tst_DatabaseConnection::scalar_MultipleColumnsSelectedError() const
                                  "select id, name from torrents order by id"),
                              MultipleColumnsSelectedError);
 }
+
+void tst_DatabaseConnection::statementsCache_HitsAndMisses() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto &connection_ = DB::connection(connection);
+
+    connection_.setStatementsCacheSize(2).resetStatementsCacheCounter();
+
+    const auto queryString = QStringLiteral("select name from torrents where id = ?");
+
+    // Cache miss, prepare the query
+    QCOMPARE(connection_.scalar(queryString, {1}), QVariant(QString("test1")));
+    // Cache hit, re-use the prepared query with another binding
+    QCOMPARE(connection_.scalar(queryString, {2}), QVariant(QString("test2")));
+
+    {
+        const auto &counter = connection_.getStatementsCacheCounter();
+        QCOMPARE(counter.hits, static_cast<qint64>(1));
+        QCOMPARE(counter.misses, static_cast<qint64>(1));
+        QCOMPARE(connection_.statementsCacheCount(), static_cast<std::size_t>(1));
+    }
+
+    // Flushed cache has to prepare the query again
+    connection_.flushStatementsCache();
+    QCOMPARE(connection_.statementsCacheCount(), static_cast<std::size_t>(0));
+
+    QCOMPARE(connection_.scalar(queryString, {3}), QVariant(QString("test3")));
+
+    {
+        const auto counter = connection_.takeStatementsCacheCounter();
+        QCOMPARE(counter.hits, static_cast<qint64>(1));
+        QCOMPARE(counter.misses, static_cast<qint64>(2));
+    }
+
+    // Restore
+    connection_.setStatementsCacheSize(0).resetStatementsCacheCounter();
+    QCOMPARE(connection_.statementsCacheCount(), static_cast<std::size_t>(0));
+}
+
+void tst_DatabaseConnection::statementsCache_LeastRecentlyUsedEviction() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto &connection_ = DB::connection(connection);
+
+    connection_.setStatementsCacheSize(2).resetStatementsCacheCounter();
+
+    const auto queryString1 = QStringLiteral("select name from torrents where id = ?");
+    const auto queryString2 = QStringLiteral("select size from torrents where id = ?");
+    const auto queryString3 = QStringLiteral("select note from torrents where id = ?");
+
+    connection_.scalar(queryString1, {1}); // miss
+    connection_.scalar(queryString2, {1}); // miss
+    connection_.scalar(queryString1, {2}); // hit, queryString2 is the LRU now
+    connection_.scalar(queryString3, {1}); // miss, evicts the queryString2
+    QCOMPARE(connection_.statementsCacheCount(), static_cast<std::size_t>(2));
+
+    connection_.scalar(queryString1, {3}); // hit
+    connection_.scalar(queryString2, {2}); // miss, was evicted
+
+    const auto &counter = connection_.getStatementsCacheCounter();
+    QCOMPARE(counter.hits, static_cast<qint64>(2));
+    QCOMPARE(counter.misses, static_cast<qint64>(4));
+
+    // Restore
+    connection_.setStatementsCacheSize(0).resetStatementsCacheCounter();
+}
+
+void tst_DatabaseConnection::statementsCache_LiveResultsAreNotShared() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto &connection_ = DB::connection(connection);
+
+    connection_.setStatementsCacheSize(2).resetStatementsCacheCounter();
+
+    const auto queryString = QStringLiteral("select name from torrents where id = ?");
+
+    {
+        auto query1 = connection_.select(queryString, {1});
+        // The query1 is checked out, the same query has to be prepared again
+        auto query2 = connection_.select(queryString, {2});
+
+        QVERIFY(query1.first());
+        QCOMPARE(query1.value(0), QVariant(QString("test1")));
+        QVERIFY(query2.first());
+        QCOMPARE(query2.value(0), QVariant(QString("test2")));
+
+        QCOMPARE(connection_.statementsCacheCount(), static_cast<std::size_t>(0));
+
+        // Check in both queries, the second one replaces the first one
+        query1.releaseStatement();
+        query2.releaseStatement();
+
+        // The released query is empty
+        QVERIFY(!query1.isActive());
+    }
+
+    QCOMPARE(connection_.statementsCacheCount(), static_cast<std::size_t>(1));
+
+    QCOMPARE(connection_.scalar(queryString, {3}), QVariant(QString("test3")));
+
+    const auto &counter = connection_.getStatementsCacheCounter();
+    QCOMPARE(counter.hits, static_cast<qint64>(1));
+    QCOMPARE(counter.misses, static_cast<qint64>(2));
+
+    // Restore
+    connection_.setStatementsCacheSize(0).resetStatementsCacheCounter();
+}
+
+void tst_DatabaseConnection::statementsCache_AffectingStatement() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto &connection_ = DB::connection(connection);
+
+    connection_.setStatementsCacheSize(2).resetStatementsCacheCounter();
+
+    const auto queryString =
+            QStringLiteral("update torrents set progress = progress where id = ?");
+
+    // Cache miss, prepare the query
+    {
+        const auto [affected, query] = connection_.affectingStatement(queryString, {1});
+
+        // The MySQL counts only the changed rows
+        QVERIFY(affected >= 0);
+        // The query was checked in right away
+        QVERIFY(!query.isActive());
+        QCOMPARE(connection_.statementsCacheCount(), static_cast<std::size_t>(1));
+    }
+    // Cache hit, re-use the prepared query with another binding
+    connection_.affectingStatement(queryString, {2});
+
+    const auto &counter = connection_.getStatementsCacheCounter();
+    QCOMPARE(counter.hits, static_cast<qint64>(1));
+    QCOMPARE(counter.misses, static_cast<qint64>(1));
+
+    // Restore
+    connection_.setStatementsCacheSize(0).resetStatementsCacheCounter();
+}
+
+void tst_DatabaseConnection::latencyHistograms() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto &connection_ = DB::connection(connection);
+
+    QVERIFY(!connection_.countingLatency());
+    connection_.enableLatencyHistograms();
+    QVERIFY(connection_.countingLatency());
+
+    const auto queryString = QStringLiteral("select name from torrents where id = ?");
+
+    QCOMPARE(connection_.scalar(queryString, {1}), QVariant(QString("test1")));
+    QCOMPARE(connection_.scalar(queryString, {2}), QVariant(QString("test2")));
+
+    // Don't modify the torrents table, roll back the update
+    connection_.beginTransaction();
+    createQuery(connection)->from("torrents").whereEq(ID, 1)
+            .update({{NAME, "test1 latency"}});
+    connection_.rollBack();
+
+    {
+        const auto &histograms = connection_.getLatencyHistograms();
+        QCOMPARE(histograms.normal.count(), static_cast<qint64>(2));
+        QCOMPARE(histograms.affecting.count(), static_cast<qint64>(1));
+        QCOMPARE(histograms.transactional.count(), static_cast<qint64>(2));
+
+        const auto percentiles = histograms.normal.percentiles();
+        QCOMPARE(percentiles.count, static_cast<qint64>(2));
+        QVERIFY(percentiles.p50 > 0);
+        QVERIFY(percentiles.p50 <= percentiles.p90);
+        QVERIFY(percentiles.p90 <= percentiles.p99);
+        QVERIFY(percentiles.p99 <= percentiles.max);
+        QCOMPARE(percentiles.max, histograms.normal.max());
+        QVERIFY(histograms.normal.min() <= histograms.normal.max());
+    }
+
+    // The elapsed counter is not affected by the latency histograms
+    QVERIFY(!connection_.countingElapsed());
+    QCOMPARE(connection_.getElapsedCounter(), static_cast<qint64>(-1));
+
+    {
+        const auto histograms = connection_.takeLatencyHistograms();
+        QCOMPARE(histograms.normal.count(), static_cast<qint64>(2));
+        QVERIFY(connection_.getLatencyHistograms().normal.isEmpty());
+    }
+
+    connection_.scalar(queryString, {1});
+    QCOMPARE(connection_.getLatencyHistograms().normal.count(), static_cast<qint64>(1));
+
+    // Restore
+    connection_.disableLatencyHistograms();
+    QVERIFY(!connection_.countingLatency());
+    QVERIFY(connection_.getLatencyHistograms().normal.isEmpty());
+}
+
+void tst_DatabaseConnection::queryStatistics() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto &connection_ = DB::connection(connection);
+
+    QVERIFY(!connection_.collectingQueryStatistics());
+    connection_.enableQueryStatistics();
+    QVERIFY(connection_.collectingQueryStatistics());
+
+    // Different bindings and literals have the same fingerprint
+    connection_.scalar("select name from torrents where id = ?", {1});
+    connection_.scalar("select name from torrents where id = ?", {2});
+    connection_.scalar("select name from torrents where id = 3");
+
+    createQuery(connection)->from("torrents").whereIn(ID, {1, 2}).get();
+    createQuery(connection)->from("torrents").whereIn(ID, {1, 2, 3}).get();
+
+    // Don't modify the torrents table, roll back the update
+    connection_.beginTransaction();
+    createQuery(connection)->from("torrents").whereEq(ID, 1)
+            .update({{NAME, "test1 statistics"}});
+    connection_.rollBack();
+
+    const auto statistics = connection_.getQueryStatistics();
+    QVERIFY(statistics);
+    // Transaction queries are not collected
+    QCOMPARE(statistics->size(), static_cast<std::size_t>(3));
+
+    {
+        const auto statistic = statistics->statistic(
+                                   "select name from torrents where id = 1");
+        QVERIFY(statistic);
+        QCOMPARE(statistic->query, QString("select name from torrents where id = ?"));
+        QCOMPARE(statistic->calls, static_cast<qint64>(3));
+        QVERIFY(statistic->minTime <= statistic->maxTime);
+        QVERIFY(statistic->maxTime <= statistic->totalTime);
+    }
+    {
+        const auto top = connection_.topQueryStatistics(3, QueryStatisticsSort::Calls);
+        QCOMPARE(top.size(), 3);
+        QCOMPARE(top.at(0).calls, static_cast<qint64>(3));
+        // Lists of placeholders are collapsed
+        QVERIFY(top.at(1).query.contains("in (?...)"));
+        QCOMPARE(top.at(1).calls, static_cast<qint64>(2));
+        // Update
+        QCOMPARE(top.at(2).calls, static_cast<qint64>(1));
+        QCOMPARE(top.at(2).rows, static_cast<qint64>(1));
+    }
+    {
+        const auto top = connection_.topQueryStatistics(10);
+        QCOMPARE(top.size(), 3);
+        QVERIFY(top.at(0).totalTime >= top.at(1).totalTime);
+        QVERIFY(top.at(1).totalTime >= top.at(2).totalTime);
+    }
+
+    // Disabled collecting keeps statistics
+    connection_.disableQueryStatistics();
+    connection_.scalar("select name from torrents where id = ?", {1});
+    QCOMPARE(statistics->statistic("select name from torrents where id = ?")->calls,
+             static_cast<qint64>(3));
+
+    // Restore
+    connection_.flushQueryStatistics();
+    QVERIFY(statistics->isEmpty());
+}
+
+void tst_DatabaseConnection::queryStatistics_Fingerprint() const
+{
+    QCOMPARE(QueryStatistics::fingerprint(
+                 "select *  from\n  \"users\" where id in (?, ?,?) and name = 'it''s'"),
+             QString(
+                 "select * from \"users\" where id in (?...) and name = ?"));
+
+    QCOMPARE(QueryStatistics::fingerprint(
+                 "insert into `table1` (`a1`, `b`) values (1, 'x'), (2.5, 'y')"),
+             QString("insert into `table1` (`a1`, `b`) values (?...), (?...)"));
+
+    QCOMPARE(QueryStatistics::fingerprint("select * from torrents limit 10 offset 20"),
+             QString("select * from torrents limit ? offset ?"));
+}
+
+void tst_DatabaseConnection::queryStatistics_MaxSize() const
+{
+    QueryStatistics statistics(2);
+
+    statistics.record("select 1", 10, 1);
+    statistics.record("select 2", 20, 1);
+    statistics.record("select * from a", 30, 0);
+    statistics.record("select * from a", 10, 0);
+
+    // Literals have the same fingerprint
+    QCOMPARE(statistics.size(), static_cast<std::size_t>(2));
+    QCOMPARE(statistics.evictions(), static_cast<qint64>(0));
+
+    const auto statistic = statistics.statistic("select 3");
+    QVERIFY(statistic);
+    QCOMPARE(statistic->calls, static_cast<qint64>(2));
+    QCOMPARE(statistic->totalTime, static_cast<qint64>(30));
+    QCOMPARE(statistic->minTime, static_cast<qint64>(10));
+    QCOMPARE(statistic->maxTime, static_cast<qint64>(20));
+    QCOMPARE(statistic->meanTime(), static_cast<qint64>(15));
+    QCOMPARE(statistic->rows, static_cast<qint64>(2));
+
+    // Least executed fingerprint is evicted
+    statistics.record("select * from a", 10, 0);
+    statistics.record("select * from b", 10, 0);
+
+    QCOMPARE(statistics.size(), static_cast<std::size_t>(2));
+    QCOMPARE(statistics.evictions(), static_cast<qint64>(1));
+    QVERIFY(!statistics.statistic("select 1"));
+    QVERIFY(statistics.statistic("select * from a"));
+    QVERIFY(statistics.statistic("select * from b"));
+}
+
+void tst_DatabaseConnection::queryLog_RingBuffer() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto &connection_ = DB::connection(connection);
+
+    connection_.flushQueryLog();
+    connection_.enableQueryLog();
+    connection_.setQueryLogCapacity(3);
+
+    const auto queryString = QStringLiteral("select name from torrents where id = ?");
+
+    for (auto id = 1; id <= 5; ++id)
+        connection_.scalar(queryString, {id});
+
+    {
+        const auto queryLog = connection_.getQueryLog();
+        QCOMPARE(queryLog->size(), 3);
+
+        // Ordered from the oldest record, the oldest records were overwritten
+        QCOMPARE(queryLog->at(0).order, static_cast<std::size_t>(3));
+        QCOMPARE(queryLog->at(1).order, static_cast<std::size_t>(4));
+        QCOMPARE(queryLog->at(2).order, static_cast<std::size_t>(5));
+        QCOMPARE(queryLog->at(2).boundValues, QVector<QVariant>({5}));
+        // Bindings are not replaced in the logged query
+        QCOMPARE(queryLog->at(2).query, queryString);
+    }
+
+    // Shrinking keeps the newest records
+    connection_.scalar(queryString, {6});
+    connection_.setQueryLogCapacity(2);
+
+    {
+        const auto queryLog = connection_.getQueryLog();
+        QCOMPARE(queryLog->size(), 2);
+        QCOMPARE(queryLog->at(0).order, static_cast<std::size_t>(5));
+        QCOMPARE(queryLog->at(1).order, static_cast<std::size_t>(6));
+    }
+
+    // Restore
+    connection_.setQueryLogCapacity(0);
+    connection_.disableQueryLog();
+    connection_.flushQueryLog();
+}
+
+void tst_DatabaseConnection::queryLog_Sink() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto &connection_ = DB::connection(connection);
+
+    QVector<QueryLogSink::Record> records;
+    QStringList formatted;
+
+    auto sink = std::make_shared<QueryLogSink>(
+                    [&records, &formatted]
+                    (const QVector<QueryLogSink::Record> &batch)
+    {
+        for (const auto &record : batch) {
+            records << record;
+            formatted << QueryLogSink::format(record);
+        }
+    }, 2);
+
+    connection_.flushQueryLog();
+    connection_.enableQueryLog();
+    connection_.setQueryLogSink(sink);
+
+    const auto queryString = QStringLiteral("select name from torrents where id = ?");
+
+    for (auto id = 1; id <= 3; ++id)
+        connection_.scalar(queryString, {id});
+
+    sink->flush();
+
+    QCOMPARE(sink->written(), static_cast<qint64>(3));
+    QCOMPARE(sink->dropped(), static_cast<qint64>(0));
+    QCOMPARE(records.size(), 3);
+    QCOMPARE(records.at(0).connection, connection);
+    QCOMPARE(records.at(2).log.order, static_cast<std::size_t>(3));
+    // Formatted lazily in the sink thread
+    QVERIFY(formatted.at(2).endsWith(
+                QStringLiteral("select name from torrents where id = 3")));
+
+    // Restore
+    connection_.setQueryLogSink(nullptr);
+    connection_.disableQueryLog();
+    connection_.flushQueryLog();
+}
+
+void tst_DatabaseConnection::batch() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto &connection_ = DB::connection(connection);
+
+    const auto insertString = QStringLiteral("insert into users (name, note) "
+                                             "values (?, ?)");
+
+    const auto results = connection_.batch({
+        {insertString, {"batch1", "batch"}},
+        {insertString, {"batch2", "batch"}},
+        {QStringLiteral("update users set note = ? where note = ?"),
+         {"batch updated", "batch"}},
+    });
+
+    // Every statement has its own result
+    QCOMPARE(results.size(), 3);
+    QCOMPARE(results.at(0).affected, 1);
+    QCOMPARE(results.at(1).affected, 1);
+    QCOMPARE(results.at(2).affected, 2);
+
+    // The batch transaction was committed
+    QVERIFY(!connection_.inTransaction());
+    QCOMPARE(createQuery(connection)->from("users")
+             .whereEq("note", QStringLiteral("batch updated")).count(),
+             static_cast<quint64>(2));
+
+    // The PostgreSQL driver can't report the last inserted ID without the OID column
+    if (connection_.driverName() != QPSQL) {
+        QVERIFY(results.at(0).lastInsertId.isValid());
+        QVERIFY(results.at(0).lastInsertId.value<quint64>() <
+                results.at(1).lastInsertId.value<quint64>());
+    }
+
+    // Clean up
+    createQuery(connection)->from("users")
+            .whereEq("note", QStringLiteral("batch updated")).remove();
+}
+
+void tst_DatabaseConnection::batch_RollBackOnError() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto &connection_ = DB::connection(connection);
+
+    QVERIFY_EXCEPTION_THROWN(
+                connection_.batch({
+                    {QStringLiteral("insert into users (name, note) values (?, ?)"),
+                     {"batch1", "batch failed"}},
+                    {QStringLiteral("insert into table_not_exists (name) values (?)"),
+                     {"batch2"}},
+                }),
+                QueryError);
+
+    // The first statement was rolled back
+    QVERIFY(!connection_.inTransaction());
+    QCOMPARE(createQuery(connection)->from("users")
+             .whereEq("note", QStringLiteral("batch failed")).count(),
+             static_cast<quint64>(0));
+}
+
+void tst_DatabaseConnection::insertBatch() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto &connection_ = DB::connection(connection);
+
+    // More rows than the batch size, the last chunk is partial
+    constexpr auto rowsCount = 250;
+
+    QVariantList names;
+    names.reserve(rowsCount);
+    for (auto index = 1; index <= rowsCount; ++index)
+        names << QStringLiteral("batch%1").arg(index);
+
+    connection_.enableStatementsCounter().resetStatementsCounter();
+
+    // The note column's only value is bound to every row
+    const auto inserted = createQuery(connection)->from("users")
+                          .insertBatch({NAME, "note"},
+                                       {names, {QStringLiteral("insert batch")}}, 100);
+
+    QCOMPARE(inserted, static_cast<quint64>(rowsCount));
+
+    // Every chunk is executed as one affecting statement
+    QCOMPARE(connection_.getStatementsCounter().affecting, 3);
+
+    connection_.disableStatementsCounter();
+
+    // The batch transaction was committed
+    QVERIFY(!connection_.inTransaction());
+    QCOMPARE(createQuery(connection)->from("users")
+             .whereEq("note", QStringLiteral("insert batch")).count(),
+             static_cast<quint64>(rowsCount));
+
+    // Clean up
+    createQuery(connection)->from("users")
+            .whereEq("note", QStringLiteral("insert batch")).remove();
+}
+
+void tst_DatabaseConnection::updateBatch() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    createQuery(connection)->from("users")
+            .insertBatch({NAME, "note"},
+                         {{QStringLiteral("batch1"), QStringLiteral("batch2"),
+                           QStringLiteral("batch3")},
+                          {QStringLiteral("update batch")}});
+
+    // The where binding is bound to every row
+    const auto updated = createQuery(connection)->from("users")
+                         .whereEq("note", QStringLiteral("update batch"))
+                         .updateBatch({"note", NAME},
+                                      {{QStringLiteral("updated batch1"),
+                                        QStringLiteral("updated batch3")},
+                                       {QStringLiteral("batch1"),
+                                        QStringLiteral("batch3")}},
+                                      NAME);
+
+    QCOMPARE(updated, static_cast<quint64>(2));
+
+    QCOMPARE(createQuery(connection)->from("users")
+             .whereEq(NAME, QStringLiteral("batch1")).value("note"),
+             QVariant(QStringLiteral("updated batch1")));
+    QCOMPARE(createQuery(connection)->from("users")
+             .whereEq(NAME, QStringLiteral("batch2")).value("note"),
+             QVariant(QStringLiteral("update batch")));
+    QCOMPARE(createQuery(connection)->from("users")
+             .whereEq(NAME, QStringLiteral("batch3")).value("note"),
+             QVariant(QStringLiteral("updated batch3")));
+
+    // Clean up
+    createQuery(connection)->from("users")
+            .whereIn(NAME, {QStringLiteral("batch1"), QStringLiteral("batch2"),
+                            QStringLiteral("batch3")})
+            .remove();
+}
+
+void tst_DatabaseConnection::updateBatch_WithExpressionBinding() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    createQuery(connection)->from("users")
+            .insertBatch({NAME, "note"},
+                         {{QStringLiteral("batch1"), QStringLiteral("batch2")},
+                          {QStringLiteral("update batch")}});
+
+    /* The expression in the where clause has no placeholder, the values must be
+       still bound to the correct placeholders. */
+    const auto updated = createQuery(connection)->from("users")
+                         .whereEq("note", DB::raw("'update batch'"))
+                         .updateBatch({"note", NAME},
+                                      {{QStringLiteral("updated batch2")},
+                                       {QStringLiteral("batch2")}},
+                                      NAME);
+
+    QCOMPARE(updated, static_cast<quint64>(1));
+
+    QCOMPARE(createQuery(connection)->from("users")
+             .whereEq(NAME, QStringLiteral("batch1")).value("note"),
+             QVariant(QStringLiteral("update batch")));
+    QCOMPARE(createQuery(connection)->from("users")
+             .whereEq(NAME, QStringLiteral("batch2")).value("note"),
+             QVariant(QStringLiteral("updated batch2")));
+
+    // Clean up
+    createQuery(connection)->from("users")
+            .whereIn(NAME, {QStringLiteral("batch1"), QStringLiteral("batch2")})
+            .remove();
+}
+
+void tst_DatabaseConnection::execBatch_ValuesMismatch() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto &connection_ = DB::connection(connection);
+
+    QVERIFY_EXCEPTION_THROWN(
+                connection_.execBatch(
+                    QStringLiteral("insert into users (name, note) values (?, ?)"),
+                    {{QStringLiteral("batch1"), QStringLiteral("batch2")},
+                     {QStringLiteral("batch"), QStringLiteral("batch"),
+                      QStringLiteral("batch")}}),
+                InvalidArgumentError);
+
+    QVERIFY_EXCEPTION_THROWN(
+                createQuery(connection)->from("users")
+                .insertBatch({NAME, "note"}, {{QStringLiteral("batch1")}}),
+                InvalidArgumentError);
+
+    // The table name is needed, the expression or unset from clause isn't enough
+    QVERIFY_EXCEPTION_THROWN(
+                createQuery(connection)->from(DB::raw("users"))
+                .insertBatch({NAME}, {{QStringLiteral("batch1")}}),
+                InvalidArgumentError);
+    QVERIFY_EXCEPTION_THROWN(
+                createQuery(connection)->insertBatch({NAME},
+                                                     {{QStringLiteral("batch1")}}),
+                InvalidArgumentError);
+}
+
+void tst_DatabaseConnection::bulkLoad() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    // More rows than fit into one multi-row insert statement
+    constexpr auto rowsCount = 2500;
+
+    auto index = 0;
+    const auto loaded = createQuery(connection)->from("users")
+                        .bulkLoad({NAME, "note"},
+                                  [&index]() -> std::optional<QVector<QVariant>>
+    {
+        if (index == rowsCount)
+            return std::nullopt;
+
+        ++index;
+
+        return QVector<QVariant> {QStringLiteral("bulk%1").arg(index),
+                                  QStringLiteral("bulk load")};
+    });
+
+    QCOMPARE(loaded, static_cast<quint64>(rowsCount));
+
+    // The bulk load transaction was committed
+    QVERIFY(!DB::connection(connection).inTransaction());
+    QCOMPARE(createQuery(connection)->from("users")
+             .whereEq("note", QStringLiteral("bulk load")).count(),
+             static_cast<quint64>(rowsCount));
+    QCOMPARE(createQuery(connection)->from("users")
+             .whereEq(NAME, QStringLiteral("bulk2500")).value("note"),
+             QVariant(QStringLiteral("bulk load")));
+
+    // Clean up
+    createQuery(connection)->from("users")
+            .whereEq("note", QStringLiteral("bulk load")).remove();
+}
+
+void tst_DatabaseConnection::bulkLoad_Range() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    const QVector<QVector<QVariant>> rows {
+        {QStringLiteral("bulk\ta\\b"), QStringLiteral("bulk\tload")},
+        {QStringLiteral("bulk null"),     QVariant()},
+    };
+
+    const auto loaded = createQuery(connection)->from("users")
+                        .bulkLoad({NAME, "note"}, rows);
+
+    QCOMPARE(loaded, static_cast<quint64>(2));
+
+    // Special characters and NULL values are loaded as they are
+    QCOMPARE(createQuery(connection)->from("users")
+             .whereEq(NAME, QStringLiteral("bulk\ta\\b")).value("note"),
+             QVariant(QStringLiteral("bulk\tload")));
+    QVERIFY(createQuery(connection)->from("users")
+            .whereEq(NAME, QStringLiteral("bulk null")).value("note").isNull());
+
+    // Clean up
+    createQuery(connection)->from("users")
+            .whereIn(NAME, {QStringLiteral("bulk\ta\\b"),
+                            QStringLiteral("bulk null")})
+            .remove();
+}
+
+void tst_DatabaseConnection::bulkLoad_RollBackOnError() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    const QVector<QVector<QVariant>> rows {
+        {QStringLiteral("bulk1"), QStringLiteral("bulk failed")},
+        {QStringLiteral("bulk2")},
+    };
+
+    QVERIFY_EXCEPTION_THROWN(
+                createQuery(connection)->from("users").bulkLoad({NAME, "note"}, rows),
+                InvalidArgumentError);
+
+    // The first row was rolled back
+    QVERIFY(!DB::connection(connection).inTransaction());
+    QCOMPARE(createQuery(connection)->from("users")
+             .whereEq("note", QStringLiteral("bulk failed")).count(),
+             static_cast<quint64>(0));
+}
+
+void tst_DatabaseConnection::bulkLoad_WithoutTable_Throws() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    const QVector<QVector<QVariant>> rows {{QStringLiteral("bulk1")}};
+
+    // The table name is needed, the expression or unset from clause isn't enough
+    QVERIFY_EXCEPTION_THROWN(
+                createQuery(connection)->from(DB::raw("users")).bulkLoad({NAME}, rows),
+                InvalidArgumentError);
+    QVERIFY_EXCEPTION_THROWN(createQuery(connection)->bulkLoad({NAME}, rows),
+                             InvalidArgumentError);
+}
+
+void tst_DatabaseConnection::selectAsync() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto &connection_ = DB::connection(connection);
+
+    const auto queryString = QStringLiteral("select id, name from torrents where id = ?");
+
+    // More queries in flight at once, the worker thread executes them in order
+    QVector<QFuture<QVector<QSqlRecord>>> futures;
+    for (auto id = 1; id <= 3; ++id)
+        futures << connection_.selectAsync(queryString, {id});
+
+    for (auto i = 0; i < futures.size(); ++i) {
+        const auto records = futures[i].result();
+
+        QCOMPARE(records.size(), 1);
+        QCOMPARE(records.first().value(ID).value<quint64>(),
+                 static_cast<quint64>(i + 1));
+        QCOMPARE(records.first().value(NAME).value<QString>(),
+                 QStringLiteral("test%1").arg(i + 1));
+    }
+
+    connection_.waitForAsyncQueries();
+
+    QCOMPARE(connection_.pendingAsyncQueries(), static_cast<std::size_t>(0));
+}
+
+void tst_DatabaseConnection::selectAsync_QueryError() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto future = DB::connection(connection)
+                  .selectAsync(QStringLiteral("select * from table_not_exists"));
+
+    // Qt5 reports the QUnhandledException instead of the QueryError
+    QVERIFY_EXCEPTION_THROWN(future.waitForFinished(), std::exception);
+}
+
+void tst_DatabaseConnection::selectAsync_InTransaction_Throws() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto &connection_ = DB::connection(connection);
+
+    connection_.beginTransaction();
+
+    // The worker's connection wouldn't see the uncommitted changes
+    QVERIFY_EXCEPTION_THROWN(connection_.selectAsync(
+                                 "select id from torrents where id = ?", {1}),
+                             LogicError);
+
+    connection_.rollBack();
+}
+
+void tst_DatabaseConnection::statementAsync() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto future = DB::connection(connection)
+                  .statementAsync(QStringLiteral(
+                                      "update torrents set progress = progress "
+                                      "where id = ?"),
+                                  {0});
+
+    QCOMPARE(future.result(), 0);
+}
+
+void tst_DatabaseConnection::statementAsync_InTransaction_Throws() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto &connection_ = DB::connection(connection);
+
+    connection_.beginTransaction();
+
+    QVERIFY_EXCEPTION_THROWN(connection_.statementAsync(
+                                 "update torrents set progress = progress where id = ?",
+                                 {0}),
+                             LogicError);
+
+    connection_.rollBack();
+}
+
+void tst_DatabaseConnection::getAsync() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto future = createQuery(connection)->from("torrents")
+                  .where(ID, "<", 3).orderBy(ID).getAsync({ID, NAME});
+
+    const auto records = future.result();
+
+    QCOMPARE(records.size(), 2);
+    QCOMPARE(records.at(0).count(), 2);
+    QCOMPARE(records.at(0).value(NAME).value<QString>(), QStringLiteral("test1"));
+    QCOMPARE(records.at(1).value(NAME).value<QString>(), QStringLiteral("test2"));
+}
+
+void tst_DatabaseConnection::getAsync_InTransaction_Throws() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto &connection_ = DB::connection(connection);
+
+    connection_.beginTransaction();
+
+    QVERIFY_EXCEPTION_THROWN(createQuery(connection)->from("torrents")
+                             .whereEq(ID, 1).getAsync({ID}),
+                             LogicError);
+
+    connection_.rollBack();
+}
 // NOLINTEND(readability-convert-member-functions-to-static)
 
 /* private */
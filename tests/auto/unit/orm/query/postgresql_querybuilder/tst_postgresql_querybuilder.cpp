@@ -2,6 +2,7 @@
 #include <QtTest>
 
 #include "orm/db.hpp"
+#include "orm/exceptions/invalidargumenterror.hpp"
 #include "orm/query/querybuilder.hpp"
 #include "orm/utils/type.hpp"
 
@@ -21,6 +22,7 @@ using Orm::Constants::OR;
 using Orm::Constants::SIZE;
 
 using Orm::DB;
+using Orm::Exceptions::InvalidArgumentError;
 using Orm::Query::Expression;
 
 using QueryBuilder = Orm::Query::Builder;
@@ -106,6 +108,8 @@ private Q_SLOTS:
     void whereIn_Empty() const;
     void whereNotIn_Empty() const;
     void whereIn_ValueExpression() const;
+    void whereInArray() const;
+    void replaceWhereInValues() const;
 
     void whereNull() const;
     void whereNotNull() const;
@@ -1468,6 +1472,52 @@ void tst_PostgreSQL_QueryBuilder::whereIn_ValueExpression() const
     }
 }
 
+void tst_PostgreSQL_QueryBuilder::whereInArray() const
+{
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").whereInArray(ID, {2, 3, 4});
+        QCOMPARE(builder->toSql(),
+                 "select * from \"torrents\" where \"id\" = any(?)");
+        QCOMPARE(builder->getBindings(),
+                 QVector<QVariant>({QVariant(QString("{\"2\",\"3\",\"4\"}"))}));
+    }
+
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").whereEq(ID, 1)
+                .whereInArray(NAME, {"a\"b", "c\\d", {}}, OR);
+        QCOMPARE(builder->toSql(),
+                 "select * from \"torrents\" where \"id\" = ? or \"name\" = any(?)");
+        QCOMPARE(builder->getBindings(),
+                 QVector<QVariant>({QVariant(1),
+                                    QVariant(QString("{\"a\\\"b\",\"c\\\\d\",NULL}"))}));
+    }
+}
+
+void tst_PostgreSQL_QueryBuilder::replaceWhereInValues() const
+{
+    auto builder = createQuery();
+
+    builder->select("*").from("torrents").whereEq(ID, 1)
+            .whereIn(ID, {2, 3, 4}).whereEq(NAME, "xyz");
+
+    builder->replaceWhereInValues(1, 1, {5, 6});
+
+    QCOMPARE(builder->toSql(),
+             "select * from \"torrents\" where \"id\" = ? and \"id\" in (?, ?) "
+             "and \"name\" = ?");
+    QCOMPARE(builder->getBindings(),
+             QVector<QVariant>({QVariant(1), QVariant(5), QVariant(6),
+                                QVariant(QString("xyz"))}));
+
+    // Only the "where in" clause can be replaced
+    QVERIFY_EXCEPTION_THROWN(builder->replaceWhereInValues(0, 0, {5}),
+                             InvalidArgumentError);
+}
+
 void tst_PostgreSQL_QueryBuilder::whereNull() const
 {
     {
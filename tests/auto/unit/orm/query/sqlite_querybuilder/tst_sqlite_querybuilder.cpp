@@ -68,6 +68,8 @@ private Q_SLOTS:
     void fromSub_QueryBuilderOverload_WithWhere() const;
     void fromSub_CallbackOverload() const;
 
+    void crossJoin_WithoutConditions() const;
+
     void joinSub_QStringOverload() const;
     void joinSub_QueryBuilderOverload_WithWhere() const;
     void joinSub_CallbackOverload() const;
@@ -80,6 +82,8 @@ private Q_SLOTS:
 
     void whereNot() const;
     void whereNot_WithVectorValue_DefaultCondition() const;
+    void whereNot_Leading() const;
+    void whereNot_Leading_Nested() const;
 
     void orWhere() const;
     void orWhere_ColumnExpression() const;
@@ -141,6 +145,11 @@ private Q_SLOTS:
     void remove() const;
     void remove_WithExpression() const;
 
+    void compiledSqlCache() const;
+
+    void getBindings_OrderedByBindingType() const;
+    void update_BindingsOrder() const;
+
 // NOLINTNEXTLINE(readability-redundant-access-specifiers)
 private:
     /*! Create QueryBuilder instance for the given connection. */
@@ -693,6 +702,19 @@ void tst_SQLite_QueryBuilder::fromSub_CallbackOverload() const
              QVector<QVariant>({QVariant(5), QVariant("xyz")}));
 }
 
+void tst_SQLite_QueryBuilder::crossJoin_WithoutConditions() const
+{
+    auto builder = createQuery();
+
+    builder->from("users").crossJoin("contacts").where("users.id", "=", 1);
+
+    QCOMPARE(builder->toSql(),
+             "select * from \"users\" cross join \"contacts\" "
+             "where \"users\".\"id\" = ?");
+    QCOMPARE(builder->getBindings(),
+             QVector<QVariant>({QVariant(1)}));
+}
+
 void tst_SQLite_QueryBuilder::joinSub_QStringOverload() const
 {
     auto builder = createQuery();
@@ -978,6 +1000,79 @@ void tst_SQLite_QueryBuilder::whereNot() const
     }
 }
 
+void tst_SQLite_QueryBuilder::whereNot_Leading() const
+{
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").orWhereNotEq(ID, 3)
+                .orWhereEq(NAME, "test3");
+        QCOMPARE(builder->toSql(),
+                 "select * from \"torrents\" where not \"id\" = ? or \"name\" = ?");
+        QCOMPARE(builder->getBindings(),
+                 QVector<QVariant>({QVariant(3), QVariant("test3")}));
+    }
+
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").whereNot([](auto &query)
+        {
+            query.whereEq(ID, 3);
+        });
+        QCOMPARE(builder->toSql(),
+                 "select * from \"torrents\" where not (\"id\" = ?)");
+        QCOMPARE(builder->getBindings(),
+                 QVector<QVariant> {QVariant(3)});
+    }
+
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").orWhereNot([](auto &query)
+        {
+            query.whereEq(ID, 3);
+        });
+        QCOMPARE(builder->toSql(),
+                 "select * from \"torrents\" where not (\"id\" = ?)");
+        QCOMPARE(builder->getBindings(),
+                 QVector<QVariant> {QVariant(3)});
+    }
+}
+
+void tst_SQLite_QueryBuilder::whereNot_Leading_Nested() const
+{
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").whereEq(ID, 3)
+                .where([](auto &query)
+        {
+            query.whereNotEq(NAME, "test3").orWhereNotEq(SIZE, 13);
+        });
+        QCOMPARE(builder->toSql(),
+                 "select * from \"torrents\" where \"id\" = ? and "
+                 "(not \"name\" = ? or not \"size\" = ?)");
+        QCOMPARE(builder->getBindings(),
+                 QVector<QVariant>({QVariant(3), QVariant("test3"), QVariant(13)}));
+    }
+
+    {
+        auto builder = createQuery();
+
+        builder->select("*").from("torrents").whereEq(ID, 3)
+                .orWhereNot([](auto &query)
+        {
+            query.orWhereNot(NAME, LIKE, "test%").whereNotEq(SIZE, 13);
+        });
+        QCOMPARE(builder->toSql(),
+                 "select * from \"torrents\" where \"id\" = ? or "
+                 "not (not \"name\" like ? and not \"size\" = ?)");
+        QCOMPARE(builder->getBindings(),
+                 QVector<QVariant>({QVariant(3), QVariant("test%"), QVariant(13)}));
+    }
+}
+
 void tst_SQLite_QueryBuilder::whereNot_WithVectorValue_DefaultCondition() const
 {
     auto builder = createQuery();
@@ -1988,6 +2083,121 @@ void tst_SQLite_QueryBuilder::remove_WithExpression() const
              "delete from \"torrents\" where \"torrents\".\"id\" = 2223");
     QVERIFY(firstLog.boundValues.isEmpty());
 }
+
+void tst_SQLite_QueryBuilder::compiledSqlCache() const
+{
+    auto &grammar = DB::connection(m_connection).getQueryGrammar();
+    const auto &cache = grammar.getCompiledSqlCache();
+
+    grammar.setCompiledSqlCacheSize(10);
+
+    const auto hits = cache.counter().hits;
+
+    {
+        auto builder = createQuery();
+
+        builder->from("torrents").whereEq(ID, 1).orderBy(NAME);
+
+        QCOMPARE(builder->toSql(),
+                 "select * from \"torrents\" where \"id\" = ? order by \"name\" asc");
+        QCOMPARE(builder->getBindings(), QVector<QVariant>({QVariant(1)}));
+    }
+
+    // The same query shape with different binding values is obtained from the cache
+    {
+        auto builder = createQuery();
+
+        builder->from("torrents").whereEq(ID, 2).orderBy(NAME);
+
+        QCOMPARE(builder->toSql(),
+                 "select * from \"torrents\" where \"id\" = ? order by \"name\" asc");
+        QCOMPARE(builder->getBindings(), QVector<QVariant>({QVariant(2)}));
+    }
+
+    QCOMPARE(cache.counter().hits, hits + 1);
+
+    // Raw expressions are compiled into SQL so they are part of the query shape
+    {
+        auto builder = createQuery();
+
+        builder->from("torrents").whereEq(ID, Raw(3)).orderBy(NAME);
+
+        QCOMPARE(builder->toSql(),
+                 "select * from \"torrents\" where \"id\" = 3 order by \"name\" asc");
+        QVERIFY(builder->getBindings().isEmpty());
+    }
+
+    // The number of values affects the number of placeholders
+    {
+        auto builder = createQuery();
+
+        builder->from("torrents").whereIn(ID, {1, 2}).orderBy(NAME);
+
+        QCOMPARE(builder->toSql(),
+                 "select * from \"torrents\" where \"id\" in (?, ?) "
+                 "order by \"name\" asc");
+        QCOMPARE(builder->getBindings(),
+                 QVector<QVariant>({QVariant(1), QVariant(2)}));
+    }
+
+    QCOMPARE(cache.counter().hits, hits + 1);
+
+    // Disable the cache
+    grammar.setCompiledSqlCacheSize(0);
+
+    QCOMPARE(cache.size(), static_cast<std::size_t>(0));
+}
+
+void tst_SQLite_QueryBuilder::getBindings_OrderedByBindingType() const
+{
+    auto builder = createQuery();
+
+    // Bindings are added out of the binding type order
+    builder->from("torrents")
+            .orderByRaw("\"size\" > ?", {5})
+            .havingRaw("count(*) > ?", {2})
+            .whereEq(ID, 10)
+            .selectRaw("\"size\" + ? as \"size_plus\"", {1})
+            .groupBy(NAME)
+            .orWhereEq(NAME, "xyz");
+
+    QCOMPARE(builder->toSql(),
+             "select \"size\" + ? as \"size_plus\" from \"torrents\" "
+             "where \"id\" = ? or \"name\" = ? group by \"name\" "
+             "having count(*) > ? order by \"size\" > ?");
+    QCOMPARE(builder->getBindings(),
+             QVector<QVariant>({QVariant(1), QVariant(10), QVariant("xyz"),
+                                QVariant(2), QVariant(5)}));
+
+    // Order by bindings are removed with the orders
+    builder->reorder();
+
+    QCOMPARE(builder->getBindings(),
+             QVector<QVariant>({QVariant(1), QVariant(10), QVariant("xyz"),
+                                QVariant(2)}));
+}
+
+void tst_SQLite_QueryBuilder::update_BindingsOrder() const
+{
+    auto log = DB::connection(m_connection).pretend([](auto &connection)
+    {
+        connection.query()->from("torrents")
+                .whereEq(ID, 10)
+                .selectRaw("? as \"ignored\"", {1})
+                .orWhereEq(SIZE, 20)
+                .update({{NAME, "xyz"}});
+    });
+
+    QVERIFY(!log.isEmpty());
+    const auto &firstLog = log.first();
+
+    // Select bindings are not part of the update query
+    QCOMPARE(log.size(), 1);
+    QCOMPARE(firstLog.query,
+             "update \"torrents\" set \"name\" = ? where \"id\" = ? or \"size\" = ?");
+    QCOMPARE(firstLog.boundValues,
+             QVector<QVariant>({QVariant("xyz"), QVariant(10), QVariant(20)}));
+}
 // NOLINTEND(readability-convert-member-functions-to-static)
 
 /* private */
@@ -0,0 +1,195 @@
+#include <QCoreApplication>
+#include <QtTest>
+
+#include "orm/db.hpp"
+#include "orm/tiny/model.hpp"
+#include "orm/utils/type.hpp"
+
+#include "benchmarks.hpp"
+#include "databases.hpp"
+
+using Orm::One;
+using Orm::Tiny::ConnectionOverride;
+using Orm::Tiny::Model;
+using Orm::Tiny::Relations::BelongsTo;
+using Orm::Tiny::Relations::HasMany;
+using Orm::Tiny::Relations::Relation;
+
+using TypeUtils = Orm::Utils::Type;
+
+using TestUtils::Benchmarks;
+using TestUtils::Databases;
+
+namespace
+{
+    /*! Size type used by the containers. */
+    using SizeType = QVector<QVariant>::size_type;
+
+    /*! Number of rows in the parents table. */
+    constexpr SizeType ParentsCount = 100'000;
+    /*! Number of rows in the children table. */
+    constexpr SizeType ChildrenCount = 1'000'000;
+
+    /*! Benchmark tables, all rows are generated when the benchmark starts. */
+    const QVector<Benchmarks::Table> BenchTables {
+        {"bench_parents",
+         R"("id" integer not null primary key, "name" varchar not null)",
+         R"("id", "name")",
+         R"("x", 'parent' || "x")",
+         ParentsCount},
+        // Every parent has the same number of children
+        {"bench_children",
+         R"("id" integer not null primary key, "parent_id" integer not null, )"
+         R"("name" varchar not null)",
+         R"("id", "parent_id", "name")",
+         R"("x", ("x" - 1) % ? + 1, 'child' || "x")",
+         ChildrenCount, {ParentsCount}},
+    };
+
+    class BenchParent;
+
+    /*! Child model, belongs to the parent. */
+    class BenchChild final : public Model<BenchChild, BenchParent>
+    {
+        friend Model;
+        using Model::Model;
+
+    public:
+        /*! Get the parent that owns the child. */
+        std::unique_ptr<BelongsTo<BenchChild, BenchParent>> parent();
+
+    private:
+        /*! The table associated with the model. */
+        QString u_table {"bench_children"};
+
+        /*! Indicates if the model should be timestamped. */
+        bool u_timestamps = false;
+
+        /*! Map of relation names to methods. */
+        inline static const QHash<QString, RelationVisitor> u_relations {
+            {"parent", [](auto &v) { v(&BenchChild::parent); }},
+        };
+    };
+
+    /*! Parent model, has many children. */
+    class BenchParent final : public Model<BenchParent, BenchChild>
+    {
+        friend Model;
+        using Model::Model;
+
+    public:
+        /*! Get the children of the parent. */
+        std::unique_ptr<HasMany<BenchParent, BenchChild>> children()
+        {
+            return hasMany<BenchChild>("parent_id");
+        }
+
+    private:
+        /*! The table associated with the model. */
+        QString u_table {"bench_parents"};
+
+        /*! Indicates if the model should be timestamped. */
+        bool u_timestamps = false;
+
+        /*! Map of relation names to methods. */
+        inline static const QHash<QString, RelationVisitor> u_relations {
+            {"children", [](auto &v) { v(&BenchParent::children); }},
+        };
+    };
+
+    std::unique_ptr<BelongsTo<BenchChild, BenchParent>> BenchChild::parent()
+    {
+        return belongsTo<BenchParent>("parent_id");
+    }
+} // namespace
+
+/* Measures matching of the eagerly loaded 1M children onto their 100k parents,
+   the match_ rows measure only the matching, models are hydrated before. */
+class tst_Bench_EagerMatching : public QObject // clazy:exclude=ctor-missing-parent-argument
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+    void cleanupTestCase() const;
+
+    void eagerLoad_HasMany() const;
+    void match_HasMany() const;
+    void match_BelongsTo() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Connection name used in this test case. */
+    QString m_connection {};
+};
+
+/* private slots */
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+void tst_Bench_EagerMatching::initTestCase()
+{
+    m_connection = Benchmarks::createConnection(BenchTables);
+
+    if (m_connection.isEmpty())
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    ConnectionOverride::connection = m_connection;
+}
+
+void tst_Bench_EagerMatching::cleanupTestCase() const
+{
+    Benchmarks::dropTables(m_connection, BenchTables);
+}
+
+void tst_Bench_EagerMatching::eagerLoad_HasMany() const
+{
+    QBENCHMARK_ONCE {
+        auto parents = BenchParent::with("children")->get();
+
+        QCOMPARE(parents.size(), ParentsCount);
+        QCOMPARE(parents.first().getRelation<BenchChild>("children").size(),
+                 ChildrenCount / ParentsCount);
+    }
+}
+
+void tst_Bench_EagerMatching::match_HasMany() const
+{
+    auto parents = BenchParent::all();
+    auto children = BenchChild::all();
+
+    const auto relation = Relation<BenchParent, BenchChild>::noConstraints([]
+    {
+        return BenchParent().children();
+    });
+
+    QBENCHMARK_ONCE {
+        relation->match(parents, std::move(children), "children");
+    }
+
+    QCOMPARE(parents.last().getRelation<BenchChild>("children").size(),
+             ChildrenCount / ParentsCount);
+}
+
+void tst_Bench_EagerMatching::match_BelongsTo() const
+{
+    auto children = BenchChild::all();
+    auto parents = BenchParent::all();
+
+    const auto relation = Relation<BenchChild, BenchParent>::noConstraints([]
+    {
+        return BenchChild().parent();
+    });
+
+    QBENCHMARK_ONCE {
+        relation->match(children, std::move(parents), "parent");
+    }
+
+    QVERIFY(children.last().getRelation<BenchParent, One>("parent") != nullptr);
+}
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+QTEST_MAIN(tst_Bench_EagerMatching)
+
+#include "tst_bench_eagermatching.moc"
@@ -0,0 +1,173 @@
+#include <QCoreApplication>
+#include <QtTest>
+
+#include "orm/db.hpp"
+#include "orm/query/querybuilder.hpp"
+#include "orm/tiny/model.hpp"
+#include "orm/utils/type.hpp"
+
+#include "benchmarks.hpp"
+#include "databases.hpp"
+
+using Orm::Constants::ID;
+
+using Orm::DB;
+using Orm::Tiny::ConnectionOverride;
+using Orm::Tiny::Model;
+
+using QueryUtils = Orm::Utils::Query;
+using TypeUtils = Orm::Utils::Type;
+
+using TestUtils::Benchmarks;
+using TestUtils::Databases;
+
+namespace
+{
+    /*! Size type used by the containers. */
+    using SizeType = QVector<QVariant>::size_type;
+
+    /*! Number of rows in the benchmark table. */
+    constexpr SizeType RowsCount = 1'000'000;
+
+    /*! Benchmark tables, all rows are generated when the benchmark starts. */
+    const QVector<Benchmarks::Table> BenchTables {
+        {"bench_rows",
+         R"("id" integer not null primary key, "name" varchar not null, )"
+         R"("size" integer not null)",
+         R"("id", "name", "size")",
+         R"("x", 'row' || "x", "x" % 1000)",
+         RowsCount},
+    };
+
+    /*! Model for the benchmark table. */
+    class BenchRow final : public Model<BenchRow>
+    {
+        friend Model;
+        using Model::Model;
+
+    private:
+        /*! The table associated with the model. */
+        QString u_table {"bench_rows"};
+
+        /*! Indicates if the model should be timestamped. */
+        bool u_timestamps = false;
+    };
+} // namespace
+
+/* Compares the hydration of the 1M rows SQLite result, the SQLite driver doesn't
+   report the result size, so the queryResultSize() walks the whole result set
+   before the hydration. */
+class tst_Bench_Hydration : public QObject // clazy:exclude=ctor-missing-parent-argument
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+    void cleanupTestCase() const;
+
+    void select_CountRowsFirst() const;
+    void select_SizeHint() const;
+    void select_Cursor() const;
+
+    void hydrate_Get() const;
+    void hydrate_Cursor() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Connection name used in this test case. */
+    QString m_connection {};
+};
+
+/* private slots */
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+void tst_Bench_Hydration::initTestCase()
+{
+    m_connection = Benchmarks::createConnection(BenchTables);
+
+    if (m_connection.isEmpty())
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    ConnectionOverride::connection = m_connection;
+}
+
+void tst_Bench_Hydration::cleanupTestCase() const
+{
+    Benchmarks::dropTables(m_connection, BenchTables);
+}
+
+void tst_Bench_Hydration::select_CountRowsFirst() const
+{
+    QBENCHMARK_ONCE {
+        auto query = DB::table("bench_rows", m_connection)->get();
+
+        // The old hydration path, walks the whole result set to reserve
+        QVector<QVariant> ids;
+        ids.reserve(QueryUtils::queryResultSize(query));
+
+        while (query.next())
+            ids << query.value(ID);
+
+        QCOMPARE(ids.size(), RowsCount);
+    }
+}
+
+void tst_Bench_Hydration::select_SizeHint() const
+{
+    QBENCHMARK_ONCE {
+        auto query = DB::table("bench_rows", m_connection)->get();
+
+        QVector<QVariant> ids;
+        if (const auto sizeHint = QueryUtils::queryResultSizeHint(query); sizeHint > 0)
+            ids.reserve(sizeHint);
+
+        while (query.next())
+            ids << query.value(ID);
+
+        QCOMPARE(ids.size(), RowsCount);
+    }
+}
+
+void tst_Bench_Hydration::select_Cursor() const
+{
+    QBENCHMARK_ONCE {
+        auto cursor = DB::table("bench_rows", m_connection)->cursor();
+
+        QVector<QVariant> ids;
+        for (const auto &row : cursor)
+            ids << row.value(ID);
+
+        QCOMPARE(ids.size(), RowsCount);
+    }
+}
+
+void tst_Bench_Hydration::hydrate_Get() const
+{
+    QBENCHMARK_ONCE {
+        const auto models = BenchRow::query()->get();
+
+        QCOMPARE(models.size(), RowsCount);
+    }
+}
+
+void tst_Bench_Hydration::hydrate_Cursor() const
+{
+    QBENCHMARK_ONCE {
+        auto cursor = BenchRow::cursor();
+
+        SizeType count = 0;
+        for (const auto &model : cursor) {
+            Q_UNUSED(model)
+            ++count;
+        }
+
+        QCOMPARE(count, RowsCount);
+    }
+}
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+QTEST_MAIN(tst_Bench_Hydration)
+
+#include "tst_bench_hydration.moc"
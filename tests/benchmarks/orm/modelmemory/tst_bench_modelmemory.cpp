@@ -0,0 +1,252 @@
+#include <QCoreApplication>
+#include <QtTest>
+
+#include "orm/db.hpp"
+#include "orm/tiny/model.hpp"
+#include "orm/utils/type.hpp"
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+#  include <malloc.h>
+#  define TINYBENCH_HEAP_USAGE
+#endif
+
+#include "benchmarks.hpp"
+#include "databases.hpp"
+
+using Orm::Tiny::ConnectionOverride;
+using Orm::Tiny::Model;
+using Orm::Tiny::Relations::HasMany;
+using Orm::Tiny::Relations::HasOne;
+
+using TypeUtils = Orm::Utils::Type;
+
+using TestUtils::Benchmarks;
+using TestUtils::Databases;
+
+namespace
+{
+    /*! Size type used by the containers. */
+    using SizeType = QVector<QVariant>::size_type;
+
+    /*! Number of rows in the benchmark table. */
+    constexpr SizeType RowsCount = 1'000'000;
+
+    /*! Benchmark tables, all rows are generated when the benchmark starts. */
+    const QVector<Benchmarks::Table> BenchTables {
+        {"bench_rows",
+         R"("id" integer not null primary key, "name" varchar not null, )"
+         R"("size" integer not null)",
+         R"("id", "name", "size")",
+         R"("x", 'row' || "x", "x" % 1000)",
+         RowsCount},
+    };
+
+    /*! Related model, only needed to define relationships. */
+    class BenchRelated final : public Model<BenchRelated>
+    {
+        friend Model;
+        using Model::Model;
+
+    private:
+        /*! The table associated with the model. */
+        QString u_table {"bench_related"};
+
+        /*! Indicates if the model should be timestamped. */
+        bool u_timestamps = false;
+    };
+
+    /*! Model without relationships. */
+    class BenchRow final : public Model<BenchRow>
+    {
+        friend Model;
+        using Model::Model;
+
+    private:
+        /*! The table associated with the model. */
+        QString u_table {"bench_rows"};
+
+        /*! Indicates if the model should be timestamped. */
+        bool u_timestamps = false;
+    };
+
+    /*! Model with ten relationships (the same table as the BenchRow). */
+    class BenchRowRelations final : public Model<BenchRowRelations, BenchRelated>
+    {
+        friend Model;
+        using Model::Model;
+
+    public:
+        /*! Get the related models (the relation 1). */
+        std::unique_ptr<HasMany<BenchRowRelations, BenchRelated>> related1()
+        {
+            return hasMany<BenchRelated>("row1_id");
+        }
+
+        /*! Get the related models (the relation 2). */
+        std::unique_ptr<HasMany<BenchRowRelations, BenchRelated>> related2()
+        {
+            return hasMany<BenchRelated>("row2_id");
+        }
+
+        /*! Get the related models (the relation 3). */
+        std::unique_ptr<HasMany<BenchRowRelations, BenchRelated>> related3()
+        {
+            return hasMany<BenchRelated>("row3_id");
+        }
+
+        /*! Get the related models (the relation 4). */
+        std::unique_ptr<HasMany<BenchRowRelations, BenchRelated>> related4()
+        {
+            return hasMany<BenchRelated>("row4_id");
+        }
+
+        /*! Get the related models (the relation 5). */
+        std::unique_ptr<HasMany<BenchRowRelations, BenchRelated>> related5()
+        {
+            return hasMany<BenchRelated>("row5_id");
+        }
+
+        /*! Get the related model (the relation 6). */
+        std::unique_ptr<HasOne<BenchRowRelations, BenchRelated>> related6()
+        {
+            return hasOne<BenchRelated>("row6_id");
+        }
+
+        /*! Get the related model (the relation 7). */
+        std::unique_ptr<HasOne<BenchRowRelations, BenchRelated>> related7()
+        {
+            return hasOne<BenchRelated>("row7_id");
+        }
+
+        /*! Get the related model (the relation 8). */
+        std::unique_ptr<HasOne<BenchRowRelations, BenchRelated>> related8()
+        {
+            return hasOne<BenchRelated>("row8_id");
+        }
+
+        /*! Get the related model (the relation 9). */
+        std::unique_ptr<HasOne<BenchRowRelations, BenchRelated>> related9()
+        {
+            return hasOne<BenchRelated>("row9_id");
+        }
+
+        /*! Get the related model (the relation 10). */
+        std::unique_ptr<HasOne<BenchRowRelations, BenchRelated>> related10()
+        {
+            return hasOne<BenchRelated>("row10_id");
+        }
+
+    private:
+        /*! The table associated with the model. */
+        QString u_table {"bench_rows"};
+
+        /*! Indicates if the model should be timestamped. */
+        bool u_timestamps = false;
+
+        /*! Map of relation names to methods. */
+        inline static const QHash<QString, RelationVisitor> u_relations {
+            {"related1",  [](auto &v) { v(&BenchRowRelations::related1); }},
+            {"related2",  [](auto &v) { v(&BenchRowRelations::related2); }},
+            {"related3",  [](auto &v) { v(&BenchRowRelations::related3); }},
+            {"related4",  [](auto &v) { v(&BenchRowRelations::related4); }},
+            {"related5",  [](auto &v) { v(&BenchRowRelations::related5); }},
+            {"related6",  [](auto &v) { v(&BenchRowRelations::related6); }},
+            {"related7",  [](auto &v) { v(&BenchRowRelations::related7); }},
+            {"related8",  [](auto &v) { v(&BenchRowRelations::related8); }},
+            {"related9",  [](auto &v) { v(&BenchRowRelations::related9); }},
+            {"related10", [](auto &v) { v(&BenchRowRelations::related10); }},
+        };
+    };
+
+#ifdef TINYBENCH_HEAP_USAGE
+    /*! Get the number of bytes currently allocated on the heap. */
+    qint64 heapUsage()
+    {
+        return static_cast<qint64>(mallinfo2().uordblks);
+    }
+#endif
+} // namespace
+
+/* Measures the heap memory held by 1M hydrated models, the result is reported
+   in bytes per model (heap only, excluding the QVector<Model> storage). */
+class tst_Bench_ModelMemory : public QObject // clazy:exclude=ctor-missing-parent-argument
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+    void cleanupTestCase() const;
+
+    void hydrate_WithoutRelations() const;
+    void hydrate_WithRelations() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Hydrate all rows and report the heap memory used per model. */
+    template<typename Model>
+    static void hydrateAndReport();
+
+    /*! Connection name used in this test case. */
+    QString m_connection {};
+};
+
+/* private slots */
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+void tst_Bench_ModelMemory::initTestCase()
+{
+#ifndef TINYBENCH_HEAP_USAGE
+    QSKIP("The heap usage can be measured only with the glibc >=2.33.", );
+#endif
+
+    m_connection = Benchmarks::createConnection(BenchTables);
+
+    if (m_connection.isEmpty())
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    ConnectionOverride::connection = m_connection;
+}
+
+void tst_Bench_ModelMemory::cleanupTestCase() const
+{
+    Benchmarks::dropTables(m_connection, BenchTables);
+}
+
+void tst_Bench_ModelMemory::hydrate_WithoutRelations() const
+{
+    hydrateAndReport<BenchRow>();
+}
+
+void tst_Bench_ModelMemory::hydrate_WithRelations() const
+{
+    hydrateAndReport<BenchRowRelations>();
+}
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+/* private */
+
+template<typename Model>
+void tst_Bench_ModelMemory::hydrateAndReport()
+{
+#ifdef TINYBENCH_HEAP_USAGE
+    const auto heapBefore = heapUsage();
+
+    const auto models = Model::query()->get();
+
+    // Models are still alive here
+    const auto heapUsed = heapUsage() - heapBefore -
+                          static_cast<qint64>(models.capacity() * sizeof (Model));
+
+    QCOMPARE(models.size(), RowsCount);
+
+    QTest::setBenchmarkResult(static_cast<qreal>(heapUsed) /
+                              static_cast<qreal>(models.size()),
+                              QTest::BytesAllocated);
+#endif
+}
+
+QTEST_MAIN(tst_Bench_ModelMemory)
+
+#include "tst_bench_modelmemory.moc"
@@ -0,0 +1,16 @@
+TEMPLATE = subdirs
+
+subdirsList =
+
+!disable_orm: \
+    subdirsList += \
+        eagermatching \
+        hydration \
+        modelmemory \
+        querycloning \
+        querycompilation \
+        whereclauses \
+
+SUBDIRS = $$sorted(subdirsList)
+
+unset(subdirsList)
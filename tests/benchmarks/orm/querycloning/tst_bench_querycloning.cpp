@@ -0,0 +1,175 @@
+#include <QCoreApplication>
+#include <QtTest>
+
+#include "orm/db.hpp"
+#include "orm/query/querybuilder.hpp"
+#include "orm/utils/type.hpp"
+
+#include "benchmarks.hpp"
+#include "databases.hpp"
+
+using Orm::Constants::GE;
+using Orm::Constants::ID;
+using Orm::Constants::LIKE;
+using Orm::Constants::LT;
+using Orm::Constants::NAME;
+using Orm::Constants::SIZE;
+
+using Orm::BindingType;
+using Orm::DB;
+using Orm::Types::SqlQuery;
+
+using QueryBuilder = Orm::Query::Builder;
+using TypeUtils = Orm::Utils::Type;
+
+using TestUtils::Benchmarks;
+using TestUtils::Databases;
+
+namespace
+{
+    /*! Number of rows in the benchmarked table. */
+    constexpr int RowsCount = 100'000;
+    /*! Number of rows in one chunk of the chunkById() benchmark. */
+    constexpr int ChunkSize = 1'000;
+
+    /*! Benchmark tables, all rows are generated when the benchmark starts. */
+    const QVector<Benchmarks::Table> BenchTables {
+        {"bench_cloning",
+         R"("id" integer not null primary key, "name" varchar not null, )"
+         R"("size" integer not null)",
+         R"("id", "name", "size")",
+         R"("x", 'name' || "x", "x" % 100)",
+         RowsCount},
+    };
+
+    /*! Build the benchmarked query with the columns, where clauses, and orders. */
+    void buildQuery(QueryBuilder &builder)
+    {
+        builder.from("bench_cloning")
+               .select({ID, NAME, SIZE})
+               .where(ID, GE, 1)
+               .where(SIZE, LT, RowsCount)
+               .where(NAME, LIKE, "name%")
+               .whereIn(SIZE, {1, 2, 3, 4, 5})
+               .orWhere([](QueryBuilder &query)
+               {
+                   query.where(ID, GE, 10).where(SIZE, GE, 10);
+               })
+               .whereNotNull(NAME)
+               .orderBy(NAME)
+               .orderBy(SIZE);
+    }
+} // namespace
+
+/* Measures cloning of the query with a few clauses, aggregates (clone the query
+   internally), and the chunkById() (clones the query on every page). */
+class tst_Bench_QueryCloning : public QObject // clazy:exclude=ctor-missing-parent-argument
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+    void cleanupTestCase() const;
+
+    void clone() const;
+    void clone_Modified() const;
+    void cloneWithout() const;
+    void aggregate_Count() const;
+    void chunkById() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Connection name used in this test case. */
+    QString m_connection {};
+};
+
+/* private slots */
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+void tst_Bench_QueryCloning::initTestCase()
+{
+    m_connection = Benchmarks::createConnection(BenchTables);
+
+    if (m_connection.isEmpty())
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+}
+
+void tst_Bench_QueryCloning::cleanupTestCase() const
+{
+    Benchmarks::dropTables(m_connection, BenchTables);
+}
+
+void tst_Bench_QueryCloning::clone() const
+{
+    auto builder = DB::connection(m_connection).query();
+    buildQuery(*builder);
+
+    QBENCHMARK {
+        auto cloned = builder->clone();
+    }
+}
+
+void tst_Bench_QueryCloning::clone_Modified() const
+{
+    auto builder = DB::connection(m_connection).query();
+    buildQuery(*builder);
+
+    // The same as every chunkById() page does
+    QBENCHMARK {
+        auto cloned = builder->clone();
+        cloned.forPageAfterId(ChunkSize, 1, ID, true);
+    }
+}
+
+void tst_Bench_QueryCloning::cloneWithout() const
+{
+    auto builder = DB::connection(m_connection).query();
+    buildQuery(*builder);
+
+    QBENCHMARK {
+        auto cloned = builder->cloneWithout({QueryBuilder::PropertyType::COLUMNS})
+                      .cloneWithoutBindings({BindingType::SELECT});
+    }
+}
+
+void tst_Bench_QueryCloning::aggregate_Count() const
+{
+    auto builder = DB::connection(m_connection).query();
+    builder->from("bench_cloning").where(SIZE, LT, 50);
+
+    quint64 count = 0;
+
+    QBENCHMARK {
+        count = builder->count();
+    }
+
+    QCOMPARE(count, static_cast<quint64>(RowsCount / 2));
+}
+
+void tst_Bench_QueryCloning::chunkById() const
+{
+    auto builder = DB::connection(m_connection).query();
+    builder->from("bench_cloning");
+
+    int rowsCount = 0;
+
+    QBENCHMARK_ONCE {
+        builder->chunkById(ChunkSize, [&rowsCount]
+                                      (SqlQuery &results, const int /*unused*/)
+        {
+            while (results.next())
+                ++rowsCount;
+
+            return true;
+        });
+    }
+
+    QCOMPARE(rowsCount, RowsCount);
+}
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+QTEST_MAIN(tst_Bench_QueryCloning)
+
+#include "tst_bench_querycloning.moc"
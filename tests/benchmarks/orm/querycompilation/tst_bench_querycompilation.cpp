@@ -0,0 +1,166 @@
+#include <QCoreApplication>
+#include <QtTest>
+
+#include "orm/db.hpp"
+#include "orm/query/querybuilder.hpp"
+#include "orm/utils/type.hpp"
+
+#include "benchmarks.hpp"
+#include "databases.hpp"
+
+using Orm::Constants::DESC;
+using Orm::Constants::GE;
+using Orm::Constants::ID;
+using Orm::Constants::LIKE;
+using Orm::Constants::NAME;
+using Orm::Constants::SIZE;
+
+using Orm::DB;
+
+using QueryBuilder = Orm::Query::Builder;
+using TypeUtils = Orm::Utils::Type;
+
+using TestUtils::Benchmarks;
+using TestUtils::Databases;
+
+namespace
+{
+    /*! Compiled SQL cache size used by the cached benchmark rows. */
+    constexpr std::size_t CacheSize = 100;
+
+    /*! Build the benchmarked query, the query shape is the same for all values. */
+    void buildQuery(QueryBuilder &builder, const int value)
+    {
+        builder.from("torrents")
+               .select({"torrents.id", "torrents.name", "torrent_peers.seeds"})
+               .join("torrent_peers", "torrents.id", "=", "torrent_peers.torrent_id")
+               .where(SIZE, GE, value)
+               .where(NAME, LIKE, QStringLiteral("%%1%").arg(value))
+               .whereIn(ID, {value, value + 1, value + 2})
+               .whereNotNull("torrent_peers.seeds")
+               .orderBy(SIZE, DESC)
+               .orderBy(ID)
+               .limit(10);
+    }
+} // namespace
+
+/* Compares the select query compilation with the compiled SQL cache disabled and
+   enabled, only the SQL compilation is measured, queries are never executed. */
+class tst_Bench_QueryCompilation : public QObject // clazy:exclude=ctor-missing-parent-argument
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+    void cleanup() const;
+
+    void toSql_SameQuery_data() const;
+    void toSql_SameQuery() const;
+
+    void toSql_NewQuery_data() const;
+    void toSql_NewQuery() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Populate the cache disabled/enabled benchmark rows. */
+    static void addCacheSizeRows();
+    /*! Set the compiled SQL cache size of the benchmarked connection. */
+    void setCompiledSqlCacheSize(std::size_t size) const;
+
+    /*! Connection name used in this test case. */
+    QString m_connection {};
+};
+
+/* private slots */
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+void tst_Bench_QueryCompilation::initTestCase()
+{
+    m_connection = Benchmarks::createConnection();
+
+    if (m_connection.isEmpty())
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+}
+
+void tst_Bench_QueryCompilation::cleanup() const
+{
+    setCompiledSqlCacheSize(0);
+}
+
+void tst_Bench_QueryCompilation::toSql_SameQuery_data() const
+{
+    addCacheSizeRows();
+}
+
+void tst_Bench_QueryCompilation::toSql_SameQuery() const
+{
+    QFETCH(std::size_t, cacheSize);
+
+    setCompiledSqlCacheSize(cacheSize);
+
+    auto builder = DB::connection(m_connection).query();
+    buildQuery(*builder, 1);
+
+    QString sql;
+
+    QBENCHMARK {
+        sql = builder->toSql();
+    }
+
+    QVERIFY(!sql.isEmpty());
+}
+
+void tst_Bench_QueryCompilation::toSql_NewQuery_data() const
+{
+    addCacheSizeRows();
+}
+
+void tst_Bench_QueryCompilation::toSql_NewQuery() const
+{
+    QFETCH(std::size_t, cacheSize);
+
+    setCompiledSqlCacheSize(cacheSize);
+
+    auto &connection = DB::connection(m_connection);
+
+    QString sql;
+    auto value = 0;
+
+    // Every iteration builds a new query that differs only in binding values
+    QBENCHMARK {
+        auto builder = connection.query();
+        buildQuery(*builder, ++value);
+
+        sql = builder->toSql();
+    }
+
+    QVERIFY(!sql.isEmpty());
+}
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+/* private */
+
+void tst_Bench_QueryCompilation::addCacheSizeRows()
+{
+    QTest::addColumn<std::size_t>("cacheSize");
+
+    QTest::newRow("cache disabled") << static_cast<std::size_t>(0);
+    QTest::newRow("cache enabled")  << CacheSize;
+}
+
+void tst_Bench_QueryCompilation::setCompiledSqlCacheSize(const std::size_t size) const
+{
+    if (m_connection.isEmpty())
+        return;
+
+    auto &grammar = DB::connection(m_connection).getQueryGrammar();
+
+    grammar.setCompiledSqlCacheSize(size);
+    grammar.flushCompiledSqlCache();
+}
+
+QTEST_MAIN(tst_Bench_QueryCompilation)
+
+#include "tst_bench_querycompilation.moc"
@@ -0,0 +1,128 @@
+#include <QCoreApplication>
+#include <QtTest>
+
+#include "orm/db.hpp"
+#include "orm/query/querybuilder.hpp"
+#include "orm/utils/type.hpp"
+
+#include "benchmarks.hpp"
+#include "databases.hpp"
+
+using Orm::Constants::GE;
+using Orm::Constants::ID;
+using Orm::Constants::LIKE;
+using Orm::Constants::LT;
+using Orm::Constants::NAME;
+using Orm::Constants::NE;
+using Orm::Constants::SIZE;
+
+using Orm::DB;
+
+using QueryBuilder = Orm::Query::Builder;
+using TypeUtils = Orm::Utils::Type;
+
+using TestUtils::Benchmarks;
+using TestUtils::Databases;
+
+namespace
+{
+    /*! Build the benchmarked query with 20 where clauses of all the common types. */
+    void buildQuery(QueryBuilder &builder)
+    {
+        builder.from("torrents")
+               .where(ID, GE, 1)
+               .where(SIZE, LT, 1000)
+               .where(NAME, LIKE, "%test%")
+               .where("progress", NE, 100)
+               .orWhere("note", LIKE, "%note%")
+               .whereEq("user_id", 1)
+               .whereEq("hash", "1579e3af2768cdf52ec84c1f320333f68401dc6e")
+               .orWhereEq("added_on", "2020-08-01 20:11:10")
+               .whereIn(ID, {1, 2, 3, 4, 5})
+               .whereNotIn(SIZE, {10, 20, 30})
+               .whereNull("deleted_at")
+               .whereNotNull(NAME)
+               .whereBetween(SIZE, {10, 100})
+               .whereNotBetween("progress", {0, 10})
+               .whereColumnEq("created_at", "updated_at")
+               .whereColumn("progress", LT, SIZE)
+               .whereRaw("size % 2 = ?", {0})
+               .where([](QueryBuilder &query)
+               {
+                   query.where(ID, LT, 100).orWhere(SIZE, GE, 100);
+               })
+               .whereDate("added_on", GE, "2020-08-01")
+               .whereRowValues({ID, NAME}, GE, {1, "test1"});
+    }
+} // namespace
+
+/* Measures building, cloning and compiling of the query with 20 where clauses,
+   queries are never executed. */
+class tst_Bench_WhereClauses : public QObject // clazy:exclude=ctor-missing-parent-argument
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void build() const;
+    void clone() const;
+    void toSql() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Connection name used in this test case. */
+    QString m_connection {};
+};
+
+/* private slots */
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+void tst_Bench_WhereClauses::initTestCase()
+{
+    m_connection = Benchmarks::createConnection();
+
+    if (m_connection.isEmpty())
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+}
+
+void tst_Bench_WhereClauses::build() const
+{
+    auto &connection = DB::connection(m_connection);
+
+    QBENCHMARK {
+        auto builder = connection.query();
+        buildQuery(*builder);
+    }
+}
+
+void tst_Bench_WhereClauses::clone() const
+{
+    auto builder = DB::connection(m_connection).query();
+    buildQuery(*builder);
+
+    QBENCHMARK {
+        auto cloned = builder->clone();
+    }
+}
+
+void tst_Bench_WhereClauses::toSql() const
+{
+    auto builder = DB::connection(m_connection).query();
+    buildQuery(*builder);
+
+    QString sql;
+
+    QBENCHMARK {
+        sql = builder->toSql();
+    }
+
+    QVERIFY(!sql.isEmpty());
+}
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+QTEST_MAIN(tst_Bench_WhereClauses)
+
+#include "tst_bench_whereclauses.moc"
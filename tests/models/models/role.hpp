@@ -37,7 +37,7 @@ public:
 
 private:
     /*! Map of relation names to methods. */
-    QHash<QString, RelationVisitor> u_relations {
+    inline static const QHash<QString, RelationVisitor> u_relations {
         {"users", [](auto &v) { v(&Role::users); }},
     };
 
@@ -62,7 +62,7 @@ private:
     QString u_table {"torrent_tags"};
 
     /*! Map of relation names to methods. */
-    QHash<QString, RelationVisitor> u_relations {
+    inline static const QHash<QString, RelationVisitor> u_relations {
         {"torrents",                        [](auto &v) { v(&Tag::torrents); }},
         {"torrents_WithoutPivotAttributes", [](auto &v) { v(&Tag::torrents_WithoutPivotAttributes); }},
         {"tagProperty",                     [](auto &v) { v(&Tag::tagProperty); }},
@@ -134,7 +134,7 @@ private:
 //    QString u_primaryKey {ID};
 
     /*! Map of relation names to methods. */
-    QHash<QString, RelationVisitor> u_relations {
+    inline static const QHash<QString, RelationVisitor> u_relations {
         {"torrentFiles", [](auto &v) { v(&Torrent::torrentFiles); }},
         {"torrentPeer",  [](auto &v) { v(&Torrent::torrentPeer); }},
         {"tags",         [](auto &v) { v(&Torrent::tags); }},
@@ -199,7 +199,7 @@ private:
 //    QStringList u_touches {"relation_name"};
 
     /*! The attributes that should be cast. */
-//    std::unordered_map<QString, CastItem> u_casts {
+//    inline static const std::unordered_map<QString, CastItem> u_casts {
 //        {NAME,       CastType::QString},
 //        {"progress", CastType::UShort},
 //        // Showcase only, the Torrent model doesn't have the decimal column
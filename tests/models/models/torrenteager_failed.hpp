@@ -32,7 +32,7 @@ private:
     QString u_table {"torrents"};
 
     /*! Map of relation names to methods. */
-    QHash<QString, RelationVisitor> u_relations {
+    inline static const QHash<QString, RelationVisitor> u_relations {
         {"torrentFiles", [](auto &v) { v(&TorrentEager_Failed::torrentFiles); }},
     };
 
@@ -46,7 +46,7 @@ private:
     QString u_table {"torrent_previewable_file_properties"};
 
     /*! Map of relation names to methods. */
-    QHash<QString, RelationVisitor> u_relations {
+    inline static const QHash<QString, RelationVisitor> u_relations {
         {"torrentFile",          [](auto &v) { v(&TorrentPreviewableFileProperty::torrentFile); }},
         {"filePropertyProperty", [](auto &v) { v(&TorrentPreviewableFileProperty::filePropertyProperty); }},
     };
@@ -61,7 +61,7 @@ public:
 
 private:
     /*! Map of relation names to methods. */
-    QHash<QString, RelationVisitor> u_relations {
+    inline static const QHash<QString, RelationVisitor> u_relations {
         {"roles",    [](auto &v) { v(&User::roles); }},
         {"phone",    [](auto &v) { v(&User::phone); }},
         {"torrents", [](auto &v) { v(&User::torrents); }},
@@ -78,7 +78,7 @@ private:
     bool u_timestamps = true;
 
     /*! The attributes that should be cast. */
-    std::unordered_map<QString, CastItem> u_casts {
+    inline static const std::unordered_map<QString, CastItem> u_casts {
         {"is_banned", CastType::Boolean},
     };
 };
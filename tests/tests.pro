@@ -7,4 +7,8 @@ SUBDIRS = \
 !disable_tom: \
     SUBDIRS += testdata_tom
 
+build_benchmarks: \
+    SUBDIRS += benchmarks
+
 auto.depends = TinyUtils
+benchmarks.depends = TinyUtils